@@ -0,0 +1,82 @@
+using System;
+using System.Diagnostics;
+using System.Windows.Forms;
+using GTA;
+using GTA.Math;
+using GTA.Native;
+
+// Measures how much managed memory native calls allocate through the NativeArgument overloads of Function.Call,
+// compared to the same calls with every argument converted to an InputArgument first. Press F10 in game to run it.
+public class NativeCallAllocationBenchmark : Script
+{
+    private const int Iterations = 100000;
+
+    public NativeCallAllocationBenchmark()
+    {
+        // Required for AppDomain.MonitoringTotalAllocatedMemorySize, and can't be turned off again once enabled
+        AppDomain.MonitoringIsEnabled = true;
+
+        KeyDown += OnKeyDown;
+    }
+
+    private void OnKeyDown(object sender, KeyEventArgs e)
+    {
+        if (e.KeyCode != Keys.F10)
+        {
+            return;
+        }
+
+        Ped playerPed = Game.LocalPlayerPed;
+        Vector3 position = playerPed.Position;
+
+        // Run both once before measuring so the JIT compilation and the native hash lookups are not counted
+        CallWithNativeArguments(playerPed, position, 1);
+        CallWithInputArguments(playerPed, position, 1);
+
+        string nativeArgumentResult = Measure(() => CallWithNativeArguments(playerPed, position, Iterations));
+        string inputArgumentResult = Measure(() => CallWithInputArguments(playerPed, position, Iterations));
+
+        GTA.UI.Notification.PostTicker("NativeArgument: " + nativeArgumentResult, false);
+        GTA.UI.Notification.PostTicker("InputArgument: " + inputArgumentResult, false);
+    }
+
+    private static string Measure(Action benchmark)
+    {
+        GC.Collect();
+        GC.WaitForPendingFinalizers();
+
+        long allocatedBefore = AppDomain.CurrentDomain.MonitoringTotalAllocatedMemorySize;
+        int collectionsBefore = GC.CollectionCount(0);
+        var stopwatch = Stopwatch.StartNew();
+
+        benchmark();
+
+        stopwatch.Stop();
+        long allocatedBytes = AppDomain.CurrentDomain.MonitoringTotalAllocatedMemorySize - allocatedBefore;
+        int collections = GC.CollectionCount(0) - collectionsBefore;
+
+        return string.Format("{0:F1} bytes/call, {1} gen 0 GCs, {2:F0} ns/call",
+            (double)allocatedBytes / Iterations, collections,
+            stopwatch.Elapsed.TotalMilliseconds * 1000000.0 / Iterations);
+    }
+
+    private static void CallWithNativeArguments(Ped ped, Vector3 position, int iterations)
+    {
+        for (int i = 0; i < iterations; i++)
+        {
+            Function.Call<int>(Hash.GET_ENTITY_HEALTH, ped);
+            Function.Call<float>(Hash.GET_DISTANCE_BETWEEN_COORDS, position.X, position.Y, position.Z, 0f, 0f, 0f, true);
+        }
+    }
+
+    private static void CallWithInputArguments(Ped ped, Vector3 position, int iterations)
+    {
+        for (int i = 0; i < iterations; i++)
+        {
+            // The casts make the compiler pick the InputArgument overloads, which allocate an object per argument
+            Function.Call<int>(Hash.GET_ENTITY_HEALTH, (InputArgument)ped);
+            Function.Call<float>(Hash.GET_DISTANCE_BETWEEN_COORDS, (InputArgument)position.X, (InputArgument)position.Y,
+                (InputArgument)position.Z, (InputArgument)0f, (InputArgument)0f, (InputArgument)0f, (InputArgument)true);
+        }
+    }
+}
@@ -7,7 +7,9 @@ using System;
 using System.CodeDom.Compiler;
 using System.Collections.Concurrent;
 using System.Collections.Generic;
+using System.Diagnostics;
 using System.Drawing;
+using System.Globalization;
 using System.Linq;
 using System.Reflection;
 using System.Runtime.InteropServices;
@@ -40,6 +42,10 @@ namespace SHVDN
         private List<string> _commandCandidates = new();
         private bool _hideCandidates = false;
         private int _selectedCandidateIndex = -1;
+        private bool _showScriptStatsOverlay;
+        // Only accessed in `DoTick`, so no lock is needed
+        private string[] _scriptStatsOverlayLines = Array.Empty<string>();
+        private int _lastScriptStatsOverlayUpdateTickCount;
 
         // We need a lock because tick calls and keyboard events are fired on different threads, even if we don't use
         // a dedicated thread in order to avoid a fiber from SHV
@@ -51,6 +57,10 @@ namespace SHVDN
         private const int ConsoleHeight = BaseHeight / 3;
         private const int InputHeight = 20;
         private const int LinesPerPage = 16;
+        private const int ScriptStatsOverlayWidth = 520;
+        private const int ScriptStatsOverlayMaxScriptCount = 10;
+        // Calculating percentiles needs sorting, so update the overlay text only twice a second
+        private const int ScriptStatsOverlayUpdateInterval = 500;
 
         private static readonly Color s_inputColor = Color.White;
         private static readonly Color s_inputColorBusy = Color.DarkGray;
@@ -180,6 +190,28 @@ namespace SHVDN
             }
         }
 
+        /// <summary>
+        /// Gets or sets whether to draw the tick time statistics of the scripts that take the most time while
+        /// the console is closed.
+        /// </summary>
+        internal bool ShowScriptStatsOverlay
+        {
+            get
+            {
+                lock (_lock)
+                {
+                    return _showScriptStatsOverlay;
+                }
+            }
+            set
+            {
+                lock (_lock)
+                {
+                    _showScriptStatsOverlay = value;
+                }
+            }
+        }
+
         /// <summary>
         /// Gets or sets the command history. This is used to avoid losing the command history on SHVDN reloading.
         /// </summary>
@@ -487,6 +519,18 @@ namespace SHVDN
         /// Main execution logic of the console.
         /// </summary>
         internal void DoTick()
+        {
+            long startTimestamp = Stopwatch.GetTimestamp();
+
+            DoTickCore();
+
+            if (TimelineTracer.IsRecording)
+            {
+                TimelineTracer.AddCompleteEvent("Console.DoTick", TimelineTracer.CategoryTick, startTimestamp);
+            }
+        }
+
+        private void DoTickCore()
         {
             int nowTickCount = Environment.TickCount;
 
@@ -558,6 +602,11 @@ namespace SHVDN
                 {
                     shouldBlockControls = false;
                 }
+
+                if (ShowScriptStatsOverlay)
+                {
+                    DrawScriptStatsOverlay(nowTickCount);
+                }
                 return; // Nothing more to do here when the console is not open
             }
 
@@ -1384,6 +1433,42 @@ namespace SHVDN
             return sb.ToString();
         }
 
+        private void DrawScriptStatsOverlay(int nowTickCount)
+        {
+            if (nowTickCount - _lastScriptStatsOverlayUpdateTickCount >= ScriptStatsOverlayUpdateInterval
+                || _scriptStatsOverlayLines.Length == 0)
+            {
+                _scriptStatsOverlayLines = BuildScriptStatsOverlayLines();
+                _lastScriptStatsOverlayUpdateTickCount = nowTickCount;
+            }
+
+            float x = BaseWidth - ScriptStatsOverlayWidth;
+            DrawRect(x, 0, ScriptStatsOverlayWidth, _scriptStatsOverlayLines.Length * 14 + 8, s_backgroundColor);
+            for (int i = 0; i < _scriptStatsOverlayLines.Length; i++)
+            {
+                DrawText(x + 4, 2 + i * 14, _scriptStatsOverlayLines[i], s_outputColor);
+            }
+        }
+
+        private static string[] BuildScriptStatsOverlayLines()
+        {
+            ScriptDomain domain = ScriptDomain.CurrentDomain;
+            if (domain == null)
+            {
+                return Array.Empty<string>();
+            }
+
+            var lines = new List<string> { "Script tick times (p95 / p99 / max)" };
+            foreach (KeyValuePair<Script, ScriptTickStatsSnapshot> kvp in domain.GetScriptTickStats().Take(ScriptStatsOverlayMaxScriptCount))
+            {
+                ScriptTickStatsSnapshot stats = kvp.Value;
+                lines.Add(string.Format(CultureInfo.InvariantCulture, "{0}: {1:F2} / {2:F2} / {3:F2} ms, {4:F0} natives",
+                    EscapeTokens(kvp.Key.Name), stats.P95, stats.P99, stats.Max, stats.NativeCallsPerTick));
+            }
+
+            return lines.ToArray();
+        }
+
         private static unsafe void DrawRect(float x, float y, int width, int height, Color color)
         {
             float w = (float)(width) / BaseWidth;
@@ -15,6 +15,8 @@ std::mutex sGameMainThreadVarsMutex;
 std::atomic_bool sGameMainThreadVarsInitialized(false);
 
 std::atomic_bool sScriptDomainRequestedToReload(false);
+// Set from the script domain, which owns the timeline tracer, and read in the main domain where CLR thread ticks are driven
+std::atomic_bool sClrThreadTickTracingEnabled(false);
 
 static void SetTlsContext(LPVOID context)
 {
@@ -46,6 +48,51 @@ static void RequestScriptDomainToReload()
     sScriptDomainRequestedToReload.store(true, std::memory_order_release);
 }
 
+static void SetClrThreadTickTracingEnabled(int enabled)
+{
+    sClrThreadTickTracingEnabled.store(enabled != 0, std::memory_order_relaxed);
+}
+
+// Key messages sent from the keyboard hook thread to the CLR thread. The hook thread is the only producer and the CLR
+// thread the only consumer, so the ring needs no lock and the hook thread never waits for a tick to finish.
+struct KeyMessage
+{
+    DWORD keys; // The key code with the modifier flags of `System.Windows.Forms.Keys`
+    BOOL isDown;
+};
+constexpr unsigned int kKeyMessageRingSize = 256; // Must be a power of 2
+KeyMessage sKeyMessageRing[kKeyMessageRingSize];
+std::atomic_uint sKeyMessageWriteIndex(0);
+std::atomic_uint sKeyMessageReadIndex(0);
+
+// The key messages of the current frame that are passed to the script domain, only accessed in the CLR thread
+KeyMessage sFrameKeyMessages[kKeyMessageRingSize];
+
+static void PushKeyMessage(DWORD keys, bool isDown)
+{
+    const unsigned int writeIndex = sKeyMessageWriteIndex.load(std::memory_order_relaxed);
+    // The CLR thread drains the ring every frame, so it can only get full while the CLR thread is stalled, such as
+    // during a reload. Drop the message in that case rather than overwriting one the CLR thread may be reading.
+    if (writeIndex - sKeyMessageReadIndex.load(std::memory_order_acquire) == kKeyMessageRingSize)
+        return;
+
+    sKeyMessageRing[writeIndex & (kKeyMessageRingSize - 1)] = { keys, isDown ? TRUE : FALSE };
+    sKeyMessageWriteIndex.store(writeIndex + 1, std::memory_order_release);
+}
+static bool PopKeyMessage(KeyMessage* message)
+{
+    const unsigned int readIndex = sKeyMessageReadIndex.load(std::memory_order_relaxed);
+    if (readIndex == sKeyMessageWriteIndex.load(std::memory_order_acquire))
+        return false;
+
+    *message = sKeyMessageRing[readIndex & (kKeyMessageRingSize - 1)];
+    sKeyMessageReadIndex.store(readIndex + 1, std::memory_order_release);
+    return true;
+}
+
+// Defined in the unmanaged section below, where the ScriptHookV SDK header is included
+static PUINT64 InvokeNative(UINT64 hash, const UINT64* args, int argCount);
+
 #pragma managed(pop)
 
 // Import C# code base
@@ -57,15 +104,6 @@ using namespace System::Collections::Generic;
 using namespace System::Reflection;
 namespace WinForms = System::Windows::Forms;
 
-[FlagsAttribute]
-private enum class ModifierKeyState
-{
-    None = 0,
-    Shift = 0x10000,
-    Control = 0x20000,
-    Alt = 0x40000,
-};
-
 public ref class ScriptHookVDotNet // This is not a static class, so that console scripts can inherit from it for ConsoleInput class
 {
 public:
@@ -216,6 +254,110 @@ public:
         for each (auto script in domain->RunningScripts)
             console->PrintInfo(IO::Path::GetFileName(script->Filename) + " ~h~" + script->Name + (script->IsRunning ? (script->IsPaused ? " ~o~[paused]" : " ~g~[running]") : " ~r~[aborted]"));
     }
+    [SHVDN::ConsoleCommand("List the tick time statistics of all running scripts, slowest first")]
+    static void Stats()
+    {
+        SHVDN::Console^ console = GetConsole();
+        if (console == nullptr)
+        {
+            WriteErrorMessageForConsoleNotLoadedWhenExecutingCommand("Stats");
+            return;
+        }
+
+        console->PrintInfo("~c~--- Script Tick Times ---");
+        for each (auto kvp in domain->GetScriptTickStats())
+            console->PrintInfo(IO::Path::GetFileName(kvp.Key->Filename) + " ~h~" + kvp.Key->Name + "~h~: " + kvp.Value.ToString());
+        if (domain->ScriptFrameBudget > 0)
+            console->PrintInfo("Low priority script ticks deferred by the frame budget: " + domain->DeferredScriptTickCount);
+    }
+    [SHVDN::ConsoleCommand("Show or hide the tick times of the slowest scripts on screen while the console is closed")]
+    static void ShowStatsOverlay(bool show)
+    {
+        SHVDN::Console^ console = GetConsole();
+        if (console == nullptr)
+        {
+            WriteErrorMessageForConsoleNotLoadedWhenExecutingCommand("ShowStatsOverlay");
+            return;
+        }
+
+        console->ShowScriptStatsOverlay = show;
+    }
+
+    [SHVDN::ConsoleCommand("Record the time spent in each native function per script for the specified number of seconds")]
+    static void ProfileNatives(int seconds)
+    {
+        SHVDN::Console^ console = GetConsole();
+        if (console == nullptr)
+        {
+            WriteErrorMessageForConsoleNotLoadedWhenExecutingCommand("ProfileNatives");
+            return;
+        }
+
+        if (seconds <= 0)
+        {
+            console->PrintError("The duration must be at least 1 second.");
+            return;
+        }
+
+        SHVDN::NativeProfiler::Start(seconds * 1000);
+        console->PrintInfo(String::Format("Profiling native calls for {0} seconds ...", seconds));
+    }
+
+    [SHVDN::ConsoleCommand("Record a timeline of ticks, scripts and native calls to a Chrome trace event file for the specified number of seconds")]
+    static void RecordTimeline(int seconds, String ^path)
+    {
+        SHVDN::Console^ console = GetConsole();
+        if (console == nullptr)
+        {
+            WriteErrorMessageForConsoleNotLoadedWhenExecutingCommand("RecordTimeline");
+            return;
+        }
+
+        if (seconds <= 0)
+        {
+            console->PrintError("The duration must be at least 1 second.");
+            return;
+        }
+
+        if (!IO::Path::HasExtension(path))
+            path = IO::Path::ChangeExtension(path, ".json");
+        path = IO::Path::GetFullPath(path);
+
+        try
+        {
+            SHVDN::TimelineTracer::Start(path, seconds * 1000);
+            console->PrintInfo(String::Format("Recording the timeline to \"{0}\" for {1} seconds ...", path, seconds));
+        }
+        catch (Exception^ ex)
+        {
+            console->PrintError(String::Format("Failed to start recording the timeline to \"{0}\": {1}", path, ex->Message));
+        }
+    }
+
+    [SHVDN::ConsoleCommand("Save the results of the last native profiling to a CSV file")]
+    static void DumpNativeProfile(String ^path)
+    {
+        SHVDN::Console^ console = GetConsole();
+        if (console == nullptr)
+        {
+            WriteErrorMessageForConsoleNotLoadedWhenExecutingCommand("DumpNativeProfile");
+            return;
+        }
+
+        if (!IO::Path::HasExtension(path))
+            path = IO::Path::ChangeExtension(path, ".csv");
+        path = IO::Path::GetFullPath(path);
+
+        try
+        {
+            int rowCount = SHVDN::NativeProfiler::WriteCsv(path);
+            console->PrintInfo(String::Format("Saved {0} rows to \"{1}\".", rowCount, path));
+        }
+        catch (Exception^ ex)
+        {
+            console->PrintError(String::Format("Failed to save the native profile to \"{0}\": {1}", path, ex->Message));
+        }
+    }
 
 internal:
     static SHVDN::Console^ console = nullptr;
@@ -223,6 +365,8 @@ internal:
     static array<WinForms::Keys>^ reloadKeyBinding = { WinForms::Keys::None };
     static array<WinForms::Keys>^ consoleKeyBinding = { WinForms::Keys::F4 };
     static unsigned int scriptTimeoutThreshold = 5000;
+    static double scriptFrameBudget = 0.0;
+    static bool useEntityPoolSnapshot = false;
     static bool shouldWarnOfScriptsBuiltAgainstDeprecatedApiWithTicker = true;
     static bool AutoLoadScripts = true;
 
@@ -230,8 +374,10 @@ internal:
     // condition during reload. Do note that static variables are not shared between `AppDomain`s.
     static Object^ variablesLockForMainDomain = gcnew Object();
     static Object^ variablesLockForScriptDomain = gcnew Object();
-    static array<bool>^ _keyboardStatePool = gcnew array<bool>(256);
-    static ModifierKeyState _modKeyState = ModifierKeyState::None;
+    // The keys that are down in the main domain, only updated and read in the CLR thread
+    static SHVDN::KeyboardState keyboardState;
+    static SHVDN::KeyboardState reloadKeyChord;
+    static SHVDN::KeyboardState consoleKeyChord;
 
     value struct LogMessageInfo
     {
@@ -292,19 +438,6 @@ internal:
             }
         }
     }
-
-    static void UpdatePrimaryKeyboardStateCache(unsigned char keyCode, bool down)
-    {
-        _keyboardStatePool[keyCode] = down;
-    }
-    static void UpdateKeyboardModifierStateCache(bool shift, bool ctrl, bool alt)
-    {
-        ModifierKeyState newState = (shift ? ModifierKeyState::Shift : ModifierKeyState::None);
-        newState = (ctrl ? newState | ModifierKeyState::Control : newState);
-        newState = (alt ? newState | ModifierKeyState::Alt : newState);
-
-        _modKeyState = newState;
-    }
 };
 
 ref class InvalidKeysFoundError sealed
@@ -580,6 +713,22 @@ static void ScriptHookVDotNet_ManagedInit()
                     ScriptHookVDotNet::scriptTimeoutThreshold = outVal;
                 }
             }
+            else if (String::Equals(keyStr, "ScriptFrameBudget", StringComparison::OrdinalIgnoreCase))
+            {
+                double outVal;
+                if (Double::TryParse(valueStr, Globalization::NumberStyles::Float, Globalization::CultureInfo::InvariantCulture, outVal) && outVal >= 0)
+                {
+                    ScriptHookVDotNet::scriptFrameBudget = outVal;
+                }
+            }
+            else if (String::Equals(keyStr, "EntityPoolSnapshot", StringComparison::OrdinalIgnoreCase))
+            {
+                bool outVal;
+                if (Boolean::TryParse(valueStr, outVal))
+                {
+                    ScriptHookVDotNet::useEntityPoolSnapshot = outVal;
+                }
+            }
             else if (String::Equals(keyStr, "ScriptsLocation", StringComparison::OrdinalIgnoreCase))
                 scriptPath = valueStr->Trim('"');
             else if (String::Equals(keyStr, "WarnOfDeprecatedScriptsWithTicker", StringComparison::OrdinalIgnoreCase))
@@ -605,6 +754,10 @@ static void ScriptHookVDotNet_ManagedInit()
         SHVDN::Log::Message(SHVDN::Log::Level::Error, "Failed to load config: ", ex->ToString());
     }
 
+    // Pack the key bindings, so each key message checks a binding in a single operation
+    ScriptHookVDotNet::reloadKeyChord = SHVDN::KeyboardState::FromChord(ScriptHookVDotNet::reloadKeyBinding);
+    ScriptHookVDotNet::consoleKeyChord = SHVDN::KeyboardState::FromChord(ScriptHookVDotNet::consoleKeyBinding);
+
     // Create a separate script domain
     domain = SHVDN::ScriptDomain::Load(".", scriptPath);
     if (domain == nullptr)
@@ -616,11 +769,21 @@ static void ScriptHookVDotNet_ManagedInit()
     }
 
     domain->ScriptTimeoutThreshold = ScriptHookVDotNet::scriptTimeoutThreshold;
+    domain->ScriptFrameBudget = ScriptHookVDotNet::scriptFrameBudget;
+    domain->UseEntityPoolSnapshot = ScriptHookVDotNet::useEntityPoolSnapshot;
     domain->ShouldWarnOfScriptsBuiltAgainstDeprecatedApiWithTicker = ScriptHookVDotNet::shouldWarnOfScriptsBuiltAgainstDeprecatedApiWithTicker;
 
     // Set functions for Thread Local Storage (TLS), so scripts can do tasks that need variables in the TLS of the main thread in their script thread
     domain->InitTlsStuffForTlsContextSwitch(static_cast<IntPtr>(GetTlsContext), static_cast<IntPtr>(SetTlsContext),
         static_cast<IntPtr>(GetTlsContextAddrOfGameMainThread()), GetGameMainThreadId());
+    // Set the function that performs a whole native call, so a native call needs only one managed-to-unmanaged
+    // transition regardless of how many arguments it takes
+    domain->InitNativeInvoker(static_cast<IntPtr>(InvokeNative));
+    // A timeline being recorded in the previous script domain is discarded on reload
+    SetClrThreadTickTracingEnabled(false);
+    domain->InitTimelineTracer(static_cast<IntPtr>(SetClrThreadTickTracingEnabled));
+    // Set the array the key messages of each frame are passed in
+    domain->InitKeyMessageBuffer(IntPtr(static_cast<void*>(sFrameKeyMessages)));
 
     try
     {
@@ -651,6 +814,9 @@ static void ScriptHookVDotNet_ManagedInit()
         domain->AppDomain->SetData("Console", console);
         domain->AppDomain->DoCallBack(gcnew CrossAppDomainDelegate(&ScriptHookVDotNet::SetConsole));
 
+        // Let the script domain drive the console, so a frame needs only one cross-domain call
+        domain->AttachConsole(console);
+
         // Add default console commands
         console->RegisterCommands(ScriptHookVDotNet::typeid);
     }
@@ -675,110 +841,60 @@ static void ScriptHookVDotNet_ManagedInit()
     }
 }
 
-static void ScriptHookVDotNet_ManagedTick()
+// Drains the key messages the keyboard hook thread has queued since the last tick and handles the key bindings of
+// SHVDN. Must be called in the CLR thread with `variablesLockForMainDomain` held. Returns the number of the remaining
+// messages, which are put in `sFrameKeyMessages` for the script domain.
+static int ScriptHookVDotNet_ProcessKeyMessages()
 {
-    msclr::lock l(ScriptHookVDotNet::variablesLockForMainDomain);
-
     SHVDN::Console^ console = ScriptHookVDotNet::console;
-    if (console != nullptr)
-        console->DoTick();
-
-    SHVDN::ScriptDomain^ scriptDomain = ScriptHookVDotNet::domain;
-    if (scriptDomain != nullptr)
-        scriptDomain->DoTick();
-}
+    int frameKeyMessageCount = 0;
 
-static bool AreAllKeysPressed(array<WinForms::Keys>^ keys)
-{
-    for each (WinForms::Keys key in keys)
+    KeyMessage message;
+    while (PopKeyMessage(&message))
     {
-        switch (key)
+        const auto keys = static_cast<WinForms::Keys>(message.keys);
+        const bool keydown = message.isDown != FALSE;
+
+        ScriptHookVDotNet::keyboardState = ScriptHookVDotNet::keyboardState.WithKey(keys, keydown)
+            .WithModifiers(keys & WinForms::Keys::Modifiers);
+
+        if (console != nullptr)
         {
-        case WinForms::Keys::Shift:
-            if ((ScriptHookVDotNet::_modKeyState & static_cast<ModifierKeyState>(WinForms::Keys::Shift))
-                == ModifierKeyState::None)
-            {
-                return false;
-            }
-            break;
-        case WinForms::Keys::Control:
-            if ((ScriptHookVDotNet::_modKeyState & static_cast<ModifierKeyState>(WinForms::Keys::Control))
-                == ModifierKeyState::None)
-            {
-                return false;
-            }
-            break;
-        case WinForms::Keys::Alt:
-            if ((ScriptHookVDotNet::_modKeyState & static_cast<ModifierKeyState>(WinForms::Keys::Alt))
-                == ModifierKeyState::None)
+            if (keydown && ScriptHookVDotNet::keyboardState.IsChordDown(ScriptHookVDotNet::reloadKeyChord))
             {
-                return false;
+                // Force a reload
+                ScriptHookVDotNet::Reload();
+                continue;
             }
-            break;
-        default:
-            if (!ScriptHookVDotNet::_keyboardStatePool[(int)key])
+            if (keydown && ScriptHookVDotNet::keyboardState.IsChordDown(ScriptHookVDotNet::consoleKeyChord))
             {
-                return false;
+                // Toggle open state
+                console->IsOpen = !console->IsOpen;
+                continue;
             }
         }
+
+        sFrameKeyMessages[frameKeyMessageCount++] = message;
     }
 
-    return true;
+    return frameKeyMessageCount;
 }
 
-static void ScriptHookVDotNet_ManagedKeyboardMessage(unsigned long keycode, bool keydown, bool ctrl, bool shift, bool alt)
+static void ScriptHookVDotNet_ManagedTick()
 {
-    // Filter out invalid key codes
-    if (keycode <= 0 || keycode >= 256)
-        return;
+    const bool traceTick = sClrThreadTickTracingEnabled.load(std::memory_order_relaxed);
+    const long long tickStartTimestamp = traceTick ? Diagnostics::Stopwatch::GetTimestamp() : 0;
 
-    // Protect against race condition during reload.
-    // Also prevent from the keyboard thread reading stale values such as key bindings.
     msclr::lock l(ScriptHookVDotNet::variablesLockForMainDomain);
 
-    SHVDN::ScriptDomain^ scriptDomain = ScriptHookVDotNet::domain;
-    // If the TLS stuff is not initialized, the console or some script can call a native function without swapping
-    // TLS address, leading the whole process to crash
-    if (scriptDomain == nullptr || !scriptDomain->IsTlsStuffInitialized())
-    {
-        return;
-    }
-
-    ScriptHookVDotNet::UpdatePrimaryKeyboardStateCache(static_cast<unsigned char>(keycode), keydown);
-    ScriptHookVDotNet::UpdateKeyboardModifierStateCache(shift, ctrl, alt);
-
-    // Convert message into a key event
-    auto keys = safe_cast<WinForms::Keys>(keycode);
-    if (ctrl)  keys = keys | WinForms::Keys::Control;
-    if (shift) keys = keys | WinForms::Keys::Shift;
-    if (alt)   keys = keys | WinForms::Keys::Alt;
-
-    SHVDN::Console^ console = ScriptHookVDotNet::console;
-    if (console != nullptr)
-    {
-        if (keydown && AreAllKeysPressed(ScriptHookVDotNet::reloadKeyBinding))
-        {
-            // Force a reload
-            ScriptHookVDotNet::Reload();
-            return;
-        }
-        if (keydown && AreAllKeysPressed(ScriptHookVDotNet::consoleKeyBinding))
-        {
-            // Toggle open state
-            console->IsOpen = !console->IsOpen;
-            return;
-        }
-
-        // Send key events to console
-        console->DoKeyEvent(keys, keydown);
+    const int keyMessageCount = ScriptHookVDotNet_ProcessKeyMessages();
 
-        // Do not send keyboard events to other running scripts when console is open
-        if (console->IsOpen)
-            return;
-    }
+    // Every call on the proxy of the script domain is a cross-domain transition, so the key messages, the console,
+    // the scripts and the timeline are all driven by a single call that runs inside the script domain
 
-    // Send key events to all scripts
-    scriptDomain->DoKeyEvent(keys, keydown);
+    SHVDN::ScriptDomain^ scriptDomain = ScriptHookVDotNet::domain;
+    if (scriptDomain != nullptr)
+        scriptDomain->DoFrame(traceTick, tickStartTimestamp, keyMessageCount);
 }
 
 // This is needed to match `_tls_index` of .NET CLR dlls, which are loaded by the OS loader (if we understand
@@ -794,6 +910,19 @@ static int EmptyClrMethodForEagerClrDllLoading()
 
 #include <Main.h>
 
+// Does the whole init/push/call sequence in native code, so the managed side doesn't have to issue one P/Invoke for
+// `nativeInit`, one per argument for `nativePush64` and one for `nativeCall`
+static PUINT64 InvokeNative(UINT64 hash, const UINT64* args, int argCount)
+{
+    nativeInit(hash);
+    for (int i = 0; i < argCount; i++)
+    {
+        nativePush64(args[i]);
+    }
+
+    return nativeCall();
+}
+
 std::atomic<HANDLE> hClrThread;
 std::atomic<HANDLE> hClrWaitEvent{ nullptr };
 std::atomic<HANDLE> hClrContinueEvent{ nullptr };
@@ -897,12 +1026,18 @@ static void ScriptKeyboardMessage(DWORD key, WORD repeats, BYTE scanCode, BOOL i
         return;
     }
 
-    ScriptHookVDotNet_ManagedKeyboardMessage(
-        key,
-        !isUpNow,
-        (GetAsyncKeyState(VK_CONTROL) & 0x8000) != 0,
-        (GetAsyncKeyState(VK_SHIFT  ) & 0x8000) != 0,
-        isWithAlt != FALSE);
+    // Filter out invalid key codes
+    if (key <= 0 || key >= 256)
+        return;
+
+    // Same values as the modifier flags of `System.Windows.Forms.Keys`
+    DWORD keys = key;
+    if ((GetAsyncKeyState(VK_SHIFT  ) & 0x8000) != 0) keys |= 0x10000;
+    if ((GetAsyncKeyState(VK_CONTROL) & 0x8000) != 0) keys |= 0x20000;
+    if (isWithAlt != FALSE)                           keys |= 0x40000;
+
+    // Only queue the message, so this thread never waits for the CLR thread, which handles it at the next tick
+    PushKeyMessage(keys, isUpNow == FALSE);
 }
 
 BOOL WINAPI DllMain(HMODULE hModule, DWORD fdwReason, LPVOID lpvReserved)
@@ -0,0 +1,51 @@
+//
+// Copyright (C) 2015 crosire & kagikn & contributors
+// License: https://github.com/scripthookvdotnet/scripthookvdotnet#license
+//
+
+namespace SHVDN
+{
+    /// <summary>
+    /// The creation or deletion of an entity in one of the entity pools, found once per frame and broadcast to all
+    /// scripts of a script domain.
+    /// </summary>
+    /// <remarks>
+    /// No script handle is created when the event is published. The handle of a created entity is created on demand
+    /// with <see cref="ScriptDomain.TryGetEntityPoolEventHandle(in EntityPoolEvent, out int)"/>.
+    /// </remarks>
+    public readonly struct EntityPoolEvent
+    {
+        internal EntityPoolEvent(NativeMemory.EntityPoolKind pool, uint slotIndex, uint generation, int handle,
+            bool isCreated)
+        {
+            Pool = pool;
+            SlotIndex = slotIndex;
+            Generation = generation;
+            Handle = handle;
+            IsCreated = isCreated;
+        }
+
+        /// <summary>
+        /// Gets the pool the entity was created or deleted in.
+        /// </summary>
+        public NativeMemory.EntityPoolKind Pool { get; }
+        /// <summary>
+        /// Gets the index of the pool slot the entity is or was in.
+        /// </summary>
+        public uint SlotIndex { get; }
+        /// <summary>
+        /// Gets the reuse counter of the slot for the entity, which tells it apart from other entities in the same
+        /// slot. The vehicle pool has no reuse counters, so the script domain counts the vehicles seen in the slot.
+        /// </summary>
+        public uint Generation { get; }
+        /// <summary>
+        /// Gets the script handle of a deleted entity, which is no longer valid but can be compared against the
+        /// handles a script holds. This is 0 for created entities, and for deleted entities no handle was asked for.
+        /// </summary>
+        public int Handle { get; }
+        /// <summary>
+        /// Gets whether the entity was created, or <see langword="false"/> if it was deleted.
+        /// </summary>
+        public bool IsCreated { get; }
+    }
+}
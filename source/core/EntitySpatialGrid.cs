@@ -0,0 +1,215 @@
+//
+// Copyright (C) 2015 crosire & kagikn & contributors
+// License: https://github.com/scripthookvdotnet/scripthookvdotnet#license
+//
+
+using System;
+using System.Collections.Generic;
+
+namespace SHVDN
+{
+    /// <summary>
+    /// A uniform grid over the XY positions of the entities in a <see cref="NativeMemory.EntityPoolSnapshot"/>, so
+    /// radius, box and nearest queries only visit the cells they overlap instead of every entity.
+    /// </summary>
+    /// <remarks>
+    /// <para>
+    /// The cells are hashed into a bucket table sized to the entity count, so the grid covers the whole world without
+    /// a memory cost for empty cells. The table is built with a counting sort, which costs a pass over the entities.
+    /// </para>
+    /// <para>
+    /// The results are the indices of the entities in the position arrays passed to <see cref="Build"/>.
+    /// </para>
+    /// </remarks>
+    internal sealed class EntitySpatialGrid
+    {
+        // Most proximity queries of scripts use a radius of a few dozen meters
+        private const float CellSize = 32f;
+        private const float InverseCellSize = 1f / CellSize;
+
+        private float[] _positionsX = Array.Empty<float>();
+        private float[] _positionsY = Array.Empty<float>();
+        private float[] _positionsZ = Array.Empty<float>();
+        private int _count;
+
+        private int[] _cellsX = Array.Empty<int>();
+        private int[] _cellsY = Array.Empty<int>();
+        private int[] _bucketStarts = new int[1];
+        private int[] _sortedIndices = Array.Empty<int>();
+        private int _bucketMask;
+
+        /// <summary>
+        /// Builds the grid. The arrays are referenced, not copied, and must not change until the next build.
+        /// </summary>
+        internal void Build(float[] positionsX, float[] positionsY, float[] positionsZ, int count)
+        {
+            _positionsX = positionsX;
+            _positionsY = positionsY;
+            _positionsZ = positionsZ;
+            _count = count;
+
+            int bucketCount = 16;
+            while (bucketCount < count)
+            {
+                bucketCount <<= 1;
+            }
+
+            _bucketMask = bucketCount - 1;
+            if (_bucketStarts.Length != bucketCount + 1)
+            {
+                _bucketStarts = new int[bucketCount + 1];
+            }
+            else
+            {
+                Array.Clear(_bucketStarts, 0, _bucketStarts.Length);
+            }
+            if (_cellsX.Length < count)
+            {
+                _cellsX = new int[positionsX.Length];
+                _cellsY = new int[positionsX.Length];
+                _sortedIndices = new int[positionsX.Length];
+            }
+
+            // Count the entities per bucket, offset by one so the prefix sum gives the start of each bucket
+            for (int i = 0; i < count; i++)
+            {
+                int cellX = GetCell(positionsX[i]);
+                int cellY = GetCell(positionsY[i]);
+                _cellsX[i] = cellX;
+                _cellsY[i] = cellY;
+                _bucketStarts[GetBucket(cellX, cellY) + 1]++;
+            }
+
+            for (int i = 1; i <= bucketCount; i++)
+            {
+                _bucketStarts[i] += _bucketStarts[i - 1];
+            }
+
+            // Fill the buckets back to front, using the end of each bucket as the write position
+            for (int i = count - 1; i >= 0; i--)
+            {
+                int bucket = GetBucket(_cellsX[i], _cellsY[i]);
+                int writeIndex = --_bucketStarts[bucket + 1];
+                _sortedIndices[writeIndex] = i;
+            }
+
+            // Each end has been moved down to the start of its bucket, one slot after where the start belongs
+            for (int i = 0; i < bucketCount; i++)
+            {
+                _bucketStarts[i] = _bucketStarts[i + 1];
+            }
+            _bucketStarts[bucketCount] = count;
+        }
+
+        /// <summary>
+        /// Adds the indices of the entities within a sphere to <paramref name="results"/>.
+        /// </summary>
+        internal void QueryRadius(FVector3 center, float radius, List<int> results)
+        {
+            float radiusSquared = radius * radius;
+            ForEachCandidate(center.X - radius, center.Y - radius, center.X + radius, center.Y + radius, results,
+                center, radiusSquared, default, default, false);
+        }
+
+        /// <summary>
+        /// Adds the indices of the entities within an axis-aligned box to <paramref name="results"/>.
+        /// </summary>
+        internal void QueryBox(FVector3 min, FVector3 max, List<int> results)
+        {
+            ForEachCandidate(min.X, min.Y, max.X, max.Y, results, default, 0f, min, max, true);
+        }
+
+        /// <summary>
+        /// Gets the squared distance between an entity and a position.
+        /// </summary>
+        internal float GetDistanceSquared(int index, FVector3 position)
+        {
+            float x = position.X - _positionsX[index];
+            float y = position.Y - _positionsY[index];
+            float z = position.Z - _positionsZ[index];
+            return (x * x) + (y * y) + (z * z);
+        }
+
+        private void ForEachCandidate(float minX, float minY, float maxX, float maxY, List<int> results,
+            FVector3 center, float radiusSquared, FVector3 boxMin, FVector3 boxMax, bool isBox)
+        {
+            int minCellX = GetCell(minX);
+            int minCellY = GetCell(minY);
+            int maxCellX = GetCell(maxX);
+            int maxCellY = GetCell(maxY);
+
+            // Visiting more cells than there are buckets would cost more than checking every entity
+            long cellCount = ((long)maxCellX - minCellX + 1) * ((long)maxCellY - minCellY + 1);
+            if (cellCount <= 0 || cellCount > _bucketMask + 1)
+            {
+                for (int i = 0; i < _count; i++)
+                {
+                    if (Contains(i, center, radiusSquared, boxMin, boxMax, isBox))
+                    {
+                        results.Add(i);
+                    }
+                }
+
+                return;
+            }
+
+            for (int cellY = minCellY; cellY <= maxCellY; cellY++)
+            {
+                for (int cellX = minCellX; cellX <= maxCellX; cellX++)
+                {
+                    int bucket = GetBucket(cellX, cellY);
+                    int end = _bucketStarts[bucket + 1];
+                    for (int j = _bucketStarts[bucket]; j < end; j++)
+                    {
+                        int i = _sortedIndices[j];
+                        // Other cells can share the bucket, so skip their entities to not add any entity twice
+                        if (_cellsX[i] != cellX || _cellsY[i] != cellY)
+                        {
+                            continue;
+                        }
+
+                        if (Contains(i, center, radiusSquared, boxMin, boxMax, isBox))
+                        {
+                            results.Add(i);
+                        }
+                    }
+                }
+            }
+        }
+
+        private bool Contains(int index, FVector3 center, float radiusSquared, FVector3 boxMin, FVector3 boxMax,
+            bool isBox)
+        {
+            if (!isBox)
+            {
+                return GetDistanceSquared(index, center) <= radiusSquared;
+            }
+
+            float x = _positionsX[index];
+            float y = _positionsY[index];
+            float z = _positionsZ[index];
+            return x >= boxMin.X && x <= boxMax.X && y >= boxMin.Y && y <= boxMax.Y && z >= boxMin.Z && z <= boxMax.Z;
+        }
+
+        private static int GetCell(float coordinate)
+        {
+            // Keep the cell index in range for infinite radii and broken positions
+            float cell = coordinate * InverseCellSize;
+            if (!(cell > -1e9f))
+            {
+                return -1000000000;
+            }
+            if (cell > 1e9f)
+            {
+                return 1000000000;
+            }
+
+            return (int)Math.Floor(cell);
+        }
+
+        private int GetBucket(int cellX, int cellY)
+        {
+            return ((cellX * 73856093) ^ (cellY * 19349663)) & _bucketMask;
+        }
+    }
+}
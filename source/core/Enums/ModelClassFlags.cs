@@ -0,0 +1,23 @@
+using System;
+
+namespace SHVDN
+{
+    [Flags]
+    public enum ModelClassFlags : uint
+    {
+        None = 0,
+        Exists = 1 << 0,
+        Object = 1 << 1,
+        Mlo = 1 << 2,
+        Time = 1 << 3,
+        Weapon = 1 << 4,
+        Vehicle = 1 << 5,
+        Ped = 1 << 6,
+        Fragment = 1 << 7,
+        MalePed = 1 << 8,
+        FemalePed = 1 << 9,
+        HumanPed = 1 << 10,
+        AnimalPed = 1 << 11,
+        GangPed = 1 << 12,
+    }
+}
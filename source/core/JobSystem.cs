@@ -0,0 +1,226 @@
+//
+// Copyright (C) 2015 crosire & kagikn & contributors
+// License: https://github.com/scripthookvdotnet/scripthookvdotnet#license
+//
+
+using System;
+using System.Collections.Concurrent;
+using System.Threading;
+
+namespace SHVDN
+{
+    /// <summary>
+    /// A fixed pool of work-stealing worker threads that run <see cref="ScriptJob"/>s, owned by a
+    /// <see cref="ScriptDomain"/>.
+    /// </summary>
+    /// <remarks>
+    /// Jobs started by scripts go to a shared queue. Jobs started from a job go to the local queue of the worker,
+    /// which the worker takes the newest job from while idle workers steal the oldest jobs from it.
+    /// The workers are background threads, so they never keep the game process alive, and they stop when the script
+    /// domain is unloaded.
+    /// </remarks>
+    internal sealed class JobSystem : IDisposable
+    {
+        [ThreadStatic]
+        private static Worker s_currentWorker;
+
+        private readonly Worker[] _workers;
+        private readonly ConcurrentQueue<ScriptJob> _sharedQueue = new();
+        private readonly SemaphoreSlim _jobAvailable = new(0);
+        private readonly CancellationTokenSource _shutdownSource = new();
+
+        internal JobSystem()
+        {
+            // Leave a core for the main thread of the game
+            int workerCount = Math.Max(Environment.ProcessorCount - 1, 1);
+
+            _workers = new Worker[workerCount];
+            for (int i = 0; i < workerCount; i++)
+            {
+                _workers[i] = new Worker(this, i);
+            }
+            foreach (Worker worker in _workers)
+            {
+                worker.Start();
+            }
+        }
+
+        /// <summary>
+        /// Gets the number of worker threads.
+        /// </summary>
+        internal int WorkerCount => _workers.Length;
+
+        /// <summary>
+        /// Queues a job to run in a worker thread.
+        /// </summary>
+        internal void Schedule(ScriptJob job)
+        {
+            if (_shutdownSource.IsCancellationRequested)
+            {
+                throw new ObjectDisposedException(nameof(JobSystem));
+            }
+
+            Worker worker = s_currentWorker;
+            if (worker != null && worker.Owner == this)
+            {
+                worker.LocalQueue.Push(job);
+            }
+            else
+            {
+                _sharedQueue.Enqueue(job);
+            }
+
+            _jobAvailable.Release();
+        }
+
+        /// <summary>
+        /// Stops all the workers. Jobs that haven't started are dropped, and running jobs finish in the background.
+        /// </summary>
+        public void Dispose()
+        {
+            if (_shutdownSource.IsCancellationRequested)
+            {
+                return;
+            }
+
+            _shutdownSource.Cancel();
+        }
+
+        private bool TryTakeJob(Worker worker, out ScriptJob job)
+        {
+            if (worker.LocalQueue.TryPop(out job) || _sharedQueue.TryDequeue(out job))
+            {
+                return true;
+            }
+
+            // Start stealing from the next worker, so thieves don't all hit the same victim
+            for (int i = 1; i < _workers.Length; i++)
+            {
+                Worker victim = _workers[(worker.Index + i) % _workers.Length];
+                if (victim.LocalQueue.TrySteal(out job))
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        private sealed class Worker
+        {
+            private readonly Thread _thread;
+
+            internal Worker(JobSystem owner, int index)
+            {
+                Owner = owner;
+                Index = index;
+                _thread = new Thread(Run)
+                {
+                    Name = "SHVDN Job Worker " + index,
+                    IsBackground = true,
+                };
+            }
+
+            internal JobSystem Owner { get; }
+            internal int Index { get; }
+            internal WorkStealingQueue LocalQueue { get; } = new();
+
+            internal void Start() => _thread.Start();
+
+            private void Run()
+            {
+                s_currentWorker = this;
+                CancellationToken shutdownToken = Owner._shutdownSource.Token;
+
+                try
+                {
+                    while (!shutdownToken.IsCancellationRequested)
+                    {
+                        if (Owner.TryTakeJob(this, out ScriptJob job))
+                        {
+                            job.Execute();
+                            continue;
+                        }
+
+                        // The semaphore is released once per job, so a worker never sleeps while a job is queued.
+                        // It may wake up for a job another worker has taken, in which case it just waits again.
+                        Owner._jobAvailable.Wait(shutdownToken);
+                    }
+                }
+                catch (OperationCanceledException)
+                {
+                    // The script domain is being unloaded
+                }
+            }
+        }
+
+        /// <summary>
+        /// A double-ended queue where the owner worker pushes and pops at the tail and other workers steal from the
+        /// head. Contention only happens when a worker runs out of jobs, so a plain lock is cheap enough here.
+        /// </summary>
+        private sealed class WorkStealingQueue
+        {
+            private readonly object _lock = new();
+            private ScriptJob[] _items = new ScriptJob[32];
+            private int _head;
+            private int _count;
+
+            internal void Push(ScriptJob job)
+            {
+                lock (_lock)
+                {
+                    if (_count == _items.Length)
+                    {
+                        var newItems = new ScriptJob[_items.Length * 2];
+                        for (int i = 0; i < _count; i++)
+                        {
+                            newItems[i] = _items[(_head + i) % _items.Length];
+                        }
+
+                        _items = newItems;
+                        _head = 0;
+                    }
+
+                    _items[(_head + _count) % _items.Length] = job;
+                    _count++;
+                }
+            }
+
+            internal bool TryPop(out ScriptJob job)
+            {
+                lock (_lock)
+                {
+                    if (_count == 0)
+                    {
+                        job = null;
+                        return false;
+                    }
+
+                    _count--;
+                    int index = (_head + _count) % _items.Length;
+                    job = _items[index];
+                    _items[index] = null;
+                    return true;
+                }
+            }
+
+            internal bool TrySteal(out ScriptJob job)
+            {
+                lock (_lock)
+                {
+                    if (_count == 0)
+                    {
+                        job = null;
+                        return false;
+                    }
+
+                    job = _items[_head];
+                    _items[_head] = null;
+                    _head = (_head + 1) % _items.Length;
+                    _count--;
+                    return true;
+                }
+            }
+        }
+    }
+}
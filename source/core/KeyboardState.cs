@@ -0,0 +1,218 @@
+//
+// Copyright (C) 2015 crosire & kagikn & contributors
+// License: https://github.com/scripthookvdotnet/scripthookvdotnet#license
+//
+
+using System;
+using System.Windows.Forms;
+
+namespace SHVDN
+{
+    /// <summary>
+    /// A packed set of keys with a bit per virtual key code, along with the modifier flags
+    /// (<see cref="Keys.Shift"/>, <see cref="Keys.Control"/> and <see cref="Keys.Alt"/>).
+    /// </summary>
+    /// <remarks>
+    /// Used both for the keys that are down and for chords to check against them, so checking a chord of any number of
+    /// keys costs four AND operations and comparisons.
+    /// </remarks>
+    public readonly struct KeyboardState : IEquatable<KeyboardState>
+    {
+        private readonly ulong _bits0;
+        private readonly ulong _bits1;
+        private readonly ulong _bits2;
+        private readonly ulong _bits3;
+        private readonly Keys _modifiers;
+
+        private KeyboardState(ulong bits0, ulong bits1, ulong bits2, ulong bits3, Keys modifiers)
+        {
+            _bits0 = bits0;
+            _bits1 = bits1;
+            _bits2 = bits2;
+            _bits3 = bits3;
+            _modifiers = modifiers;
+        }
+
+        /// <summary>
+        /// Gets the modifier flags in this set.
+        /// </summary>
+        public Keys Modifiers => _modifiers;
+
+        /// <summary>
+        /// Gets whether no key or modifier is in this set.
+        /// </summary>
+        public bool IsEmpty => (_bits0 | _bits1 | _bits2 | _bits3) == 0 && _modifiers == Keys.None;
+
+        /// <summary>
+        /// Creates a chord that is down when all the specified keys are down.
+        /// <see cref="Keys.Shift"/>, <see cref="Keys.Control"/> and <see cref="Keys.Alt"/> are checked against the
+        /// modifier flags, and other keys against their key codes.
+        /// </summary>
+        /// <param name="keys">The keys of the chord.</param>
+        public static KeyboardState FromChord(Keys[] keys)
+        {
+            KeyboardState chord = default;
+            foreach (Keys key in keys)
+            {
+                chord = chord.WithChordKey(key);
+            }
+
+            return chord;
+        }
+        /// <summary>
+        /// Creates a chord of two keys without allocating an array.
+        /// </summary>
+        public static KeyboardState FromChord(Keys key1, Keys key2)
+            => default(KeyboardState).WithChordKey(key1).WithChordKey(key2);
+        /// <summary>
+        /// Creates a chord of three keys without allocating an array.
+        /// </summary>
+        public static KeyboardState FromChord(Keys key1, Keys key2, Keys key3)
+            => default(KeyboardState).WithChordKey(key1).WithChordKey(key2).WithChordKey(key3);
+
+        private KeyboardState WithChordKey(Keys key)
+        {
+            switch (key)
+            {
+                case Keys.Shift:
+                case Keys.Control:
+                case Keys.Alt:
+                    return WithModifiers(_modifiers | key);
+                default:
+                    return WithKey(key, true);
+            }
+        }
+
+        /// <summary>
+        /// Gets whether the specified key code is in this set.
+        /// </summary>
+        /// <param name="key">The key code to check.</param>
+        /// <exception cref="IndexOutOfRangeException"><paramref name="key"/> is greater than 255.</exception>
+        public bool IsDown(Keys key)
+        {
+            int keyCode = (int)key;
+            if ((uint)keyCode > 255)
+            {
+                throw new IndexOutOfRangeException();
+            }
+
+            ulong bits = (keyCode >> 6) switch
+            {
+                0 => _bits0,
+                1 => _bits1,
+                2 => _bits2,
+                _ => _bits3,
+            };
+            return (bits & (1UL << (keyCode & 63))) != 0;
+        }
+
+        /// <summary>
+        /// Gets whether all the keys and modifiers of a chord are in this set, in a single operation.
+        /// </summary>
+        /// <param name="chord">The chord created with <see cref="FromChord(Keys[])"/>.</param>
+        public bool IsChordDown(KeyboardState chord)
+        {
+            // A chord with no keys would always be down otherwise
+            return !chord.IsEmpty
+                && (_bits0 & chord._bits0) == chord._bits0
+                && (_bits1 & chord._bits1) == chord._bits1
+                && (_bits2 & chord._bits2) == chord._bits2
+                && (_bits3 & chord._bits3) == chord._bits3
+                && (_modifiers & chord._modifiers) == chord._modifiers;
+        }
+
+        /// <summary>
+        /// Returns a copy of this set where the key code of the specified key is added or removed.
+        /// </summary>
+        public KeyboardState WithKey(Keys key, bool down)
+        {
+            int keyCode = (int)(key & Keys.KeyCode);
+            ulong mask = 1UL << (keyCode & 63);
+            ulong bits0 = _bits0, bits1 = _bits1, bits2 = _bits2, bits3 = _bits3;
+            switch (keyCode >> 6)
+            {
+                case 0:
+                    bits0 = down ? bits0 | mask : bits0 & ~mask;
+                    break;
+                case 1:
+                    bits1 = down ? bits1 | mask : bits1 & ~mask;
+                    break;
+                case 2:
+                    bits2 = down ? bits2 | mask : bits2 & ~mask;
+                    break;
+                default:
+                    bits3 = down ? bits3 | mask : bits3 & ~mask;
+                    break;
+            }
+
+            return new KeyboardState(bits0, bits1, bits2, bits3, _modifiers);
+        }
+
+        /// <summary>
+        /// Returns a copy of this set with the specified modifier flags.
+        /// </summary>
+        public KeyboardState WithModifiers(Keys modifiers)
+        {
+            return new KeyboardState(_bits0, _bits1, _bits2, _bits3, modifiers & Keys.Modifiers);
+        }
+
+        /// <summary>
+        /// Returns the keys that are in this set but not in another set. The modifier flags are handled the same way.
+        /// </summary>
+        public KeyboardState Except(KeyboardState other)
+        {
+            return new KeyboardState(_bits0 & ~other._bits0, _bits1 & ~other._bits1, _bits2 & ~other._bits2,
+                _bits3 & ~other._bits3, _modifiers & ~other._modifiers);
+        }
+
+        /// <summary>
+        /// Returns the keys that are in this set or another set.
+        /// </summary>
+        public KeyboardState Union(KeyboardState other)
+        {
+            return new KeyboardState(_bits0 | other._bits0, _bits1 | other._bits1, _bits2 | other._bits2,
+                _bits3 | other._bits3, _modifiers | other._modifiers);
+        }
+
+        public bool Equals(KeyboardState other)
+        {
+            return _bits0 == other._bits0 && _bits1 == other._bits1 && _bits2 == other._bits2
+                && _bits3 == other._bits3 && _modifiers == other._modifiers;
+        }
+        public override bool Equals(object obj) => obj is KeyboardState other && Equals(other);
+        public override int GetHashCode()
+        {
+            return (_bits0 ^ _bits1 ^ _bits2 ^ _bits3).GetHashCode() ^ (int)_modifiers;
+        }
+    }
+
+    /// <summary>
+    /// The keyboard state of a frame, published once per tick and shared by all scripts.
+    /// </summary>
+    internal sealed class KeyboardFrameState
+    {
+        internal static readonly KeyboardFrameState Empty = new(default, default, default);
+
+        internal KeyboardFrameState(KeyboardState down, KeyboardState pressed, KeyboardState released)
+        {
+            Down = down;
+            Pressed = pressed;
+            Released = released;
+        }
+
+        /// <summary>
+        /// The keys that are down at the start of the frame.
+        /// </summary>
+        internal KeyboardState Down { get; }
+        /// <summary>
+        /// The keys that went down since the last frame, even if they have been released again.
+        /// </summary>
+        internal KeyboardState Pressed { get; }
+        /// <summary>
+        /// The keys that went up since the last frame.
+        /// </summary>
+        internal KeyboardState Released { get; }
+
+        internal bool HasEdges => !Pressed.IsEmpty || !Released.IsEmpty;
+    }
+}
@@ -0,0 +1,28 @@
+//
+// Copyright (C) 2015 crosire & kagikn & contributors
+// License: https://github.com/scripthookvdotnet/scripthookvdotnet#license
+//
+
+namespace SHVDN
+{
+    /// <summary>
+    /// A memory pattern and its mask, which <see cref="MemScanner"/> searches for.
+    /// </summary>
+    internal readonly struct MemPattern
+    {
+        internal MemPattern(string pattern, string mask)
+        {
+            Pattern = pattern;
+            Mask = mask;
+        }
+
+        /// <summary>
+        /// Gets the pattern.
+        /// </summary>
+        internal string Pattern { get; }
+        /// <summary>
+        /// Gets the pattern mask, where <c>?</c> marks a byte that matches any value.
+        /// </summary>
+        internal string Mask { get; }
+    }
+}
@@ -12,6 +12,12 @@ namespace SHVDN
 {
     public static class MemScanner
     {
+        /// <inheritdoc cref="FindPatternNaive(string, string, IntPtr, ulong)"/>
+        internal static unsafe byte* FindPatternNaive(in MemPattern pattern)
+        {
+            return FindPatternNaive(pattern.Pattern, pattern.Mask);
+        }
+
         /// <inheritdoc cref="FindPatternNaive(string, string, IntPtr, ulong)"/>
         public static unsafe byte* FindPatternNaive(string pattern, string mask)
         {
@@ -43,6 +49,18 @@ namespace SHVDN
         /// <param name="size">The size where the pattern search will be performed from <paramref name="startAddress"/>.</param>
         /// <returns>The address of a region matching the pattern or <see langword="null" /> if none was found.</returns>
         public static unsafe byte* FindPatternNaive(string pattern, string mask, IntPtr startAddress, ulong size)
+        {
+            if (PatternScanCache.TryGet(pattern, mask, startAddress, size, out byte* cachedAddress))
+            {
+                return cachedAddress;
+            }
+
+            byte* result = ScanNaive(pattern, mask, startAddress, size);
+            PatternScanCache.Add(pattern, mask, startAddress, size, result);
+            return result;
+        }
+
+        private static unsafe byte* ScanNaive(string pattern, string mask, IntPtr startAddress, ulong size)
         {
             ulong address = (ulong)startAddress.ToInt64();
             ulong endAddress = address + size;
@@ -68,6 +86,12 @@ namespace SHVDN
             return null;
         }
 
+        /// <inheritdoc cref="FindPatternBmh(string, string, IntPtr, ulong)"/>
+        internal static unsafe byte* FindPatternBmh(in MemPattern pattern)
+        {
+            return FindPatternBmh(pattern.Pattern, pattern.Mask);
+        }
+
         /// <inheritdoc cref="FindPatternBmh(string, string, IntPtr, ulong)"/>
         public static unsafe byte* FindPatternBmh(string pattern, string mask)
         {
@@ -100,6 +124,18 @@ namespace SHVDN
         /// <param name="size">The size where the pattern search will be performed from <paramref name="startAddress"/>.</param>
         /// <returns>The address of a region matching the pattern or <see langword="null" /> if none was found.</returns>
         public static unsafe byte* FindPatternBmh(string pattern, string mask, IntPtr startAddress, ulong size)
+        {
+            if (PatternScanCache.TryGet(pattern, mask, startAddress, size, out byte* cachedAddress))
+            {
+                return cachedAddress;
+            }
+
+            byte* result = ScanBmh(pattern, mask, startAddress, size);
+            PatternScanCache.Add(pattern, mask, startAddress, size, result);
+            return result;
+        }
+
+        private static unsafe byte* ScanBmh(string pattern, string mask, IntPtr startAddress, ulong size)
         {
             // Use short array intentionally to spare heap
             // Warning: throws an exception if length of pattern and mask strings does not match
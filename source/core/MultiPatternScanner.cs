@@ -0,0 +1,338 @@
+//
+// Copyright (C) 2015 crosire & kagikn & contributors
+// License: https://github.com/scripthookvdotnet/scripthookvdotnet#license
+//
+
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Threading.Tasks;
+
+namespace SHVDN
+{
+    /// <summary>
+    /// Searches memory for many patterns in a single pass, instead of a pass per pattern like
+    /// <see cref="MemScanner.FindPatternBmh(string, string)"/>.
+    /// </summary>
+    /// <remarks>
+    /// <para>
+    /// Each pattern is anchored on a pair of adjacent non-wildcard bytes chosen to be rare in x64 code. The scan
+    /// reads every 2 bytes of memory as a 16-bit key, tests it against a bitmap of all the anchors, and only verifies
+    /// the patterns with that anchor when the bit is set, which is rare enough that the scan runs at the speed of
+    /// the bitmap test.
+    /// </para>
+    /// <para>
+    /// The memory is split into chunks scanned in parallel, and the first match of each pattern is taken across the
+    /// chunks, so the results are the same as searching for each pattern separately.
+    /// </para>
+    /// </remarks>
+    public sealed unsafe class MultiPatternScanner
+    {
+        // Chunks smaller than this don't pay for the cost of scheduling them
+        private const ulong MinChunkSize = 1024 * 1024;
+
+        // Rough weights of how common bytes are in x64 code, to avoid anchoring on them
+        private static readonly byte[] s_byteWeights = CreateByteWeights();
+
+        private readonly List<byte[]> _patternBytes = new();
+        private readonly List<byte[]> _patternMasks = new();
+
+        // Built from the patterns on the first scan after a pattern is added
+        private bool _isPrepared;
+        private int[] _anchorOffsets;
+        private ulong[] _anchorBitmap;
+        private int[] _bucketStarts;
+        private int[] _bucketPatterns;
+        private int[] _patternLengths;
+        private int[] _fixedStarts;
+        private int[] _fixedOffsets;
+        private byte[] _fixedValues;
+
+        /// <summary>
+        /// Gets the number of patterns added.
+        /// </summary>
+        public int Count => _patternBytes.Count;
+
+        /// <summary>
+        /// Adds a pattern to search for.
+        /// </summary>
+        /// <param name="pattern">The pattern.</param>
+        /// <param name="mask">The pattern mask, where <c>?</c> marks a byte that matches any value.</param>
+        /// <returns>The index of the result of the pattern in the array <see cref="Scan(IntPtr, ulong)"/> returns.</returns>
+        /// <exception cref="ArgumentException">
+        /// The pattern and the mask have different lengths, or the pattern has no byte that isn't a wildcard.
+        /// </exception>
+        public int Add(string pattern, string mask)
+        {
+            if (pattern == null || mask == null || pattern.Length != mask.Length || mask.IndexOf('x') < 0)
+            {
+                throw new ArgumentException("The pattern must have the same length as the mask and at least one byte that isn't a wildcard.", nameof(pattern));
+            }
+
+            var bytes = new byte[pattern.Length];
+            var masks = new byte[pattern.Length];
+            for (int i = 0; i < bytes.Length; i++)
+            {
+                bytes[i] = (byte)pattern[i];
+                masks[i] = mask[i] != '?' ? (byte)1 : (byte)0;
+            }
+
+            _patternBytes.Add(bytes);
+            _patternMasks.Add(masks);
+            _isPrepared = false;
+            return _patternBytes.Count - 1;
+        }
+
+        /// <summary>
+        /// Searches the main module of the current process for all the patterns.
+        /// </summary>
+        /// <returns>The address of the first match of each pattern, or <see cref="IntPtr.Zero"/> for the ones not found.</returns>
+        public IntPtr[] Scan()
+        {
+            ProcessModule module = Process.GetCurrentProcess().MainModule;
+            return Scan(module.BaseAddress, (ulong)module.ModuleMemorySize);
+        }
+
+        /// <summary>
+        /// Searches the specific address space of the current process for all the patterns.
+        /// </summary>
+        /// <param name="startAddress">The address to start searching at.</param>
+        /// <param name="size">The size where the pattern search will be performed from <paramref name="startAddress"/>.</param>
+        /// <returns>The address of the first match of each pattern, or <see cref="IntPtr.Zero"/> for the ones not found.</returns>
+        public IntPtr[] Scan(IntPtr startAddress, ulong size)
+        {
+            int patternCount = _patternBytes.Count;
+            var results = new IntPtr[patternCount];
+            if (patternCount == 0 || size < 2)
+            {
+                return results;
+            }
+
+            if (!_isPrepared)
+            {
+                Prepare();
+            }
+
+            var regionStart = (byte*)startAddress;
+            byte* regionEnd = regionStart + size;
+
+            ulong chunkCount = Math.Min(Math.Max(size / MinChunkSize, 1), (ulong)Environment.ProcessorCount * 4);
+            ulong chunkSize = (size + chunkCount - 1) / chunkCount;
+            var chunkResults = new long[chunkCount][];
+
+            Parallel.For(0, (int)chunkCount, chunkIndex =>
+            {
+                byte* chunkStart = regionStart + (ulong)chunkIndex * chunkSize;
+                byte* chunkEnd = (ulong)(regionEnd - chunkStart) > chunkSize ? chunkStart + chunkSize : regionEnd;
+                chunkResults[chunkIndex] = ScanChunk(regionStart, regionEnd, chunkStart, chunkEnd);
+            });
+
+            // The chunks are in address order, so the first chunk that found a pattern has its first match
+            for (int i = 0; i < patternCount; i++)
+            {
+                foreach (long[] chunkResult in chunkResults)
+                {
+                    if (chunkResult[i] >= 0)
+                    {
+                        results[i] = new IntPtr(regionStart + chunkResult[i]);
+                        break;
+                    }
+                }
+            }
+
+            return results;
+        }
+
+        /// <summary>
+        /// Finds the first match of each pattern whose anchor is in a chunk. The patterns may extend past the chunk,
+        /// but not past the region.
+        /// </summary>
+        /// <returns>The offset of the first match of each pattern from the start of the region, or -1.</returns>
+        private long[] ScanChunk(byte* regionStart, byte* regionEnd, byte* chunkStart, byte* chunkEnd)
+        {
+            var firstMatches = new long[_patternLengths.Length];
+            for (int i = 0; i < firstMatches.Length; i++)
+            {
+                firstMatches[i] = -1;
+            }
+
+            // The 16-bit key at the last byte of the region would read past it
+            byte* scanEnd = chunkEnd < regionEnd ? chunkEnd : regionEnd - 1;
+
+            fixed (ulong* anchorBitmap = _anchorBitmap)
+            fixed (int* bucketStarts = _bucketStarts)
+            fixed (int* bucketPatterns = _bucketPatterns)
+            {
+                for (byte* address = chunkStart; address < scanEnd; address++)
+                {
+                    int key = address[0] | (address[1] << 8);
+                    if ((anchorBitmap[key >> 6] & (1UL << key)) == 0)
+                    {
+                        continue;
+                    }
+
+                    int end = bucketStarts[key + 1];
+                    for (int j = bucketStarts[key]; j < end; j++)
+                    {
+                        int patternIndex = bucketPatterns[j];
+                        if (firstMatches[patternIndex] >= 0)
+                        {
+                            continue;
+                        }
+
+                        byte* patternStart = address - _anchorOffsets[patternIndex];
+                        if (patternStart < regionStart || patternStart + _patternLengths[patternIndex] > regionEnd
+                            || !Matches(patternIndex, patternStart))
+                        {
+                            continue;
+                        }
+
+                        firstMatches[patternIndex] = patternStart - regionStart;
+                    }
+                }
+            }
+
+            return firstMatches;
+        }
+
+        private bool Matches(int patternIndex, byte* address)
+        {
+            int end = _fixedStarts[patternIndex + 1];
+            for (int i = _fixedStarts[patternIndex]; i < end; i++)
+            {
+                if (address[_fixedOffsets[i]] != _fixedValues[i])
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        private void Prepare()
+        {
+            int patternCount = _patternBytes.Count;
+            _anchorOffsets = new int[patternCount];
+            _patternLengths = new int[patternCount];
+            _fixedStarts = new int[patternCount + 1];
+            var fixedOffsets = new List<int>();
+            var fixedValues = new List<byte>();
+            // A pattern whose anchor has a wildcard second byte is added to the buckets of all 256 keys
+            var anchorKeys = new List<KeyValuePair<int, int>>();
+
+            for (int i = 0; i < patternCount; i++)
+            {
+                byte[] bytes = _patternBytes[i];
+                byte[] masks = _patternMasks[i];
+                _patternLengths[i] = bytes.Length;
+
+                _fixedStarts[i] = fixedOffsets.Count;
+                for (int j = 0; j < bytes.Length; j++)
+                {
+                    if (masks[j] != 0)
+                    {
+                        fixedOffsets.Add(j);
+                        fixedValues.Add(bytes[j]);
+                    }
+                }
+
+                int anchorOffset = ChooseAnchor(bytes, masks);
+                _anchorOffsets[i] = anchorOffset;
+                if (anchorOffset + 1 < bytes.Length && masks[anchorOffset + 1] != 0)
+                {
+                    anchorKeys.Add(new KeyValuePair<int, int>(bytes[anchorOffset] | (bytes[anchorOffset + 1] << 8), i));
+                }
+                else
+                {
+                    for (int secondByte = 0; secondByte < 256; secondByte++)
+                    {
+                        anchorKeys.Add(new KeyValuePair<int, int>(bytes[anchorOffset] | (secondByte << 8), i));
+                    }
+                }
+            }
+            _fixedStarts[patternCount] = fixedOffsets.Count;
+            _fixedOffsets = fixedOffsets.ToArray();
+            _fixedValues = fixedValues.ToArray();
+
+            // Group the patterns by anchor key with a counting sort
+            _anchorBitmap = new ulong[65536 / 64];
+            _bucketStarts = new int[65536 + 1];
+            _bucketPatterns = new int[anchorKeys.Count];
+            foreach (KeyValuePair<int, int> anchorKey in anchorKeys)
+            {
+                _anchorBitmap[anchorKey.Key >> 6] |= 1UL << anchorKey.Key;
+                _bucketStarts[anchorKey.Key + 1]++;
+            }
+            for (int i = 1; i < _bucketStarts.Length; i++)
+            {
+                _bucketStarts[i] += _bucketStarts[i - 1];
+            }
+
+            var writeIndices = new int[65536];
+            Array.Copy(_bucketStarts, writeIndices, writeIndices.Length);
+            foreach (KeyValuePair<int, int> anchorKey in anchorKeys)
+            {
+                _bucketPatterns[writeIndices[anchorKey.Key]++] = anchorKey.Value;
+            }
+
+            _isPrepared = true;
+        }
+
+        private static int ChooseAnchor(byte[] bytes, byte[] masks)
+        {
+            int bestOffset = -1;
+            int bestWeight = int.MaxValue;
+            for (int i = 0; i + 1 < bytes.Length; i++)
+            {
+                if (masks[i] == 0 || masks[i + 1] == 0)
+                {
+                    continue;
+                }
+
+                int weight = s_byteWeights[bytes[i]] + s_byteWeights[bytes[i + 1]];
+                if (weight < bestWeight)
+                {
+                    bestOffset = i;
+                    bestWeight = weight;
+                }
+            }
+
+            if (bestOffset >= 0)
+            {
+                return bestOffset;
+            }
+
+            // No 2 adjacent bytes are fixed, so anchor on the rarest single byte
+            for (int i = 0; i < bytes.Length; i++)
+            {
+                if (masks[i] != 0 && (bestOffset < 0 || s_byteWeights[bytes[i]] < s_byteWeights[bytes[bestOffset]]))
+                {
+                    bestOffset = i;
+                }
+            }
+
+            return bestOffset;
+        }
+
+        private static byte[] CreateByteWeights()
+        {
+            var weights = new byte[256];
+            for (int i = 0; i < weights.Length; i++)
+            {
+                weights[i] = 1;
+            }
+
+            // Padding, REX prefixes, and the most common opcodes and ModRM bytes
+            foreach (byte b in new byte[] { 0x00, 0xFF, 0xCC, 0x48, 0x8B })
+            {
+                weights[b] = 8;
+            }
+            foreach (byte b in new byte[] { 0x89, 0x0F, 0x4C, 0x8D, 0xE8, 0x24, 0x44, 0x49, 0x41, 0x85, 0x84, 0x74, 0x75, 0xC0, 0x33, 0x83, 0x01 })
+            {
+                weights[b] = 4;
+            }
+
+            return weights;
+        }
+    }
+}
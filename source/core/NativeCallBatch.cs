@@ -0,0 +1,200 @@
+//
+// Copyright (C) 2015 crosire & kagikn & contributors
+// License: https://github.com/scripthookvdotnet/scripthookvdotnet#license
+//
+
+using System;
+
+namespace SHVDN
+{
+    /// <summary>
+    /// A list of script function calls that are executed in one go with the TLS context of the main thread.
+    /// </summary>
+    /// <remarks>
+    /// <see cref="NativeFunc.Invoke(ulong, ulong*, int)"/> swaps the TLS context and reads the TLS variables once
+    /// per call when called from a script thread. A batch pays that cost once for all the recorded calls.
+    /// Calls are executed in the order they are added, and arguments that point to pinned strings are only valid
+    /// until the end of the current tick, so execute the batch in the same tick the calls are recorded.
+    /// </remarks>
+    public sealed unsafe class NativeCallBatch : IScriptTask
+    {
+        /// <summary>
+        /// The number of <see cref="ulong"/> values in a result slot. A return value takes 24 bytes at most,
+        /// which is for a vector with 3 components where each component is padded to 8 bytes.
+        /// </summary>
+        public const int ResultSlotSize = 3;
+
+        private ulong[] _hashes;
+        private int[] _argOffsets;
+        private int[] _argCounts;
+        private ulong[] _args;
+        private ulong[] _results;
+        private int _callCount;
+        private int _totalArgCount;
+
+        public NativeCallBatch() : this(16)
+        {
+        }
+        /// <summary>
+        /// Initializes a new instance of the <see cref="NativeCallBatch"/> class that can hold the specified number
+        /// of calls without growing the internal buffers.
+        /// </summary>
+        /// <param name="capacity">The number of calls.</param>
+        public NativeCallBatch(int capacity)
+        {
+            if (capacity < 1)
+            {
+                capacity = 1;
+            }
+
+            _hashes = new ulong[capacity];
+            _argOffsets = new int[capacity];
+            _argCounts = new int[capacity];
+            _args = new ulong[capacity * 4];
+            _results = new ulong[capacity * ResultSlotSize];
+        }
+
+        /// <summary>
+        /// Gets the number of recorded calls.
+        /// </summary>
+        public int Count => _callCount;
+
+        /// <summary>
+        /// Records a script function call.
+        /// </summary>
+        /// <param name="hash">The function hash to call.</param>
+        /// <param name="argPtr">A pointer to the function arguments. The arguments are copied.</param>
+        /// <param name="argCount">The number of arguments in <paramref name="argPtr" />.</param>
+        /// <returns>The index of the call, which can be used to read the result after executing the batch.</returns>
+        public int Add(ulong hash, ulong* argPtr, int argCount)
+        {
+            if (argCount < 0)
+            {
+                throw new ArgumentOutOfRangeException(nameof(argCount));
+            }
+
+            EnsureCallCapacity(_callCount + 1);
+            EnsureArgCapacity(_totalArgCount + argCount);
+
+            int index = _callCount;
+            _hashes[index] = hash;
+            _argOffsets[index] = _totalArgCount;
+            _argCounts[index] = argCount;
+
+            for (int i = 0; i < argCount; i++)
+            {
+                _args[_totalArgCount + i] = argPtr[i];
+            }
+
+            _totalArgCount += argCount;
+            _callCount++;
+
+            return index;
+        }
+        /// <summary>
+        /// Records a script function call.
+        /// </summary>
+        /// <param name="hash">The function hash to call.</param>
+        /// <param name="args">A list of function arguments.</param>
+        /// <returns>The index of the call, which can be used to read the result after executing the batch.</returns>
+        public int Add(ulong hash, params ulong[] args)
+        {
+            fixed (ulong* argPtr = args)
+            {
+                return Add(hash, argPtr, args.Length);
+            }
+        }
+
+        /// <summary>
+        /// Removes all recorded calls and results, but keeps the internal buffers for reuse.
+        /// </summary>
+        public void Clear()
+        {
+            _callCount = 0;
+            _totalArgCount = 0;
+        }
+
+        /// <summary>
+        /// Executes all recorded calls inside the current script domain.
+        /// </summary>
+        public void Execute()
+        {
+            NativeFunc.InvokeBatch(this);
+        }
+
+        /// <summary>
+        /// Gets a reference to the result slot of the call at the specified index, which holds
+        /// <see cref="ResultSlotSize"/> values.
+        /// </summary>
+        /// <param name="index">The index returned by <see cref="Add(ulong, ulong*, int)"/>.</param>
+        public ref ulong GetResultRef(int index)
+        {
+            if ((uint)index >= (uint)_callCount)
+            {
+                ThrowArgumentOutOfRangeException_Index();
+            }
+
+            return ref _results[index * ResultSlotSize];
+        }
+        /// <summary>
+        /// Gets the first 8 bytes of the result of the call at the specified index.
+        /// </summary>
+        /// <param name="index">The index returned by <see cref="Add(ulong, ulong*, int)"/>.</param>
+        public ulong GetResult(int index) => GetResultRef(index);
+
+        void IScriptTask.Run()
+        {
+            fixed (ulong* argsPtr = _args)
+            fixed (ulong* resultsPtr = _results)
+            {
+                for (int i = 0; i < _callCount; i++)
+                {
+                    ulong* res = NativeFunc.InvokeInternal(_hashes[i], argsPtr + _argOffsets[i], _argCounts[i]);
+
+                    // The return value buffer gets overwritten by the next call, so copy the value right away
+                    ulong* resultSlot = resultsPtr + (i * ResultSlotSize);
+                    if (res != null)
+                    {
+                        resultSlot[0] = res[0];
+                        resultSlot[1] = res[1];
+                        resultSlot[2] = res[2];
+                    }
+                    else
+                    {
+                        resultSlot[0] = 0;
+                        resultSlot[1] = 0;
+                        resultSlot[2] = 0;
+                    }
+                }
+            }
+        }
+
+        private void EnsureCallCapacity(int required)
+        {
+            if (required <= _hashes.Length)
+            {
+                return;
+            }
+
+            int newCapacity = Math.Max(required, _hashes.Length * 2);
+            Array.Resize(ref _hashes, newCapacity);
+            Array.Resize(ref _argOffsets, newCapacity);
+            Array.Resize(ref _argCounts, newCapacity);
+            Array.Resize(ref _results, newCapacity * ResultSlotSize);
+        }
+        private void EnsureArgCapacity(int required)
+        {
+            if (required <= _args.Length)
+            {
+                return;
+            }
+
+            Array.Resize(ref _args, Math.Max(required, _args.Length * 2));
+        }
+
+        private static void ThrowArgumentOutOfRangeException_Index()
+        {
+            throw new ArgumentOutOfRangeException("index");
+        }
+    }
+}
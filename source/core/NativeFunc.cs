@@ -4,6 +4,7 @@
 //
 
 using System;
+using System.Diagnostics;
 using System.Runtime.InteropServices;
 using System.Security;
 using System.Text;
@@ -41,10 +42,27 @@ namespace SHVDN
         private static extern ulong* NativeCall();
         #endregion
 
+        /// <summary>
+        /// The function that performs the whole init/push/call sequence of a script function call in native code.
+        /// Set once per script domain before any script starts.
+        /// </summary>
+        private static delegate* unmanaged[Cdecl]<ulong, ulong*, int, ulong*> s_invokeNative;
+
+        /// <summary>
+        /// Sets the native function that executes a script function call with a hash, an argument pointer and
+        /// an argument count in one managed-to-unmanaged transition.
+        /// </summary>
+        /// <param name="invokeNativeFunc">The address of the native function.</param>
+        internal static void InitNativeInvoker(IntPtr invokeNativeFunc)
+        {
+            s_invokeNative = (delegate* unmanaged[Cdecl]<ulong, ulong*, int, ulong*>)invokeNativeFunc;
+        }
+
         /// <summary>
         /// Internal script task which holds all data necessary for a script function call.
+        /// This is a struct and is passed by reference, so a native call does not allocate anything.
         /// </summary>
-        private class NativeTask : IScriptTask
+        private struct NativeTask : IScriptTask
         {
             internal ulong _hash;
             internal ulong[] _arguments;
@@ -58,8 +76,9 @@ namespace SHVDN
 
         /// <summary>
         /// Internal script task which holds all data necessary for a script function call.
+        /// This is a struct and is passed by reference, so a native call does not allocate anything.
         /// </summary>
-        private class NativeTaskPtrArgs : IScriptTask
+        private struct NativeTaskPtrArgs : IScriptTask
         {
             internal ulong _hash;
             internal ulong* _argumentPtr;
@@ -85,15 +104,32 @@ namespace SHVDN
                 return;
             }
 
-            IntPtr strUtf8 = domain.PinString(str);
+            PushString(domain, domain.PinString(str));
+        }
+        /// <summary>
+        /// Pushes a part of a string as a single string component on the text stack, without creating a substring.
+        /// </summary>
+        private static void PushString(string str, int startIndex, int length)
+        {
+            ScriptDomain domain = SHVDN.ScriptDomain.CurrentDomain;
+            if (domain == null)
+            {
+                ThrowInvalidOperationException_IllegalScriptingCall();
+                return;
+            }
 
+            PushString(domain, domain.PinString(str, startIndex, length));
+        }
+        private static void PushString(ScriptDomain domain, IntPtr strUtf8)
+        {
             ulong strArg = (ulong)strUtf8.ToInt64();
-            domain.ExecuteTaskWithGameThreadTlsContext(new NativeTaskPtrArgs
+            var task = new NativeTaskPtrArgs
             {
                 _hash = 0x6C188BE134E074AA /* ADD_TEXT_COMPONENT_SUBSTRING_PLAYER_NAME */,
                 _argumentPtr = &strArg,
                 _argumentCount = 1
-            });
+            };
+            domain.ExecuteTaskWithGameThreadTlsContext(ref task);
         }
 
         /// <summary>
@@ -104,7 +140,20 @@ namespace SHVDN
         /// <param name="maxLengthUtf8">The max byte length per chunk in UTF-8.</param>
         public static void PushLongString(string str, int maxLengthUtf8 = 99)
         {
-            PushLongString(str, PushString, maxLengthUtf8);
+            if (str == null || Encoding.UTF8.GetByteCount(str) <= maxLengthUtf8)
+            {
+                PushString(str);
+                return;
+            }
+
+            // The components are encoded straight from the parts of the string, so no substring is created
+            int startIndex = 0;
+            while (startIndex < str.Length)
+            {
+                int length = GetComponentLength(str, startIndex, maxLengthUtf8);
+                PushString(str, startIndex, length);
+                startIndex += length;
+            }
         }
         /// <summary>
         /// Splits up a string into manageable components and performs an <paramref name="action"/> on them.
@@ -120,16 +169,31 @@ namespace SHVDN
                 return;
             }
 
-            int startPos = 0;
-            int currentPos = 0;
+            int startIndex = 0;
+            while (startIndex < str.Length)
+            {
+                int length = GetComponentLength(str, startIndex, maxLengthUtf8);
+                action(str.Substring(startIndex, length));
+                startIndex += length;
+            }
+        }
+
+        /// <summary>
+        /// Gets the number of chars from <paramref name="startIndex"/> that fit in a component of
+        /// <paramref name="maxLengthUtf8"/> bytes in UTF-8, without splitting a surrogate pair. A component always
+        /// takes at least one code point, so a too small max length can't stall the split.
+        /// </summary>
+        private static int GetComponentLength(string str, int startIndex, int maxLengthUtf8)
+        {
+            int currentPos = startIndex;
             int currentUtf8StrLength = 0;
 
             while (currentPos < str.Length)
             {
-                int codePointSize = 0;
-
                 // Calculate the UTF-8 code point size of the current character
                 char chr = str[currentPos];
+                int charCount = 1;
+                int codePointSize;
                 if (chr < 0x80)
                 {
                     codePointSize = 1;
@@ -138,61 +202,26 @@ namespace SHVDN
                 {
                     codePointSize = 2;
                 }
-                else if (chr < 0x10000)
+                else if (char.IsHighSurrogate(chr) && currentPos + 1 < str.Length && char.IsLowSurrogate(str[currentPos + 1]))
                 {
-                    codePointSize = 3;
+                    codePointSize = 4;
+                    charCount = 2;
                 }
                 else
                 {
-                    #region Surrogate check
-                    const int lowSurrogateStart = 0xD800;
-                    const int highSurrogateStart = 0xD800;
-
-                    int temp1 = (int)chr - highSurrogateStart;
-                    if (temp1 >= 0 && temp1 <= 0x7ff)
-                    {
-                        // Found a high surrogate
-                        if (currentPos < str.Length - 1)
-                        {
-                            int temp2 = str[currentPos + 1] - lowSurrogateStart;
-                            if (temp2 >= 0 && temp2 <= 0x3ff)
-                            {
-                                // Found a low surrogate
-                                codePointSize = 4;
-                            }
-                        }
-                    }
-                    #endregion
+                    codePointSize = 3;
                 }
 
-                if (currentUtf8StrLength + codePointSize > maxLengthUtf8)
+                if (currentUtf8StrLength + codePointSize > maxLengthUtf8 && currentPos > startIndex)
                 {
-                    action(str.Substring(startPos, currentPos - startPos));
-
-                    startPos = currentPos;
-                    currentUtf8StrLength = 0;
-                }
-                else
-                {
-                    currentPos++;
-                    currentUtf8StrLength += codePointSize;
+                    break;
                 }
 
-                // Additional increment is needed for surrogate
-                if (codePointSize == 4)
-                {
-                    currentPos++;
-                }
+                currentPos += charCount;
+                currentUtf8StrLength += codePointSize;
             }
 
-            if (startPos == 0)
-            {
-                action(str);
-            }
-            else
-            {
-                action(str.Substring(startPos, str.Length - startPos));
-            }
+            return currentPos - startIndex;
         }
 
         /// <summary>
@@ -253,7 +282,7 @@ namespace SHVDN
             }
 
             var task = new NativeTaskPtrArgs { _hash = hash, _argumentPtr = argPtr, _argumentCount = argCount };
-            domain.ExecuteTaskWithGameThreadTlsContext(task);
+            domain.ExecuteTaskWithGameThreadTlsContext(ref task);
 
             return task._result;
         }
@@ -274,7 +303,7 @@ namespace SHVDN
             }
 
             var task = new NativeTaskPtrArgs { _hash = hash, _argumentPtr = argPtr, _argumentCount = argCount };
-            domain.ExecuteTaskWithGameThreadTlsContext(task, true);
+            domain.ExecuteTaskWithGameThreadTlsContext(ref task, true);
 
             return task._result;
         }
@@ -294,7 +323,7 @@ namespace SHVDN
             }
 
             var task = new NativeTask { _hash = hash, _arguments = args };
-            domain.ExecuteTaskWithGameThreadTlsContext(task);
+            domain.ExecuteTaskWithGameThreadTlsContext(ref task);
 
             return task._result;
         }
@@ -302,6 +331,27 @@ namespace SHVDN
         {
             return Invoke(hash, ConvertPrimitiveArguments(args));
         }
+        /// <summary>
+        /// Executes all the calls recorded in a <see cref="NativeCallBatch"/> inside the current script domain with
+        /// one TLS context switch.
+        /// </summary>
+        /// <param name="batch">The batch to execute.</param>
+        public static void InvokeBatch(NativeCallBatch batch)
+        {
+            if (batch == null)
+            {
+                throw new ArgumentNullException(nameof(batch));
+            }
+
+            ScriptDomain domain = ScriptDomain.CurrentDomain;
+            if (domain == null)
+            {
+                ThrowInvalidOperationException_IllegalScriptingCall();
+                return;
+            }
+
+            domain.ExecuteTaskWithGameThreadTlsContext(batch);
+        }
 
         private static void ThrowInvalidOperationException_IllegalScriptingCall()
         {
@@ -317,6 +367,41 @@ namespace SHVDN
         /// <returns>A pointer to the return value of the call.</returns>
         public static ulong* InvokeInternal(ulong hash, ulong* argPtr, int argCount)
         {
+            Script executingScript = ScriptDomain.ExecutingScript;
+            if (executingScript != null)
+            {
+                executingScript.NativeCallCount++;
+            }
+
+            if (!NativeProfiler.IsRecording && !TimelineTracer.IsRecording)
+            {
+                return InvokeInternalWithoutProfiling(hash, argPtr, argCount);
+            }
+
+            long startTimestamp = Stopwatch.GetTimestamp();
+            ulong* result = InvokeInternalWithoutProfiling(hash, argPtr, argCount);
+            long elapsedTicks = Stopwatch.GetTimestamp() - startTimestamp;
+
+            if (NativeProfiler.IsRecording)
+            {
+                NativeProfiler.Record(hash, elapsedTicks);
+            }
+            if (TimelineTracer.IsRecording)
+            {
+                TimelineTracer.AddNativeCallEvent(hash, startTimestamp, elapsedTicks);
+            }
+
+            return result;
+        }
+        private static ulong* InvokeInternalWithoutProfiling(ulong hash, ulong* argPtr, int argCount)
+        {
+            delegate* unmanaged[Cdecl]<ulong, ulong*, int, ulong*> invokeNative = s_invokeNative;
+            if (invokeNative != null)
+            {
+                return invokeNative(hash, argPtr, argCount);
+            }
+
+            // Fall back to pushing arguments one by one if the native invoker is not set yet
             NativeInit(hash);
             for (int i = 0; i < argCount; i++)
             {
@@ -333,13 +418,10 @@ namespace SHVDN
         /// <returns>A pointer to the return value of the call.</returns>
         public static ulong* InvokeInternal(ulong hash, params ulong[] args)
         {
-            NativeInit(hash);
-            foreach (ulong arg in args)
+            fixed (ulong* argPtr = args)
             {
-                NativePush64(arg);
+                return InvokeInternal(hash, argPtr, args.Length);
             }
-
-            return NativeCall();
         }
         public static ulong* InvokeInternal(ulong hash, params object[] args)
         {
@@ -68,6 +68,20 @@ namespace SHVDN
         public static extern IntPtr GetGlobalPtr(int index);
         #endregion
 
+        /// <summary>
+        /// Gets a number that changes at the start of every tick, so the scripting APIs can tell when the addresses
+        /// they cached in an earlier tick, such as the addresses of global variables, have to be resolved again.
+        /// </summary>
+        public static uint TickStamp { get; private set; }
+
+        /// <summary>
+        /// Changes <see cref="TickStamp"/>. Should be called at the start of every tick.
+        /// </summary>
+        internal static void AdvanceTickStamp()
+        {
+            TickStamp++;
+        }
+
         /// <summary>
         /// Disposes unmanaged resources.
         /// </summary>
@@ -95,763 +109,780 @@ namespace SHVDN
                 Process.GetCurrentProcess().MainModule.FileName).FileVersion
                 );
 
-            byte* address;
-            IntPtr startAddressToSearch;
+            // Most of the scans below find the same addresses every time for the same game executable
+            PatternScanCache.Open(GameFileVersion);
 
-            // Get relative address and add it to the instruction address.
-
-            address = MemScanner.FindPatternBmh("\x74\x27\x48\x8D\x7E\x18\x48\x8B\x0F\x48\x3B\xCB\x74\x1B", "xxxxxxxxxxxxxx");
-            if (address != null)
+            try
             {
-                // Fetch the address of `AddKnownRef` first, as the offset is at like plus 0xA5 in any builds,
-                // while that of `RemoveKnownRef` is at like plus 0x18EB4.
-                s_fwRefAwareBaseImpl__AddKnownRef = (delegate* unmanaged[Stdcall]<IntPtr, IntPtr, void>)(new IntPtr(
-                    *(int*)(address + 0x25) + address + 0x29));
-                s_fwRefAwareBaseImpl__RemoveKnownRef = (delegate* unmanaged[Stdcall]<IntPtr, IntPtr, void>)(new IntPtr(
-                    *(int*)(address + 0x17) + address + 0x1B));
-            }
+                byte* address;
+                IntPtr startAddressToSearch;
 
-            address = MemScanner.FindPatternBmh("\x74\x21\x48\x8B\x48\x20\x48\x85\xC9\x74\x18\x48\x8B\xD6\xE8", "xxxxxxxxxxxxxxx");
-            if (address != null)
-            {
-                s_getPtfxAddressFunc = (delegate* unmanaged[Stdcall]<int, ulong>)(
-                    new IntPtr(*(int*)(address - 10) + address - 6));
-            }
+                // Get relative address and add it to the instruction address.
 
-            address = MemScanner.FindPatternBmh("\x85\xED\x74\x0F\x8B\xCD\xE8\x00\x00\x00\x00\x48\x8B\xF8\x48\x85\xC0\x74\x2E", "xxxxxxx????xxxxxxxx");
-            if (address != null)
-            {
-                s_getScriptEntity = (delegate* unmanaged[Stdcall]<int, ulong>)(
-                    new IntPtr(*(int*)(address + 7) + address + 11));
-            }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.FwRefAwareBaseImplAddKnownRef);
+                if (address != null)
+                {
+                    // Fetch the address of `AddKnownRef` first, as the offset is at like plus 0xA5 in any builds,
+                    // while that of `RemoveKnownRef` is at like plus 0x18EB4.
+                    s_fwRefAwareBaseImpl__AddKnownRef = (delegate* unmanaged[Stdcall]<IntPtr, IntPtr, void>)(new IntPtr(
+                        *(int*)(address + 0x25) + address + 0x29));
+                    s_fwRefAwareBaseImpl__RemoveKnownRef = (delegate* unmanaged[Stdcall]<IntPtr, IntPtr, void>)(new IntPtr(
+                        *(int*)(address + 0x17) + address + 0x1B));
+                }
 
-            address = MemScanner.FindPatternBmh("\x8B\xC2\xB2\x01\x8B\xC8\xE8\x00\x00\x00\x00\x48\x85\xC0\x74\x53\x8A\x88\x00\x00\x00\x00\xF6\xC1\x01\x75\x05\xF6\xC1\x02\x75\x43\x48", "xxxxxxx????xxxxxxx????xxxxxxxxxxx");
-            if (address != null)
-            {
-                s_getPlayerPedAddressFunc = (delegate* unmanaged[Stdcall]<int, ulong>)(
-                new IntPtr(*(int*)(address + 7) + address + 11));
-            }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.GetPtfxAddressFunc);
+                if (address != null)
+                {
+                    s_getPtfxAddressFunc = (delegate* unmanaged[Stdcall]<int, ulong>)(
+                        new IntPtr(*(int*)(address - 10) + address - 6));
+                }
 
-            address = MemScanner.FindPatternBmh("\x0F\x84\xA1\x00\x00\x00\x33\xC9\x48\x89\x35", "xxxxxxxxxxx");
-            if (address != null)
-            {
-                s_isGameMultiplayerAddr = (bool*)(*(int*)(address + 0x27) + address + 0x2B);
-            }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.GetScriptEntity);
+                if (address != null)
+                {
+                    s_getScriptEntity = (delegate* unmanaged[Stdcall]<int, ulong>)(
+                        new IntPtr(*(int*)(address + 7) + address + 11));
+                }
 
-            address = MemScanner.FindPatternBmh("\x48\xF7\xF9\x49\x8B\x48\x08\x48\x63\xD0\xC1\xE0\x08\x0F\xB6\x1C\x11\x03\xD8", "xxxxxxxxxxxxxxxxxxx");
-            if (address != null)
-            {
-                s_createGuid = (delegate* unmanaged[Stdcall]<ulong, int>)(
-                    new IntPtr(address - 0x68));
-            }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.GetPlayerPedAddressFunc);
+                if (address != null)
+                {
+                    s_getPlayerPedAddressFunc = (delegate* unmanaged[Stdcall]<int, ulong>)(
+                    new IntPtr(*(int*)(address + 7) + address + 11));
+                }
 
-            address = MemScanner.FindPatternBmh("\x40\x53\x48\x83\xEC\x30\x48\x8B\xDA\xE8\x00\x00\x00\x00\xF3\x0F\x10\x44\x24\x2C\x33\xC9\xF3\x0F\x11\x43\x0C\x48\x89\x0B\x89\x4B\x08\x48\x85\xC0\x74\x2C", "xxxxxxxxxx????xxxxxxxxxxxxxxxxxxxxxxxx");
-            if (address != null)
-            {
-                s_entityPosFunc = (delegate* unmanaged[Stdcall]<ulong, float*, ulong>)(address);
-            }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.IsGameMultiplayerAddr);
+                if (address != null)
+                {
+                    s_isGameMultiplayerAddr = (bool*)(*(int*)(address + 0x27) + address + 0x2B);
+                }
 
-            // Find handling data functions
-            address = MemScanner.FindPatternBmh("\x8B\xF7\x83\xF8\x01\x77\x08\x44\x8B\xF7\x8D\x77\xFF\xEB\x06\x41\xBE\x03\x00\x00\x00\x8B\x8B", "xxxxxxxxxxxxxxxxxxxxxxx");
-            if (address != null)
-            {
-                s_getHandlingDataByIndex = (delegate* unmanaged[Stdcall]<int, ulong>)(new IntPtr(*(int*)(address + 28) + address + 32));
-                s_handlingIndexOffsetInModelInfo = *(int*)(address + 23);
-            }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.CreateGuid);
+                if (address != null)
+                {
+                    s_createGuid = (delegate* unmanaged[Stdcall]<ulong, int>)(
+                        new IntPtr(address - 0x68));
+                }
 
-            address = MemScanner.FindPatternBmh("\x75\x5A\xB2\x01\x48\x8B\xCB\xE8\x00\x00\x00\x00\x41\x8B\xF5\x66\x44\x3B\xAB", "xxxxxxxx????xxxxxxx");
-            if (address != null)
-            {
-                s_getHandlingDataByHash = (delegate* unmanaged[Stdcall]<IntPtr, ulong>)(
-                    new IntPtr(*(int*)(address - 7) + address - 3));
-            }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.EntityPosFunc);
+                if (address != null)
+                {
+                    s_entityPosFunc = (delegate* unmanaged[Stdcall]<ulong, float*, ulong>)(address);
+                }
 
-            // Find entity pools and interior proxy pool
-            address = MemScanner.FindPatternBmh("\x48\x8B\x05\x00\x00\x00\x00\x41\x0F\xBF\xC8\x0F\xBF\x40\x10", "xxx????xxxxxxxx");
-            if (address != null)
-            {
-                s_pedPoolAddress = (ulong*)(*(int*)(address + 3) + address + 7);
-            }
+                // Find handling data functions
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.GetHandlingDataByIndex);
+                if (address != null)
+                {
+                    s_getHandlingDataByIndex = (delegate* unmanaged[Stdcall]<int, ulong>)(new IntPtr(*(int*)(address + 28) + address + 32));
+                    s_handlingIndexOffsetInModelInfo = *(int*)(address + 23);
+                }
 
-            address = MemScanner.FindPatternBmh("\x48\x8B\x05\x00\x00\x00\x00\x8B\x78\x10\x85\xFF", "xxx????xxxxx");
-            if (address != null)
-            {
-                s_objectPoolAddress = (ulong*)(*(int*)(address + 3) + address + 7);
-            }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.GetHandlingDataByHash);
+                if (address != null)
+                {
+                    s_getHandlingDataByHash = (delegate* unmanaged[Stdcall]<IntPtr, ulong>)(
+                        new IntPtr(*(int*)(address - 7) + address - 3));
+                }
 
-            if (GameFileVersion >= new Version(1, 0, 3788, 0))
-            {
-                address = MemScanner.FindPatternBmh("\x4C\x8B\x05\x00\x00\x00\x00\x41\x3B\x50\x00\x7D\x00\x49\x8B\x40", "xxx????xxx?x?xxx");
-            }
-            else
-            {
-                address = MemScanner.FindPatternBmh("\x4C\x8B\x0D\x00\x00\x00\x00\x44\x8B\xC1\x49\x8B\x41\x08", "xxx????xxxxxxx");
-            }
-            if (address != null)
-            {
-                s_fwScriptGuidPoolAddress = (ulong*)(*(int*)(address + 3) + address + 7);
-            }
+                // Find entity pools and interior proxy pool
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.PedPoolAddress);
+                if (address != null)
+                {
+                    s_pedPoolAddress = (ulong*)(*(int*)(address + 3) + address + 7);
+                }
 
-            address = MemScanner.FindPatternBmh("\x48\x8B\x05\x00\x00\x00\x00\xF3\x0F\x59\xF6\x48\x8B\x08", "xxx????xxxxxxx");
-            if (address != null)
-            {
-                s_vehiclePoolAddress = (ulong*)(*(int*)(address + 3) + address + 7);
-            }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.ObjectPoolAddress);
+                if (address != null)
+                {
+                    s_objectPoolAddress = (ulong*)(*(int*)(address + 3) + address + 7);
+                }
 
-            address = MemScanner.FindPatternBmh("\x4C\x8B\x05\x00\x00\x00\x00\x40\x8A\xF2\x8B\xE9", "xxx????xxxxx");
-            if (address != null)
-            {
-                s_pickupObjectPoolAddress = (ulong*)(*(int*)(address + 3) + address + 7);
-            }
+                if (GameFileVersion >= new Version(1, 0, 3788, 0))
+                {
+                    address = MemScanner.FindPatternBmh(NativeMemoryPatterns.FwScriptGuidPoolAddressSince3788);
+                }
+                else
+                {
+                    address = MemScanner.FindPatternBmh(NativeMemoryPatterns.FwScriptGuidPoolAddress);
+                }
+                if (address != null)
+                {
+                    s_fwScriptGuidPoolAddress = (ulong*)(*(int*)(address + 3) + address + 7);
+                }
 
-            address = MemScanner.FindPatternBmh("\x83\x38\xFF\x74\x27\xD1\xEA\xF6\xC2\x01\x74\x20", "xxxxxxxxxxxx");
-            if (address != null)
-            {
-                s_buildingPoolAddress = (ulong*)(*(int*)(address + 47) + address + 51);
-                s_animatedBuildingPoolAddress = (ulong*)(*(int*)(address + 15) + address + 19);
-            }
-            address = MemScanner.FindPatternBmh("\x83\xBB\x80\x01\x00\x00\x01\x75\x12", "xxxxxxxxx");
-            if (address != null)
-            {
-                s_interiorInstPoolAddress = (ulong*)(*(int*)(address + 23) + address + 27);
-            }
-            address = MemScanner.FindPatternBmh("\x48\x8B\x0D\x00\x00\x00\x00\xE8\x00\x00\x00\x00\x66\x89\x03", "xxx????x????xxx");
-            if (address != null)
-            {
-                s_interiorProxyPoolAddress = (ulong*)(*(int*)(address + 3) + address + 7);
-            }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.VehiclePoolAddress);
+                if (address != null)
+                {
+                    s_vehiclePoolAddress = (ulong*)(*(int*)(address + 3) + address + 7);
+                }
 
-            address = MemScanner.FindPatternBmh("\x0F\x84\x87\x00\x00\x00\xFF\xC9\x74\x79\xFF\xC9\x74\x6B\x66\x0F\x6E\x35", "xxxxxxxxxxxxxxxxxx");
-            if (address != null)
-            {
-                s_uiWidthAddr = (int*)(*(int*)(address + 0x12) + address + 0x16);
-                s_uiHeightAddr = (int*)(*(int*)(address + 0x1A) + address + 0x1E);
-                s_grcDeviceAddr = new IntPtr((long*)(*(int*)(address + 0x2B) + address + 0x2F));
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.PickupObjectPoolAddress);
+                if (address != null)
+                {
+                    s_pickupObjectPoolAddress = (ulong*)(*(int*)(address + 3) + address + 7);
+                }
 
-                s_updateMonitorConfigurationFunc = (delegate* unmanaged[Stdcall]<IntPtr, IntPtr>)((long*)(*(int*)(address + 0x30) + address + 0x34));
-                s_isMultiheadFunc = (delegate* unmanaged[Stdcall]<IntPtr, bool>)((long*)(*(int*)(address + 0x38) + address + 0x3C));
-                s_getLandscapeMonitorFunc = (delegate* unmanaged[Stdcall]<IntPtr, GridMonitor*>)((long*)(*(int*)(address + 0x50) + address + 0x54));
-            }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.BuildingPoolAddress);
+                if (address != null)
+                {
+                    s_buildingPoolAddress = (ulong*)(*(int*)(address + 47) + address + 51);
+                    s_animatedBuildingPoolAddress = (ulong*)(*(int*)(address + 15) + address + 19);
+                }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.InteriorInstPoolAddress);
+                if (address != null)
+                {
+                    s_interiorInstPoolAddress = (ulong*)(*(int*)(address + 23) + address + 27);
+                }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.InteriorProxyPoolAddress);
+                if (address != null)
+                {
+                    s_interiorProxyPoolAddress = (ulong*)(*(int*)(address + 3) + address + 7);
+                }
 
-            // Find euphoria functions
-            address = MemScanner.FindPatternBmh("\x40\x53\x48\x83\xEC\x20\x83\x61\x0C\x00\x44\x89\x41\x08\x49\x63\xC0", "xxxxxxxxxxxxxxxxx");
-            if (address != null)
-            {
-                s_initMessageMemoryFunc = (delegate* unmanaged[Stdcall]<ulong, ulong, int, ulong>)(new IntPtr(address));
-            }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.UiSizeAndGrcDeviceAddress);
+                if (address != null)
+                {
+                    s_uiWidthAddr = (int*)(*(int*)(address + 0x12) + address + 0x16);
+                    s_uiHeightAddr = (int*)(*(int*)(address + 0x1A) + address + 0x1E);
+                    s_grcDeviceAddr = new IntPtr((long*)(*(int*)(address + 0x2B) + address + 0x2F));
 
-            address = MemScanner.FindPatternBmh("\x0F\x84\x8B\x00\x00\x00\x48\x8B\x47\x30\x48\x8B\x48\x10\x48\x8B\x51\x20\x80\x7A\x10\x0A", "xxxxxxxxxxxxxxxxxxxxxx");
-            if (address != null)
-            {
-                s_sendNmMessageToPedFunc = (delegate* unmanaged[Stdcall]<ulong, IntPtr, ulong, void>)((ulong*)(*(int*)(address - 0x1E) + address - 0x1A));
-            }
+                    s_updateMonitorConfigurationFunc = (delegate* unmanaged[Stdcall]<IntPtr, IntPtr>)((long*)(*(int*)(address + 0x30) + address + 0x34));
+                    s_isMultiheadFunc = (delegate* unmanaged[Stdcall]<IntPtr, bool>)((long*)(*(int*)(address + 0x38) + address + 0x3C));
+                    s_getLandscapeMonitorFunc = (delegate* unmanaged[Stdcall]<IntPtr, GridMonitor*>)((long*)(*(int*)(address + 0x50) + address + 0x54));
+                }
 
-            address = MemScanner.FindPatternBmh("\x48\x89\x5C\x24\x00\x57\x48\x83\xEC\x20\x48\x8B\xD9\x48\x63\x49\x0C\x41\x8B\xF8", "xxxx?xxxxxxxxxxxxxxx");
-            if (address != null)
-            {
-                s_setNmParameterInt = (delegate* unmanaged[Stdcall]<ulong, IntPtr, int, byte>)(new IntPtr(address));
-            }
+                // Find euphoria functions
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.InitMessageMemoryFunc);
+                if (address != null)
+                {
+                    s_initMessageMemoryFunc = (delegate* unmanaged[Stdcall]<ulong, ulong, int, ulong>)(new IntPtr(address));
+                }
 
-            address = MemScanner.FindPatternBmh("\x48\x89\x5C\x24\x00\x57\x48\x83\xEC\x20\x48\x8B\xD9\x48\x63\x49\x0C\x41\x8A\xF8", "xxxx?xxxxxxxxxxxxxxx");
-            if (address != null)
-            {
-                s_setNmParameterBool = (delegate* unmanaged[Stdcall]<ulong, IntPtr, bool, byte>)(new IntPtr(address));
-            }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.SendNmMessageToPedFunc);
+                if (address != null)
+                {
+                    s_sendNmMessageToPedFunc = (delegate* unmanaged[Stdcall]<ulong, IntPtr, ulong, void>)((ulong*)(*(int*)(address - 0x1E) + address - 0x1A));
+                }
 
-            address = MemScanner.FindPatternBmh("\x40\x53\x48\x83\xEC\x30\x48\x8B\xD9\x48\x63\x49\x0C", "xxxxxxxxxxxxx");
-            if (address != null)
-            {
-                s_setNmParameterFloat = (delegate* unmanaged[Stdcall]<ulong, IntPtr, float, byte>)(new IntPtr(address));
-            }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.SetNmParameterInt);
+                if (address != null)
+                {
+                    s_setNmParameterInt = (delegate* unmanaged[Stdcall]<ulong, IntPtr, int, byte>)(new IntPtr(address));
+                }
 
-            address = MemScanner.FindPatternBmh("\x57\x48\x83\xEC\x20\x48\x8B\xD9\x48\x63\x49\x0C\x49\x8B\xE8", "xxxxxxxxxxxxxxx");
-            if (address != null)
-            {
-                s_setNmParameterString = (delegate* unmanaged[Stdcall]<ulong, IntPtr, IntPtr, byte>)(new IntPtr(address - 15));
-            }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.SetNmParameterBool);
+                if (address != null)
+                {
+                    s_setNmParameterBool = (delegate* unmanaged[Stdcall]<ulong, IntPtr, bool, byte>)(new IntPtr(address));
+                }
 
-            address = MemScanner.FindPatternBmh("\x40\x53\x48\x83\xEC\x40\x48\x8B\xD9\x48\x63\x49\x0C", "xxxxxxxxxxxxx");
-            if (address != null)
-            {
-                s_setNmParameterVector = (delegate* unmanaged[Stdcall]<ulong, IntPtr, float, float, float, byte>)(new IntPtr(address));
-            }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.SetNmParameterFloat);
+                if (address != null)
+                {
+                    s_setNmParameterFloat = (delegate* unmanaged[Stdcall]<ulong, IntPtr, float, byte>)(new IntPtr(address));
+                }
 
-            address = MemScanner.FindPatternBmh("\x4D\x8B\xF0\x48\x8B\xF2\xE8\x00\x00\x00\x00\x33\xFF\x48\x85\xC0\x75\x07\x32\xC0\xE9\xD8\x03\x00\x00", "xxxxxxx????xxxxxxxxxxxxxx");
-            if (address != null)
-            {
-                s_getActiveTaskFunc = (delegate* unmanaged[Stdcall]<ulong, CTask*>)(new IntPtr(*(int*)(address + 7) + address + 11));
-            }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.SetNmParameterString);
+                if (address != null)
+                {
+                    s_setNmParameterString = (delegate* unmanaged[Stdcall]<ulong, IntPtr, IntPtr, byte>)(new IntPtr(address - 15));
+                }
 
-            address = MemScanner.FindPatternBmh("\x75\xEF\x48\x8B\x5C\x24\x30\xB8", "xxxxxxxx");
-            if (address != null)
-            {
-                s_cTaskNmScriptControlTypeIndex = *(int*)(address + 8);
-            }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.SetNmParameterVector);
+                if (address != null)
+                {
+                    s_setNmParameterVector = (delegate* unmanaged[Stdcall]<ulong, IntPtr, float, float, float, byte>)(new IntPtr(address));
+                }
 
-            address = MemScanner.FindPatternBmh("\x4C\x8B\x03\x48\x8B\xD5\x48\x8B\xCB\x41\xFF\x50\x00\x83\xFE\x04", "xxxxxxxxxxxx?xxx");
-            if (address != null)
-            {
-                // The instruction expects a signed value, but virtual function offsets can't be negative
-                s_getEventTypeIndexVFuncOffset = (uint)*(byte*)(address + 12);
-            }
-            address = MemScanner.FindPatternBmh("\x48\x8D\x05\x00\x00\x00\x00\x48\x89\x01\x8B\x44\x24\x50", "xxx????xxxxxxx");
-            if (address != null)
-            {
-                ulong cEventSwitch2NmVfTableArrayAddr = (ulong)(*(int*)(address + 3) + address + 7);
-                ulong getEventTypeOfcEventSwitch2NmFuncAddr = *(ulong*)(cEventSwitch2NmVfTableArrayAddr + s_getEventTypeIndexVFuncOffset);
-                s_cEventSwitch2NmTypeIndex = *(int*)(getEventTypeOfcEventSwitch2NmFuncAddr + 1);
-            }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.GetActiveTaskFunc);
+                if (address != null)
+                {
+                    s_getActiveTaskFunc = (delegate* unmanaged[Stdcall]<ulong, CTask*>)(new IntPtr(*(int*)(address + 7) + address + 11));
+                }
 
-            address = MemScanner.FindPatternNaive("\x48\x83\xEC\x28\x48\x8B\x42\x00\x48\x85\xC0\x74\x09\x48\x3B\x82\x00\x00\x00\x00\x74\x21", "xxxxxxx?xxxxxxxx????xx");
-            if (address != null)
-            {
-                s_fragInstNmGtaOffset = *(int*)(address + 16);
-            }
-            address = MemScanner.FindPatternNaive("\xB2\x01\x48\x8B\x01\xFF\x90\x00\x00\x00\x00\x80", "xxxxxxx????x");
-            if (address != null)
-            {
-                s_fragInstNmGtaGetUnkValVFuncOffset = (uint)*(int*)(address + 7);
-            }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.CTaskNmScriptControlTypeIndex);
+                if (address != null)
+                {
+                    s_cTaskNmScriptControlTypeIndex = *(int*)(address + 8);
+                }
 
-            address = MemScanner.FindPatternBmh("\x84\xC0\x74\x34\x48\x8D\x0D\x00\x00\x00\x00\x48\x8B\xD3", "xxxxxxx????xxx");
-            if (address != null)
-            {
-                s_getLabelTextByHashAddress = (ulong)(*(int*)(address + 7) + address + 11);
-            }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.GetEventTypeIndexVFuncOffset);
+                if (address != null)
+                {
+                    // The instruction expects a signed value, but virtual function offsets can't be negative
+                    s_getEventTypeIndexVFuncOffset = (uint)*(byte*)(address + 12);
+                }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.CEventSwitch2NmVfTableArray);
+                if (address != null)
+                {
+                    ulong cEventSwitch2NmVfTableArrayAddr = (ulong)(*(int*)(address + 3) + address + 7);
+                    ulong getEventTypeOfcEventSwitch2NmFuncAddr = *(ulong*)(cEventSwitch2NmVfTableArrayAddr + s_getEventTypeIndexVFuncOffset);
+                    s_cEventSwitch2NmTypeIndex = *(int*)(getEventTypeOfcEventSwitch2NmFuncAddr + 1);
+                }
 
-            // Find the function that returns if the corresponding text label exist first.
-            // We have to find GetLabelTextByHashFunc indirectly since Rampage Trainer hooks the function that returns the string address for corresponding text label hash by inserting jmp instruction at the beginning if that trainer is installed.
-            address = MemScanner.FindPatternBmh("\x74\x64\x48\x8D\x15\x00\x00\x00\x00\x48\x8D\x0D\x00\x00\x00\x00\xE8\x00\x00\x00\x00\x84\xC0\x74\x33", "xxxxx????xxx????x????xxxx");
-            if (address != null)
-            {
-                byte* doesTextLabelExistFuncAddr = (byte*)(*(int*)(address + 17) + address + 21);
-                long getLabelTextByHashFuncAddr = (long)(*(int*)(doesTextLabelExistFuncAddr + 28) + doesTextLabelExistFuncAddr + 32);
-                s_getLabelTextByHashFunc = (delegate* unmanaged[Stdcall]<ulong, int, ulong>)(new IntPtr(getLabelTextByHashFuncAddr));
-            }
+                address = MemScanner.FindPatternNaive(NativeMemoryPatterns.FragInstNmGtaOffset);
+                if (address != null)
+                {
+                    s_fragInstNmGtaOffset = *(int*)(address + 16);
+                }
+                address = MemScanner.FindPatternNaive(NativeMemoryPatterns.FragInstNmGtaGetUnkValVFuncOffset);
+                if (address != null)
+                {
+                    s_fragInstNmGtaGetUnkValVFuncOffset = (uint)*(int*)(address + 7);
+                }
 
-            address = MemScanner.FindPatternBmh("\x8A\x4C\x24\x60\x8B\x50\x10\x44\x8A\xCE", "xxxxxxxxxx");
-            if (address != null)
-            {
-                s_checkpointPoolAddress = (ulong*)(*(int*)(address + 17) + address + 21);
-                s_getCGameScriptHandlerAddressFunc = (delegate* unmanaged[Stdcall]<ulong>)(new IntPtr(*(int*)(address - 19) + address - 15));
-            }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.GetLabelTextByHashAddress);
+                if (address != null)
+                {
+                    s_getLabelTextByHashAddress = (ulong)(*(int*)(address + 7) + address + 11);
+                }
 
-            address = MemScanner.FindPatternBmh("\x3B\x35\x00\x00\x00\x00\x74\x00\x48\x81\xFD", "xx????x?xxx");
-            if (address != null)
-            {
-                s_radarBlipPoolAddress = (ulong*)(*(int*)(address - 4) + address);
-            }
-            address = MemScanner.FindPatternBmh("\xFF\xC6\x49\x83\xC6\x08\x3B\x35\x00\x00\x00\x00\x7C\x9B", "xxxxxxxx????xx");
-            if (address != null)
-            {
-                s_possibleRadarBlipCountAddress = (int*)(*(int*)(address + 8) + address + 12);
-            }
-            address = MemScanner.FindPatternBmh("\x8B\x44\x0A\x20\x89\x01\x48\x8D\x49\x04\x49\xFF\xC8\x75\xF1\xF3\xC3\x48\x63\x05", "xxxxxxxxxxxxxxxxxxxx");
-            if (address != null)
-            {
-                s_unkFirstRadarBlipIndexAddress = (int*)(*(int*)(address + 20) + address + 24);
-            }
-            address = MemScanner.FindPatternBmh("\x41\xB8\x07\x00\x00\x00\x8B\xD0\x89\x05\x00\x00\x00\x00\x41\x8D\x48\xFC", "xxxxxxxxxx????xxxx");
-            if (address != null)
-            {
-                s_northRadarBlipHandleAddress = (int*)(*(int*)(address + 10) + address + 14);
-            }
-            address = MemScanner.FindPatternBmh("\x41\xB8\x06\x00\x00\x00\x8B\xD0\x89\x05\x00\x00\x00\x00\x41\x8D\x48\xFD", "xxxxxxxxxx????xxxx");
-            if (address != null)
-            {
-                s_centerRadarBlipHandleAddress = (int*)(*(int*)(address + 10) + address + 14);
-            }
+                // Find the function that returns if the corresponding text label exist first.
+                // We have to find GetLabelTextByHashFunc indirectly since Rampage Trainer hooks the function that returns the string address for corresponding text label hash by inserting jmp instruction at the beginning if that trainer is installed.
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.DoesTextLabelExistFunc);
+                if (address != null)
+                {
+                    byte* doesTextLabelExistFuncAddr = (byte*)(*(int*)(address + 17) + address + 21);
+                    long getLabelTextByHashFuncAddr = (long)(*(int*)(doesTextLabelExistFuncAddr + 28) + doesTextLabelExistFuncAddr + 32);
+                    s_getLabelTextByHashFunc = (delegate* unmanaged[Stdcall]<ulong, int, ulong>)(new IntPtr(getLabelTextByHashFuncAddr));
+                }
 
-            address = MemScanner.FindPatternBmh("\x33\xDB\xE8\x00\x00\x00\x00\x48\x85\xC0\x74\x07\x48\x8B\x40\x20\x8B\x58\x18", "xxx????xxxxxxxxxxxx");
-            if (address != null)
-            {
-                s_getLocalPlayerPedAddressFunc = (delegate* unmanaged[Stdcall]<ulong>)(new IntPtr(*(int*)(address + 3) + address + 7));
-            }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.CheckpointPoolAddress);
+                if (address != null)
+                {
+                    s_checkpointPoolAddress = (ulong*)(*(int*)(address + 17) + address + 21);
+                    s_getCGameScriptHandlerAddressFunc = (delegate* unmanaged[Stdcall]<ulong>)(new IntPtr(*(int*)(address - 19) + address - 15));
+                }
 
-            address = MemScanner.FindPatternBmh("\x4C\x8D\x05\x00\x00\x00\x00\x74\x07\xB8\x00\x00\x00\x00\xEB\x2D\x33\xC0", "xxx????xxx????xxxx");
-            if (address != null)
-            {
-                s_waypointInfoArrayStartAddress = (ulong*)(*(int*)(address + 3) + address + 7);
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.RadarBlipPoolAddress);
+                if (address != null)
+                {
+                    s_radarBlipPoolAddress = (ulong*)(*(int*)(address - 4) + address);
+                }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.PossibleRadarBlipCountAddress);
+                if (address != null)
+                {
+                    s_possibleRadarBlipCountAddress = (int*)(*(int*)(address + 8) + address + 12);
+                }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.UnkFirstRadarBlipIndexAddress);
+                if (address != null)
+                {
+                    s_unkFirstRadarBlipIndexAddress = (int*)(*(int*)(address + 20) + address + 24);
+                }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.NorthRadarBlipHandleAddress);
+                if (address != null)
+                {
+                    s_northRadarBlipHandleAddress = (int*)(*(int*)(address + 10) + address + 14);
+                }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.CenterRadarBlipHandleAddress);
+                if (address != null)
+                {
+                    s_centerRadarBlipHandleAddress = (int*)(*(int*)(address + 10) + address + 14);
+                }
 
-                startAddressToSearch = new IntPtr(address);
-                address = MemScanner.FindPatternBmh("\x48\x8D\x15\x00\x00\x00\x00\x48\x83\xC1\x00\xFF\xC0\x48\x3B\xCA\x7C\xEA\x32\xC0", "xxx????xxx?xxxxxxxxx", startAddressToSearch);
-                s_waypointInfoArrayEndAddress = (ulong*)(*(int*)(address + 3) + address + 7);
-            }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.GetLocalPlayerPedAddressFunc);
+                if (address != null)
+                {
+                    s_getLocalPlayerPedAddressFunc = (delegate* unmanaged[Stdcall]<ulong>)(new IntPtr(*(int*)(address + 3) + address + 7));
+                }
 
-            address = MemScanner.FindPatternBmh("\x80\x3D\x00\x00\x00\x00\x00\x8B\xDA\x75\x29\x48\x8B\xD1\x33\xC9\xE8", "xx????xxxxxxxxxxx");
-            if (address != null)
-            {
-                s_isDecoratorLocked = (byte*)(*(int*)(address + 2) + address + 7);
-            }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.WaypointInfoArrayStartAddress);
+                if (address != null)
+                {
+                    s_waypointInfoArrayStartAddress = (ulong*)(*(int*)(address + 3) + address + 7);
 
-            address = MemScanner.FindPatternBmh("\xF3\x0F\x10\x5C\x24\x20\xF3\x0F\x10\x54\x24\x24\xF3\x0F\x59\xD9\xF3\x0F\x59\xD1\xF3\x0F\x10\x44\x24\x28\xF3\x0F\x11\x1F", "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxx");
-            if (address != null)
-            {
-                s_getRotationFromMatrixFunc = (delegate* unmanaged[Stdcall]<float*, ulong, int, float*>)(new IntPtr(*(int*)(address - 0x14) + address - 0x10));
-            }
-            address = MemScanner.FindPatternBmh("\xF3\x0F\x11\x4D\x38\xF3\x0F\x11\x45\x3C\xE8\x00\x00\x00\x00\x0F\x28\xC6\x0F\x28\xCE\xB9\x01\x00\x00\x00\xF3\x0F\x11\x73\x10\x66\x44\x03\xE9", "xxxxxxxxxxx????xxxxxxxxxxxxxxxxxxxx");
-            if (address != null)
-            {
-                s_getQuaternionFromMatrixFunc = (delegate* unmanaged[Stdcall]<float*, ulong, int>)(new IntPtr(*(int*)(address + 11) + address + 15));
-            }
+                    startAddressToSearch = new IntPtr(address);
+                    address = MemScanner.FindPatternBmh("\x48\x8D\x15\x00\x00\x00\x00\x48\x83\xC1\x00\xFF\xC0\x48\x3B\xCA\x7C\xEA\x32\xC0", "xxx????xxx?xxxxxxxxx", startAddressToSearch);
+                    s_waypointInfoArrayEndAddress = (ulong*)(*(int*)(address + 3) + address + 7);
+                }
 
-            address = MemScanner.FindPatternBmh("\x48\x8B\x42\x20\x48\x85\xC0\x74\x09\xF3\x0F\x10\x80", "xxxxxxxxxxxxx");
-            if (address != null)
-            {
-                EntityMaxHealthOffset = *(int*)(address + 0x25);
-            }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.IsDecoratorLocked);
+                if (address != null)
+                {
+                    s_isDecoratorLocked = (byte*)(*(int*)(address + 2) + address + 7);
+                }
 
-            address = MemScanner.FindPatternBmh("\x75\x11\x48\x8B\x06\x48\x8D\x54\x24\x20\x48\x8B\xCE\xFF\x90", "xxxxxxxxxxxxxxx");
-            if (address != null)
-            {
-                SetAngularVelocityVFuncOfEntityOffset = *(int*)(address + 15);
-                GetAngularVelocityVFuncOfEntityOffset = SetAngularVelocityVFuncOfEntityOffset + 0x8;
-            }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.GetRotationFromMatrixFunc);
+                if (address != null)
+                {
+                    s_getRotationFromMatrixFunc = (delegate* unmanaged[Stdcall]<float*, ulong, int, float*>)(new IntPtr(*(int*)(address - 0x14) + address - 0x10));
+                }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.GetQuaternionFromMatrixFunc);
+                if (address != null)
+                {
+                    s_getQuaternionFromMatrixFunc = (delegate* unmanaged[Stdcall]<float*, ulong, int>)(new IntPtr(*(int*)(address + 11) + address + 15));
+                }
 
-            address = MemScanner.FindPatternBmh("\x48\x8B\x89\x00\x00\x00\x00\x33\xC0\x44\x8B\xC2\x48\x85\xC9\x74\x20", "xxx????xxxxxxxxxx");
-            if (address != null)
-            {
-                NativeMemory.CAttackerArrayOfEntityOffset = *(int*)(address + 3); // the correct name is unknown
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.EntityMaxHealthOffset);
+                if (address != null)
+                {
+                    EntityMaxHealthOffset = *(int*)(address + 0x25);
+                }
 
-                startAddressToSearch = new IntPtr(address);
-                address = MemScanner.FindPatternBmh("\x48\x63\x51\x00\x48\x85\xD2", "xxx?xxx", startAddressToSearch);
-                NativeMemory.ElementCountOfCAttackerArrayOfEntityOffset = (*(sbyte*)(address + 3));
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.SetAngularVelocityVFuncOfEntityOffset);
+                if (address != null)
+                {
+                    SetAngularVelocityVFuncOfEntityOffset = *(int*)(address + 15);
+                    GetAngularVelocityVFuncOfEntityOffset = SetAngularVelocityVFuncOfEntityOffset + 0x8;
+                }
 
-                startAddressToSearch = new IntPtr(address);
-                address = MemScanner.FindPatternBmh("\x48\x83\xC1\x00\x48\x3B\xC2\x7C\xEF", "xxx?xxxxx", startAddressToSearch);
-                // the element size might be 0x10 in older builds (the size is 0x18 at least in b1604 and b2372)
-                NativeMemory.ElementSizeOfCAttackerArrayOfEntity = (*(sbyte*)(address + 3));
-            }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.CAttackerArrayOfEntityOffset);
+                if (address != null)
+                {
+                    NativeMemory.CAttackerArrayOfEntityOffset = *(int*)(address + 3); // the correct name is unknown
 
-            address = MemScanner.FindPatternBmh("\x74\x11\x8B\xD1\x48\x8D\x0D\x00\x00\x00\x00\x45\x33\xC0", "xxxxxxx????xxx");
-            if (address != null)
-            {
-                s_cursorSpriteAddr = (int*)(*(int*)(address - 4) + address);
-            }
+                    startAddressToSearch = new IntPtr(address);
+                    address = MemScanner.FindPatternBmh("\x48\x63\x51\x00\x48\x85\xD2", "xxx?xxx", startAddressToSearch);
+                    NativeMemory.ElementCountOfCAttackerArrayOfEntityOffset = (*(sbyte*)(address + 3));
 
-            address = MemScanner.FindPatternBmh("\x48\x63\xC1\x48\x8D\x0D\x00\x00\x00\x00\xF3\x0F\x10\x04\x81\xF3\x0F\x11\x05", "xxxxxx????xxxxxxxxx");
-            if (address != null)
-            {
-                s_readWorldGravityAddress = (float*)(*(int*)(address + 19) + address + 23);
-                s_writeWorldGravityAddress = (float*)(*(int*)(address + 6) + address + 10);
-            }
+                    startAddressToSearch = new IntPtr(address);
+                    address = MemScanner.FindPatternBmh("\x48\x83\xC1\x00\x48\x3B\xC2\x7C\xEF", "xxx?xxxxx", startAddressToSearch);
+                    // the element size might be 0x10 in older builds (the size is 0x18 at least in b1604 and b2372)
+                    NativeMemory.ElementSizeOfCAttackerArrayOfEntity = (*(sbyte*)(address + 3));
+                }
 
-            address = MemScanner.FindPatternBmh("\xF3\x0F\x11\x05\x00\x00\x00\x00\xF3\x0F\x10\x08\x0F\x2F\xC8\x73\x03\x0F\x28\xC1\x48\x83\xC0\x04\x49\x2B", "xxxx????xxxxxxxxxxxxxxxxxx");
-            if (address != null)
-            {
-                float* timeScaleArrayAddress = (float*)(*(int*)(address + 4) + address + 8);
-                // SET_TIME_SCALE changes the 2nd element, so obtain the address of it
-                s_timeScaleAddress = timeScaleArrayAddress + 1;
-            }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.CursorSpriteAddr);
+                if (address != null)
+                {
+                    s_cursorSpriteAddr = (int*)(*(int*)(address - 4) + address);
+                }
 
-            address = MemScanner.FindPatternBmh("\xF3\x0F\x11\xB5\x60\x01\x00\x00\x84\xC0\x75\x4C\x85\xC9\x79\x1D\x33\xD2\xE8", "xxxxxxxxxxxxxxxxxxx");
-            if (address != null)
-            {
-                byte* unkClockFunc = (byte*)(*(int*)(address + 19) + address + 23);
-                s_millisecondsPerGameMinuteAddress = (int*)(*(int*)(unkClockFunc + 0x46) + unkClockFunc + 0x4A);
-                s_lastClockTickAddress = (int*)(s_millisecondsPerGameMinuteAddress + 2);
-            }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.ReadWorldGravityAddress);
+                if (address != null)
+                {
+                    s_readWorldGravityAddress = (float*)(*(int*)(address + 19) + address + 23);
+                    s_writeWorldGravityAddress = (float*)(*(int*)(address + 6) + address + 10);
+                }
 
-            address = MemScanner.FindPatternBmh("\x75\x2D\x44\x38\x3D\x00\x00\x00\x00\x75\x24", "xxxxx????xx");
-            if (address != null)
-            {
-                s_isClockPausedAddress = (byte*)(*(int*)(address + 5) + address + 9);
-            }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.TimeScaleArray);
+                if (address != null)
+                {
+                    float* timeScaleArrayAddress = (float*)(*(int*)(address + 4) + address + 8);
+                    // SET_TIME_SCALE changes the 2nd element, so obtain the address of it
+                    s_timeScaleAddress = timeScaleArrayAddress + 1;
+                }
 
-            // Find camera objects
-            address = MemScanner.FindPatternBmh("\x48\x8B\x0D\x00\x00\x00\x00\x48\x8B\xD7\xE8\x00\x00\x00\x00\x8B\xD8\x8B\xC3", "xxx????xxxx????xxxx");
-            if (address != null)
-            {
-                s_cameraPoolAddress = (ulong*)(*(int*)(address + 3) + address + 7);
-            }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.UnkClockFunc);
+                if (address != null)
+                {
+                    byte* unkClockFunc = (byte*)(*(int*)(address + 19) + address + 23);
+                    s_millisecondsPerGameMinuteAddress = (int*)(*(int*)(unkClockFunc + 0x46) + unkClockFunc + 0x4A);
+                    s_lastClockTickAddress = (int*)(s_millisecondsPerGameMinuteAddress + 2);
+                }
 
-            address = MemScanner.FindPatternBmh("\x48\x8B\xC7\xF3\x0F\x10\x0D", "xxxxxxx");
-            if (address != null)
-            {
-                address = (*(int*)(address - 0x1D) + address - 0x19);
-                s_gameplayCameraAddress = (ulong*)(*(int*)(address + 3) + address + 7);
-            }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.IsClockPausedAddress);
+                if (address != null)
+                {
+                    s_isClockPausedAddress = (byte*)(*(int*)(address + 5) + address + 9);
+                }
 
-            // Find model hash table
-            address = MemScanner.FindPatternBmh("\x3C\x05\x75\x16\x8B\x81", "xxxxxx");
-            if (address != null)
-            {
-                s_vehicleTypeOffsetInModelInfo = *(int*)(address + 6);
-            }
+                // Find camera objects
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.CameraPoolAddress);
+                if (address != null)
+                {
+                    s_cameraPoolAddress = (ulong*)(*(int*)(address + 3) + address + 7);
+                }
 
-            uint vehicleClassOffset = 0;
-            address = MemScanner.FindPatternBmh("\x66\x81\xF9\x00\x00\x74\x10\x4D\x85\xC0", "xxx??xxxxx");
-            if (address != null)
-            {
-                vehicleClassOffset = *(uint*)(address + 0x10);
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.GameplayCameraAddress);
+                if (address != null)
+                {
+                    address = (*(int*)(address - 0x1D) + address - 0x19);
+                    s_gameplayCameraAddress = (ulong*)(*(int*)(address + 3) + address + 7);
+                }
 
-                address = (*(int*)(address - 0x21) + address - 0x1D);
-                s_modelNum1 = *(UInt32*)(*(int*)(address + 0x52) + address + 0x56);
-                s_modelNum2 = *(UInt64*)(*(int*)(address + 0x63) + address + 0x67);
-                s_modelNum3 = *(UInt64*)(*(int*)(address + 0x7A) + address + 0x7E);
-                s_modelNum4 = *(UInt64*)(*(int*)(address + 0x81) + address + 0x85);
-                s_modelHashTable = *(UInt64*)(*(int*)(address + 0x24) + address + 0x28);
-                s_modelHashEntries = *(UInt16*)(address + *(int*)(address + 3) + 7);
-            }
+                // Find model hash table
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.VehicleTypeOffsetInModelInfo);
+                if (address != null)
+                {
+                    s_vehicleTypeOffsetInModelInfo = *(int*)(address + 6);
+                }
 
-            address = MemScanner.FindPatternBmh("\x33\xD2\x00\x8B\xD0\x00\x2B\x05\x00\x00\x00\x00\xC1\xE6\x10", "xx?xx?xx????xxx");
-            if (address != null)
-            {
-                s_modelInfoArrayPtr = (ulong*)(*(int*)(address + 8) + address + 12);
-            }
+                uint vehicleClassOffset = 0;
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.VehicleClassOffset);
+                if (address != null)
+                {
+                    vehicleClassOffset = *(uint*)(address + 0x10);
 
-            address = MemScanner.FindPatternBmh("\x48\x83\xEC\x20\x48\x8B\x91\x00\x00\x00\x00\x33\xF6\x48\x8B\xD9\x48\x85\xD2\x74\x2B\x48\x8D\x0D", "xxxxxxx??xxxxxxxxxxxxxxx");
-            if (address != null)
-            {
-                s_cStreamingAddr = (ulong*)(*(int*)(address + 24) + address + 28);
-            }
+                    address = (*(int*)(address - 0x21) + address - 0x1D);
+                    s_modelNum1 = *(UInt32*)(*(int*)(address + 0x52) + address + 0x56);
+                    s_modelNum2 = *(UInt64*)(*(int*)(address + 0x63) + address + 0x67);
+                    s_modelNum3 = *(UInt64*)(*(int*)(address + 0x7A) + address + 0x7E);
+                    s_modelNum4 = *(UInt64*)(*(int*)(address + 0x81) + address + 0x85);
+                    s_modelHashTable = *(UInt64*)(*(int*)(address + 0x24) + address + 0x28);
+                    s_modelHashEntries = *(UInt16*)(address + *(int*)(address + 3) + 7);
+                }
 
-            address = MemScanner.FindPatternBmh("\x44\x39\x38\x74\x17\x48\xFF\xC1\x48\x83\xC0\x04\x48\x3B\xCB\x7C\xEF\x41\x8B\xD7\x49\x8B\xCE\xE8", "xxxxxxxxxxxxxxxxxxxxxxxx");
-            if (address != null)
-            {
-                var unkFuncForVehicleModelIndices = (byte*)(*(int*)(address + 0x18) + address + 0x1C);
-                s_cStreamingAppropriateVehicleIndicesOffset = *(int*)(unkFuncForVehicleModelIndices + 0x1E);
-            }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.ModelInfoArrayPtr);
+                if (address != null)
+                {
+                    s_modelInfoArrayPtr = (ulong*)(*(int*)(address + 8) + address + 12);
+                }
 
-            address = MemScanner.FindPatternBmh("\x75\x0D\x8B\xD7\x49\x8B\xCE\xE8\x00\x00\x00\x00\x41\x2B\xDD\x45\x03\xFD\x41\x03\xDD\x41\x3B\xDC\x0F\x8C\x9A\xFE\xFF\xFF", "xxxxxxxx????xxxxxxxxxxxxxxxxxx");
-            if (address != null)
-            {
-                var unkFuncForPedModelIndices = (byte*)(*(int*)(address + 8) + address + 12);
-                s_cStreamingAppropriatePedIndicesOffset = *(int*)(unkFuncForPedModelIndices + 0x1E);
-            }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.CStreamingAddr);
+                if (address != null)
+                {
+                    s_cStreamingAddr = (ulong*)(*(int*)(address + 24) + address + 28);
+                }
 
-            address = MemScanner.FindPatternBmh("\x48\x8B\x05\x00\x00\x00\x00\x41\x8B\x1E", "xxx????xxx");
-            if (address != null)
-            {
-                s_weaponAndAmmoInfoArrayPtr = (RageAtArrayPtr*)(*(int*)(address + 3) + address + 7);
-            }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.UnkFuncForVehicleModelIndices);
+                if (address != null)
+                {
+                    var unkFuncForVehicleModelIndices = (byte*)(*(int*)(address + 0x18) + address + 0x1C);
+                    s_cStreamingAppropriateVehicleIndicesOffset = *(int*)(unkFuncForVehicleModelIndices + 0x1E);
+                }
 
-            address = MemScanner.FindPatternBmh("\x84\xC0\x74\x20\x48\x8B\x47\x40\x48\x85\xC0\x74\x08\x8B\xB0\x00\x00\x00\x00\xEB\x02\x33\xF6\x48\x8D\x4D\x48\xE8", "xxxxxxxxxxxxxxx????xxxxxxxxx");
-            if (address != null)
-            {
-                s_weaponInfoHumanNameHashOffset = *(int*)(address + 15);
-            }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.UnkFuncForPedModelIndices);
+                if (address != null)
+                {
+                    var unkFuncForPedModelIndices = (byte*)(*(int*)(address + 8) + address + 12);
+                    s_cStreamingAppropriatePedIndicesOffset = *(int*)(unkFuncForPedModelIndices + 0x1E);
+                }
 
-            address = MemScanner.FindPatternBmh("\x8B\x05\x00\x00\x00\x00\x44\x8B\xD3\x8D\x48\xFF", "xx????xxxxxx");
-            if (address != null)
-            {
-                s_weaponComponentArrayCountAddr = (uint*)(*(int*)(address + 2) + address + 6);
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.WeaponAndAmmoInfoArrayPtr);
+                if (address != null)
+                {
+                    s_weaponAndAmmoInfoArrayPtr = (RageAtArrayPtr*)(*(int*)(address + 3) + address + 7);
+                }
 
-                address = MemScanner.FindPatternNaive("\x46\x8D\x04\x11\x48\x8D\x15\x00\x00\x00\x00\x41\xD1\xF8", "xxxxxxx????xxx", new IntPtr(address));
-                s_offsetForCWeaponComponentArrayAddr = (ulong)(address + 7);
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.WeaponInfoHumanNameHashOffset);
+                if (address != null)
+                {
+                    s_weaponInfoHumanNameHashOffset = *(int*)(address + 15);
+                }
 
-                address = MemScanner.FindPatternNaive("\x74\x10\x49\x8B\xC9\xE8", "xxxxxx", new IntPtr(address));
-                var findAttachPointFuncAddr = new IntPtr((long)(*(int*)(address + 6) + address + 10));
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.WeaponComponentArrayCountAddr);
+                if (address != null)
+                {
+                    s_weaponComponentArrayCountAddr = (uint*)(*(int*)(address + 2) + address + 6);
 
-                address = MemScanner.FindPatternNaive("\x4C\x8D\x81", "xxx", findAttachPointFuncAddr);
-                s_weaponAttachPointsStartOffset = *(int*)(address + 3);
-                address = MemScanner.FindPatternNaive("\x4D\x63\x98", "xxx", new IntPtr(address));
-                s_weaponAttachPointsArrayCountOffset = *(int*)(address + 3);
-                address = MemScanner.FindPatternNaive("\x4C\x63\x50", "xxx", new IntPtr(address));
-                s_weaponAttachPointElementComponentCountOffset = *(byte*)(address + 3);
-                address = MemScanner.FindPatternNaive("\x48\x83\xC0", "xxx", new IntPtr(address));
-                s_weaponAttachPointElementSize = *(byte*)(address + 3);
-            }
+                    address = MemScanner.FindPatternNaive("\x46\x8D\x04\x11\x48\x8D\x15\x00\x00\x00\x00\x41\xD1\xF8", "xxxxxxx????xxx", new IntPtr(address));
+                    s_offsetForCWeaponComponentArrayAddr = (ulong)(address + 7);
 
-            address = MemScanner.FindPatternBmh("\x24\x1F\x3C\x05\x0F\x85\x00\x00\x00\x00\x48\x8D\x82\x00\x00\x00\x00\x48\x8D\xB2\x00\x00\x00\x00\x48\x85\xC0\x74\x09\x80\x38\x00\x74\x04\x8A\xCB", "xxxxxx????xxx????xxx????xxxxxxxxxxxx");
-            if (address != null)
-            {
-                s_vehicleMakeNameOffsetInModelInfo = *(int*)(address + 13);
-            }
+                    address = MemScanner.FindPatternNaive("\x74\x10\x49\x8B\xC9\xE8", "xxxxxx", new IntPtr(address));
+                    var findAttachPointFuncAddr = new IntPtr((long)(*(int*)(address + 6) + address + 10));
 
-            address = MemScanner.FindPatternBmh("\x66\x89\x44\x24\x38\x8B\x44\x24\x38\x8B\xC8\x33\x4C\x24\x30\x81\xE1\x00\x00\xFF\x0F\x33\xC1\x0F\xBA\xF0\x1D\x8B\xC8\x33\x4C\x24\x30\x23\xCB\x33\xC1", "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx");
-            if (address != null)
-            {
-                s_pedPersonalityIndexOffsetInModelInfo = *(int*)(address + 0x42);
-                s_pedPersonalitiesArrayAddr = (ulong*)(*(int*)(address + 0x49) + address + 0x4D);
-            }
+                    address = MemScanner.FindPatternNaive("\x4C\x8D\x81", "xxx", findAttachPointFuncAddr);
+                    s_weaponAttachPointsStartOffset = *(int*)(address + 3);
+                    address = MemScanner.FindPatternNaive("\x4D\x63\x98", "xxx", new IntPtr(address));
+                    s_weaponAttachPointsArrayCountOffset = *(int*)(address + 3);
+                    address = MemScanner.FindPatternNaive("\x4C\x63\x50", "xxx", new IntPtr(address));
+                    s_weaponAttachPointElementComponentCountOffset = *(byte*)(address + 3);
+                    address = MemScanner.FindPatternNaive("\x48\x83\xC0", "xxx", new IntPtr(address));
+                    s_weaponAttachPointElementSize = *(byte*)(address + 3);
+                }
 
-            address = MemScanner.FindPatternBmh("\x48\x85\xC0\x74\x7F\xF6\x80\x00\x00\x00\x00\x02\x75\x76", "xxxxxxx????xxx");
-            if (address != null)
-            {
-                int pedIntelligenceOffset = *(int*)(address + 0x11);
-                PedPlayerInfoOffset = pedIntelligenceOffset + 0x8;
-            }
-            address = MemScanner.FindPatternBmh("\x66\x0F\x6E\xF0\x0F\x5B\xF6\xE8\x00\x00\x00\x00\x0F\x28\xCE\x41\xB1\x01\x45\x33\xC0\x48\x8B\xC8\xE8", "xxxxxxxx????xxxxxxxxxxxxx");
-            if (address != null)
-            {
-                CPlayerInfoMaxHealthOffset = *(int*)(address - 4);
-            }
-            // None of fields on `CPlayerPedTargeting` and `CWanted` are accessed with direct offsets from
-            // `CPlayerInfo` instances in the game code
-            address = MemScanner.FindPatternBmh("\x48\x85\xFF\x74\x23\x48\x85\xDB\x74\x26", "xxxxxxxxxx");
-            if (address != null)
-            {
-                CPlayerPedTargetingOfffset = *(int*)(address - 7);
-            }
-            address = MemScanner.FindPatternBmh("\x48\x85\xFF\x74\x3F\x48\x8B\xCF\xE8", "xxxxxxxxx");
-            if (address != null)
-            {
-                CWantedOffset = *(int*)(address + 0x1B);
-            }
-            address = MemScanner.FindPatternBmh("\x45\x84\xC9\x74\x32\x8B\x41\x00\x85\xC0\x74\x2B", "xxxxxxx?xxxx");
-            if (address != null)
-            {
-                CurrentCrimeValueOffset = (int)*(byte*)(address + 0x2A);
-                TimeWhenNewCrimeValueTakesEffectOffset = (int)*(byte*)(address + 0x7);
-                CurrentWantedLevelOffset = *(int*)(address + 0x17);
-                NewCrimeValueOffset = *(int*)(address + 0x1D);
-            }
-            address = MemScanner.FindPatternBmh("\xF6\x87\x00\x00\x00\x00\x02\x44\x8B\x00\x00\x00\x00\x00\x75\x0E", "xx??xxxxx?????xx");
-            if (address != null)
-            {
-                int isWantedStarFlashingOffset = *(int*)(address + 0x2);
-                // Flags for ignoring player are actually read/written as a byte in the game code, but make this value 4-byte aligned because SetBit and IsBitSet reads/writes as an int value
-                CWantedIgnorePlayerFlagOffset = isWantedStarFlashingOffset - 3;
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.VehicleMakeNameOffsetInModelInfo);
+                if (address != null)
+                {
+                    s_vehicleMakeNameOffsetInModelInfo = *(int*)(address + 13);
+                }
 
-                CWantedTimeSearchLastRefocusedOffset = isWantedStarFlashingOffset - 0x23;
-                CWantedTimeLastSpottedOffset = CWantedTimeSearchLastRefocusedOffset + 0x4;
-                CWantedTimeHiddenEvasionStartedOffset = CWantedTimeSearchLastRefocusedOffset + 0xC;
-            }
-            address = MemScanner.FindPatternBmh("\xEB\x26\x8B\x87\x00\x00\x00\x00\x25\x00\xF8\xFF\xFF\xC1\xE0\x12", "xxxx????xxxxxxxx");
-            if (address != null)
-            {
-                s_activateSpecialAbilityFunc = (delegate* unmanaged[Stdcall]<IntPtr, void>)(new IntPtr(*(int*)(address + 0x24) + address + 0x28));
-            }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.PedPersonalityIndexOffsetInModelInfo);
+                if (address != null)
+                {
+                    s_pedPersonalityIndexOffsetInModelInfo = *(int*)(address + 0x42);
+                    s_pedPersonalitiesArrayAddr = (ulong*)(*(int*)(address + 0x49) + address + 0x4D);
+                }
 
-            int gameVersion = GetGameVersion();
-            // Two special ability slots are available in b2060 and later versions
-            if (gameVersion >= 59)
-            {
-                address = MemScanner.FindPatternBmh("\x0F\x84\x49\x01\x00\x00\x33\xD2\xE8", "xxxxxxxxx");
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.PedIntelligenceOffset);
                 if (address != null)
                 {
-                    s_getSpecialAbilityAddressFunc = (delegate* unmanaged[Stdcall]<IntPtr, int, IntPtr>)(new IntPtr(*(int*)(address + 9) + address + 13));
+                    int pedIntelligenceOffset = *(int*)(address + 0x11);
+                    PedPlayerInfoOffset = pedIntelligenceOffset + 0x8;
                 }
-            }
-            else
-            {
-                address = MemScanner.FindPatternBmh("\x0F\x84\x46\x01\x00\x00\x48\x8B\x9B", "xxxxxxxxx");
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.CPlayerInfoMaxHealthOffset);
                 if (address != null)
                 {
-                    PlayerPedSpecialAbilityOffset = *(int*)(address + 9);
+                    CPlayerInfoMaxHealthOffset = *(int*)(address - 4);
                 }
-            }
+                // None of fields on `CPlayerPedTargeting` and `CWanted` are accessed with direct offsets from
+                // `CPlayerInfo` instances in the game code
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.CPlayerPedTargetingOffset);
+                if (address != null)
+                {
+                    CPlayerPedTargetingOfffset = *(int*)(address - 7);
+                }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.CWantedOffset);
+                if (address != null)
+                {
+                    CWantedOffset = *(int*)(address + 0x1B);
+                }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.CurrentCrimeValueOffset);
+                if (address != null)
+                {
+                    CurrentCrimeValueOffset = (int)*(byte*)(address + 0x2A);
+                    TimeWhenNewCrimeValueTakesEffectOffset = (int)*(byte*)(address + 0x7);
+                    CurrentWantedLevelOffset = *(int*)(address + 0x17);
+                    NewCrimeValueOffset = *(int*)(address + 0x1D);
+                }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.IsWantedStarFlashingOffset);
+                if (address != null)
+                {
+                    int isWantedStarFlashingOffset = *(int*)(address + 0x2);
+                    // Flags for ignoring player are actually read/written as a byte in the game code, but make this value 4-byte aligned because SetBit and IsBitSet reads/writes as an int value
+                    CWantedIgnorePlayerFlagOffset = isWantedStarFlashingOffset - 3;
 
-            address = MemScanner.FindPatternBmh("\x48\x8B\x87\x00\x00\x00\x00\x48\x85\xC0\x0F\x84\x8B\x00\x00\x00", "xxx????xxxxxxxxx");
-            if (address != null)
-            {
-                s_objParentEntityAddressDetachedFromOffset = *(int*)(address + 3);
-            }
+                    CWantedTimeSearchLastRefocusedOffset = isWantedStarFlashingOffset - 0x23;
+                    CWantedTimeLastSpottedOffset = CWantedTimeSearchLastRefocusedOffset + 0x4;
+                    CWantedTimeHiddenEvasionStartedOffset = CWantedTimeSearchLastRefocusedOffset + 0xC;
+                }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.ActivateSpecialAbilityFunc);
+                if (address != null)
+                {
+                    s_activateSpecialAbilityFunc = (delegate* unmanaged[Stdcall]<IntPtr, void>)(new IntPtr(*(int*)(address + 0x24) + address + 0x28));
+                }
 
-            address = MemScanner.FindPatternBmh("\x48\x8D\x1D\x00\x00\x00\x00\x4C\x8B\x0B\x4D\x85\xC9\x74\x67", "xxx????xxxxxxxx");
-            if (address != null)
-            {
-                s_projectilePoolAddress = (ulong*)(*(int*)(address + 3) + address + 7);
-            }
-            // Find address of the projectile count, just in case the max number of projectile changes from 50
-            address = MemScanner.FindPatternBmh("\x44\x8B\x0D\x00\x00\x00\x00\x33\xDB\x45\x8A\xF8", "xxx????xxxxx");
-            if (address != null)
-            {
-                s_projectileCountAddress = (int*)(*(int*)(address + 3) + address + 7);
-            }
-            address = MemScanner.FindPatternBmh("\x48\x85\xED\x74\x09\x48\x39\xA9\x00\x00\x00\x00\x75\x2D", "xxxxxxxx????xx");
-            if (address != null)
-            {
-                ProjectileOwnerOffset = *(int*)(address + 8);
-            }
-            address = MemScanner.FindPatternBmh("\x45\x85\xF6\x74\x0D\x48\x8B\x81\x00\x00\x00\x00\x44\x39\x70\x10", "xxxxxxxx????xxxx");
-            if (address != null)
-            {
-                ProjectileAmmoInfoOffset = *(int*)(address + 8);
-            }
-            address = MemScanner.FindPatternBmh("\x0F\x84\xBE\x00\x00\x00\x48\x8B\x0E\x48\x39\x88\x00\x00\x00\x00\x0F\x85\xAE\x00\x00\x00", "xxxxxxxxxxxx??xxxxxxxx");
-            if (address != null)
-            {
-                s_getAsCProjectileRocketConstVFuncOffset = *(int*)(address - 7);
-                s_getAsCProjectileConstVFuncOffset = s_getAsCProjectileRocketConstVFuncOffset - 0x10;
-                s_getAsCProjectileThrownConstVFuncOffset = s_getAsCProjectileRocketConstVFuncOffset + 0x10;
-            }
-            address = MemScanner.FindPatternBmh("\x74\x33\x48\x39\x98\x00\x00\x00\x00\x75\x2A\x48\x8B\x0F\x48\x3B\xCB", "xxxxx??xxxxxxxxxx");
-            if (address != null)
-            {
-                ProjectileRocketTargetOffset = *(int*)(address + 5);
+                int gameVersion = GetGameVersion();
+                // Two special ability slots are available in b2060 and later versions
+                if (gameVersion >= 59)
+                {
+                    address = MemScanner.FindPatternBmh(NativeMemoryPatterns.GetSpecialAbilityAddressFunc);
+                    if (address != null)
+                    {
+                        s_getSpecialAbilityAddressFunc = (delegate* unmanaged[Stdcall]<IntPtr, int, IntPtr>)(new IntPtr(*(int*)(address + 9) + address + 13));
+                    }
+                }
+                else
+                {
+                    address = MemScanner.FindPatternBmh(NativeMemoryPatterns.PlayerPedSpecialAbilityOffset);
+                    if (address != null)
+                    {
+                        PlayerPedSpecialAbilityOffset = *(int*)(address + 9);
+                    }
+                }
 
-                ProjectileRocketCachedTargetPosOffset = ProjectileRocketTargetOffset - 0x20;
-                ProjectileRocketLaunchDirOffset = ProjectileRocketTargetOffset - 0x10;
-                ProjectileRocketFlightModelInputPitchOffset = ProjectileRocketTargetOffset + 0x8;
-                ProjectileRocketFlightModelInputRollOffset = ProjectileRocketTargetOffset + 0xC;
-                ProjectileRocketFlightModelInputYawOffset = ProjectileRocketTargetOffset + 0x10;
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.ObjParentEntityAddressDetachedFromOffset);
+                if (address != null)
+                {
+                    s_objParentEntityAddressDetachedFromOffset = *(int*)(address + 3);
+                }
 
-                ProjectileRocketTimeBeforeHomingOffset = ProjectileRocketTargetOffset + 0x18;
-                ProjectileRocketTimeBeforeHomingAngleBreakOffset = ProjectileRocketTargetOffset + 0x1C;
-                ProjectileRocketLauncherSpeedOffset = ProjectileRocketTargetOffset + 0x20;
-                ProjectileRocketTimeSinceLaunchOffset = ProjectileRocketTargetOffset + 0x24;
-                ProjectileRocketFlagsOffset = ProjectileRocketTargetOffset + 0x30;
-                ProjectileRocketCachedDirectionOffset = ProjectileRocketTargetOffset + 0x40;
-            }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.ProjectilePoolAddress);
+                if (address != null)
+                {
+                    s_projectilePoolAddress = (ulong*)(*(int*)(address + 3) + address + 7);
+                }
+                // Find address of the projectile count, just in case the max number of projectile changes from 50
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.ProjectileCountAddress);
+                if (address != null)
+                {
+                    s_projectileCountAddress = (int*)(*(int*)(address + 3) + address + 7);
+                }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.ProjectileOwnerOffset);
+                if (address != null)
+                {
+                    ProjectileOwnerOffset = *(int*)(address + 8);
+                }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.ProjectileAmmoInfoOffset);
+                if (address != null)
+                {
+                    ProjectileAmmoInfoOffset = *(int*)(address + 8);
+                }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.GetAsCProjectileRocketConstVFuncOffset);
+                if (address != null)
+                {
+                    s_getAsCProjectileRocketConstVFuncOffset = *(int*)(address - 7);
+                    s_getAsCProjectileConstVFuncOffset = s_getAsCProjectileRocketConstVFuncOffset - 0x10;
+                    s_getAsCProjectileThrownConstVFuncOffset = s_getAsCProjectileRocketConstVFuncOffset + 0x10;
+                }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.ProjectileRocketTargetOffset);
+                if (address != null)
+                {
+                    ProjectileRocketTargetOffset = *(int*)(address + 5);
 
-            address = MemScanner.FindPatternBmh("\x39\x70\x10\x75\x17\x40\x84\xED\x74\x09\x33\xD2\xE8", "xxxxxxxxxxxxx");
-            if (address != null)
-            {
-                s_explodeProjectileFunc = (delegate* unmanaged[Stdcall]<IntPtr, int, void>)(new IntPtr(*(int*)(address + 13) + address + 17));
-            }
+                    ProjectileRocketCachedTargetPosOffset = ProjectileRocketTargetOffset - 0x20;
+                    ProjectileRocketLaunchDirOffset = ProjectileRocketTargetOffset - 0x10;
+                    ProjectileRocketFlightModelInputPitchOffset = ProjectileRocketTargetOffset + 0x8;
+                    ProjectileRocketFlightModelInputRollOffset = ProjectileRocketTargetOffset + 0xC;
+                    ProjectileRocketFlightModelInputYawOffset = ProjectileRocketTargetOffset + 0x10;
 
-            address = MemScanner.FindPatternBmh("\x0F\x84\x8F\x00\x00\x00\x8A\x48\x28\x80\xE9\x02\x80\xF9\x03\x0F\x87\x80\x00\x00\x00\x48\x8B\x10\x48\x8B\xC8\xFF\x52", "xxxxxxxxxxxxxxxxxxxxxxxxxxxxx");
-            if (address != null)
-            {
-                // The offset is 0x78 in b2944, and one more v func addition before this func makes us have to create another memory pattern/signature
-                s_getFragInstVFuncOffset = *(sbyte*)(address + 0x1D);
-            }
-            address = MemScanner.FindPatternNaive("\x0F\xBE\x5E\x06\x48\x8B\xCF\xFF\x50\x00\x8B\xD3\x48\x8B\xC8\xE8\x00\x00\x00\x00\x8B\x4E", "xxxxxxxxx?xxxxxx????xx");
-            if (address != null)
-            {
-                s_fragInst__BreakOffAboveFunc = (delegate* unmanaged[Stdcall]<FragInst*, int, FragInst*>)(new IntPtr(*(int*)(address + 16) + address + 20));
-            }
-            address = MemScanner.FindPatternBmh("\x74\x56\x48\x8B\x0D\x00\x00\x00\x00\x41\x0F\xB7\xD0\x45\x33\xC9\x45\x33\xC0", "xxxxx????xxxxxxxxxx");
-            if (address != null)
-            {
-                s_phSimulatorInstPtr = (ulong**)(*(int*)(address + 5) + address + 9);
-            }
-            address = MemScanner.FindPatternBmh("\xC0\xE8\x07\xA8\x01\x74\x57\x0F\xB7\x4E\x18\x85\xC9\x78\x4F", "xxxxxxxxxxxxxxx");
-            if (address != null)
-            {
-                s_colliderCapacityOffset = *(int*)(address - 0x41);
-                s_colliderCountOffset = s_colliderCapacityOffset + 4;
-            }
+                    ProjectileRocketTimeBeforeHomingOffset = ProjectileRocketTargetOffset + 0x18;
+                    ProjectileRocketTimeBeforeHomingAngleBreakOffset = ProjectileRocketTargetOffset + 0x1C;
+                    ProjectileRocketLauncherSpeedOffset = ProjectileRocketTargetOffset + 0x20;
+                    ProjectileRocketTimeSinceLaunchOffset = ProjectileRocketTargetOffset + 0x24;
+                    ProjectileRocketFlagsOffset = ProjectileRocketTargetOffset + 0x30;
+                    ProjectileRocketCachedDirectionOffset = ProjectileRocketTargetOffset + 0x40;
+                }
 
-            address = MemScanner.FindPatternBmh("\x48\x8B\x1D\x00\x00\x00\x00\x48\x85\xDB\x74\x04\x48\x8B\x5B\x48", "xxx????xxxxxxxxx");
-            if (address != null)
-            {
-                InteriorProxyPtrFromGameplayCamAddress = (ulong*)(*(int*)(address + 3) + address + 7);
-                InteriorInstPtrInInteriorProxyOffset = (int)*(byte*)(address + 15);
-            }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.ExplodeProjectileFunc);
+                if (address != null)
+                {
+                    s_explodeProjectileFunc = (delegate* unmanaged[Stdcall]<IntPtr, int, void>)(new IntPtr(*(int*)(address + 13) + address + 17));
+                }
 
-            address = MemScanner.FindPatternBmh("\x8D\x43\x64\x89\x05\x00\x00\x00\x00", "xxxxx????");
-            if (address != null)
-            {
-                s_radarZoomValueAddress = (int*)(*(int*)(address + 5) + address + 9);
-            }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.GetFragInstVFuncOffset);
+                if (address != null)
+                {
+                    // The offset is 0x78 in b2944, and one more v func addition before this func makes us have to create another memory pattern/signature
+                    s_getFragInstVFuncOffset = *(sbyte*)(address + 0x1D);
+                }
+                address = MemScanner.FindPatternNaive(NativeMemoryPatterns.FragInstBreakOffAboveFunc);
+                if (address != null)
+                {
+                    s_fragInst__BreakOffAboveFunc = (delegate* unmanaged[Stdcall]<FragInst*, int, FragInst*>)(new IntPtr(*(int*)(address + 16) + address + 20));
+                }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.PhSimulatorInstPtr);
+                if (address != null)
+                {
+                    s_phSimulatorInstPtr = (ulong**)(*(int*)(address + 5) + address + 9);
+                }
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.ColliderCapacityOffset);
+                if (address != null)
+                {
+                    s_colliderCapacityOffset = *(int*)(address - 0x41);
+                    s_colliderCountOffset = s_colliderCapacityOffset + 4;
+                }
 
-            // Nopping this enables to spawn some drawable objects without a dedicated collision (e.g. prop_fan_palm_01a)
-            address = MemScanner.FindPatternBmh("\x74\x00\x00\x00\x00\x74\x00\xe8\x00\x00\x00\x00\x48\x85\xc0\x75\x00\x38\x00\x00\x0f\x84\x00\x00\x00\x00\x48\x8d\x4d\x00\xe8\x00\x00\x00\x00\x66\x89\x45\x00\x8b\x45\x00\x8b\xc8\x33\x4d", "x????x?x????xxxx?x??xx????xxx?x????xxx?xx?xxxx");
-            if (address != null)
-            {
-                address = MemScanner.FindPatternNaive("\x25\xff\xff\xff\x3f", "xxxxx", new IntPtr(address + 0x2E), 0x7c);
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.InteriorProxyPtrFromGameplayCamAddress);
+                if (address != null)
+                {
+                    InteriorProxyPtrFromGameplayCamAddress = (ulong*)(*(int*)(address + 3) + address + 7);
+                    InteriorInstPtrInInteriorProxyOffset = (int)*(byte*)(address + 15);
+                }
+
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.RadarZoomValueAddress);
+                if (address != null)
+                {
+                    s_radarZoomValueAddress = (int*)(*(int*)(address + 5) + address + 9);
+                }
 
+                // Nopping this enables to spawn some drawable objects without a dedicated collision (e.g. prop_fan_palm_01a)
+                address = MemScanner.FindPatternBmh(NativeMemoryPatterns.DrawableCollisionCheck);
                 if (address != null)
                 {
-                    address += 0x10;
+                    address = MemScanner.FindPatternNaive("\x25\xff\xff\xff\x3f", "xxxxx", new IntPtr(address + 0x2E), 0x7c);
+
+                    if (address != null)
+                    {
+                        address += 0x10;
 
-                    const int BytesToWriteInstructions = 0x18;
-                    byte[] nopBytes = Enumerable.Repeat((byte)0x90, BytesToWriteInstructions).ToArray();
-                    Marshal.Copy(nopBytes, 0, new IntPtr(address), BytesToWriteInstructions);
+                        const int BytesToWriteInstructions = 0x18;
+                        byte[] nopBytes = Enumerable.Repeat((byte)0x90, BytesToWriteInstructions).ToArray();
+                        Marshal.Copy(nopBytes, 0, new IntPtr(address), BytesToWriteInstructions);
+                    }
                 }
-            }
 
-            // Generate vehicle model list
-            var vehicleHashesGroupedByClass = new List<int>[0x20];
-            for (int i = 0; i < 0x20; i++)
-            {
-                vehicleHashesGroupedByClass[i] = new List<int>();
-            }
+                // Generate vehicle model list
+                var vehicleHashesGroupedByClass = new List<int>[0x20];
+                for (int i = 0; i < 0x20; i++)
+                {
+                    vehicleHashesGroupedByClass[i] = new List<int>();
+                }
 
-            var vehicleHashesGroupedByType = new List<int>[0x10];
-            for (int i = 0; i < 0x10; i++)
-            {
-                vehicleHashesGroupedByType[i] = new List<int>();
-            }
+                var vehicleHashesGroupedByType = new List<int>[0x10];
+                for (int i = 0; i < 0x10; i++)
+                {
+                    vehicleHashesGroupedByType[i] = new List<int>();
+                }
 
-            var weaponObjectHashes = new List<int>();
-            var pedHashes = new List<int>();
+                var weaponObjectHashes = new List<int>();
+                var pedHashes = new List<int>();
 
-            // The game will crash when it load these vehicles because of the stub vehicle models
-            var stubVehicles = new HashSet<uint> {
-                0xA71D0D4F, /* astron2 */
-                0x170341C2, /* cyclone2 */
-                0x5C54030C, /* arbitergt */
-                0x39085F47, /* ignus2 */
-                0x438F6593, /* s95 */
-            };
+                // The game will crash when it load these vehicles because of the stub vehicle models
+                var stubVehicles = new HashSet<uint> {
+                    0xA71D0D4F, /* astron2 */
+                    0x170341C2, /* cyclone2 */
+                    0x5C54030C, /* arbitergt */
+                    0x39085F47, /* ignus2 */
+                    0x438F6593, /* s95 */
+                };
 
-            if (vehicleClassOffset != 0)
-            {
-                for (int i = 0; i < s_modelHashEntries; i++)
+                if (vehicleClassOffset != 0)
                 {
-                    for (HashNode* cur = ((HashNode**)s_modelHashTable)[i]; cur != null; cur = cur->Next)
+                    for (int i = 0; i < s_modelHashEntries; i++)
                     {
-                        ushort data = cur->Data;
-                        bool bitTest = ((*(int*)(s_modelNum2 + (ulong)(4 * data >> 5))) & (1 << (data & 0x1F))) != 0;
-                        if (data >= s_modelNum1 || !bitTest)
+                        for (HashNode* cur = ((HashNode**)s_modelHashTable)[i]; cur != null; cur = cur->Next)
                         {
-                            continue;
-                        }
+                            ushort data = cur->Data;
+                            bool bitTest = ((*(int*)(s_modelNum2 + (ulong)(4 * data >> 5))) & (1 << (data & 0x1F))) != 0;
+                            if (data >= s_modelNum1 || !bitTest)
+                            {
+                                continue;
+                            }
 
-                        ulong addr1 = s_modelNum4 + s_modelNum3 * data;
-                        if (addr1 == 0)
-                        {
-                            continue;
-                        }
+                            ulong addr1 = s_modelNum4 + s_modelNum3 * data;
+                            if (addr1 == 0)
+                            {
+                                continue;
+                            }
 
-                        ulong addr2 = *(ulong*)(addr1);
-                        if (addr2 != 0)
-                        {
-                            switch ((ModelInfoType)(*(byte*)(addr2 + 157) & 0x1F))
+                            ulong addr2 = *(ulong*)(addr1);
+                            if (addr2 != 0)
                             {
-                                case ModelInfoType.Weapon:
-                                    weaponObjectHashes.Add(cur->Hash);
-                                    break;
-                                case ModelInfoType.Vehicle:
-                                    // Avoid loading stub vehicles since it will crash the game
-                                    if (stubVehicles.Contains((uint)cur->Hash))
-                                    {
-                                        continue;
-                                    }
-
-                                    vehicleHashesGroupedByClass[*(byte*)(addr2 + vehicleClassOffset) & 0x1F].Add(cur->Hash);
-
-                                    // Normalize the value to vehicle type range for b944 or later versions if current game version is earlier than b944.
-                                    // The values for CAmphibiousAutomobile and CAmphibiousQuadBike were inserted between those for CSubmarineCar and CHeli in b944.
-                                    int vehicleTypeInt = *(int*)((byte*)addr2 + s_vehicleTypeOffsetInModelInfo);
-                                    if (gameVersion < 28 && vehicleTypeInt >= 6)
-                                    {
-                                        vehicleTypeInt += 2;
-                                    }
-
-                                    vehicleHashesGroupedByType[vehicleTypeInt].Add(cur->Hash);
-
-                                    break;
-                                case ModelInfoType.Ped:
-                                    pedHashes.Add(cur->Hash);
-                                    break;
+                                switch ((ModelInfoType)(*(byte*)(addr2 + 157) & 0x1F))
+                                {
+                                    case ModelInfoType.Weapon:
+                                        weaponObjectHashes.Add(cur->Hash);
+                                        break;
+                                    case ModelInfoType.Vehicle:
+                                        // Avoid loading stub vehicles since it will crash the game
+                                        if (stubVehicles.Contains((uint)cur->Hash))
+                                        {
+                                            continue;
+                                        }
+
+                                        vehicleHashesGroupedByClass[*(byte*)(addr2 + vehicleClassOffset) & 0x1F].Add(cur->Hash);
+
+                                        // Normalize the value to vehicle type range for b944 or later versions if current game version is earlier than b944.
+                                        // The values for CAmphibiousAutomobile and CAmphibiousQuadBike were inserted between those for CSubmarineCar and CHeli in b944.
+                                        int vehicleTypeInt = *(int*)((byte*)addr2 + s_vehicleTypeOffsetInModelInfo);
+                                        if (gameVersion < 28 && vehicleTypeInt >= 6)
+                                        {
+                                            vehicleTypeInt += 2;
+                                        }
+
+                                        vehicleHashesGroupedByType[vehicleTypeInt].Add(cur->Hash);
+
+                                        break;
+                                    case ModelInfoType.Ped:
+                                        pedHashes.Add(cur->Hash);
+                                        break;
+                                }
                             }
                         }
                     }
                 }
-            }
 
-            var vehicleResult = new ReadOnlyCollection<int>[0x20];
-            for (int i = 0; i < 0x20; i++)
-            {
-                vehicleResult[i] = Array.AsReadOnly(vehicleHashesGroupedByClass[i].ToArray());
-            }
+                var vehicleResult = new ReadOnlyCollection<int>[0x20];
+                for (int i = 0; i < 0x20; i++)
+                {
+                    vehicleResult[i] = Array.AsReadOnly(vehicleHashesGroupedByClass[i].ToArray());
+                }
 
-            VehicleModels = Array.AsReadOnly(vehicleResult);
+                VehicleModels = Array.AsReadOnly(vehicleResult);
 
-            vehicleResult = new ReadOnlyCollection<int>[0x10];
-            for (int i = 0; i < 0x10; i++)
-            {
-                vehicleResult[i] = Array.AsReadOnly(vehicleHashesGroupedByType[i].ToArray());
-            }
+                vehicleResult = new ReadOnlyCollection<int>[0x10];
+                for (int i = 0; i < 0x10; i++)
+                {
+                    vehicleResult[i] = Array.AsReadOnly(vehicleHashesGroupedByType[i].ToArray());
+                }
 
-            VehicleModelsGroupedByType = Array.AsReadOnly(vehicleResult);
+                VehicleModelsGroupedByType = Array.AsReadOnly(vehicleResult);
 
-            WeaponModels = Array.AsReadOnly(weaponObjectHashes.ToArray());
-            PedModels = Array.AsReadOnly(pedHashes.ToArray());
+                WeaponModels = Array.AsReadOnly(weaponObjectHashes.ToArray());
+                PedModels = Array.AsReadOnly(pedHashes.ToArray());
+
+                EnableAllDlcVehicles(gameVersion);
+            }
+            finally
+            {
+                PatternScanCache.Close();
+            }
+        }
 
-            #region -- Enable All DLC Vehicles --
+        /// <summary>
+        /// Sets the global variable the <c>shop_controller</c> script checks to make all DLC vehicles available.
+        /// </summary>
+        private static void EnableAllDlcVehicles(int gameVersion)
+        {
             // no need to patch the global variable in v1.0.573.1 or older builds
             if (gameVersion <= 15)
             {
                 return;
             }
 
-            address = MemScanner.FindPatternBmh("\x48\x03\x15\x00\x00\x00\x00\x4C\x23\xC2\x49\x8B\x08", "xxx????xxxxxx");
+            byte* address = MemScanner.FindPatternBmh(NativeMemoryPatterns.YscScriptTable);
             if (address == null)
             {
                 return;
@@ -905,7 +936,6 @@ namespace SHVDN
                 *(int*)GetGlobalPtr(globalIndex).ToPointer() = 1;
                 break;
             }
-            #endregion
         }
 
         public static IntPtr String { get; private set; } // "~a~"
@@ -1394,9 +1424,90 @@ namespace SHVDN
 
         #region -- CPhysical Data --
 
-        public static bool IsIndexOfEntityDamageRecordValid(IntPtr entityAddress, uint index)
-        {
-            if (NativeMemory.CAttackerArrayOfEntityOffset == 0 ||
+        /// <summary>
+        /// Reads the states of entities straight from their memory in a single pass, without calling any native
+        /// function. The outputs are separate arrays per field, each of which must have room for
+        /// <paramref name="count"/> elements. Pass <see langword="null"/> for the fields that are not needed.
+        /// </summary>
+        /// <remarks>
+        /// The fields of the entities that don't exist are set to zero. Positions are read in the same way as
+        /// <c>GET_ENTITY_COORDS</c>, so peds in a vehicle get the position of the vehicle.
+        /// </remarks>
+        /// <returns>The number of entities that exist.</returns>
+        public static int ReadEntityStates(int* handles, int count, bool* exists, FVector3* positions,
+            float* headings, float* healths, float* maxHealths, int* modelHashes)
+        {
+            const float Rad2Deg = 57.2957763671875f;
+
+            int existingCount = 0;
+            int maxHealthOffset = EntityMaxHealthOffset;
+            float* entityPosition = stackalloc float[4];
+            for (int i = 0; i < count; i++)
+            {
+                ulong address = s_getScriptEntity(handles[i]);
+                if (exists != null)
+                {
+                    exists[i] = address != 0;
+                }
+                if (address == 0)
+                {
+                    if (positions != null)
+                    {
+                        positions[i] = default;
+                    }
+                    if (headings != null)
+                    {
+                        headings[i] = 0f;
+                    }
+                    if (healths != null)
+                    {
+                        healths[i] = 0f;
+                    }
+                    if (maxHealths != null)
+                    {
+                        maxHealths[i] = 0f;
+                    }
+                    if (modelHashes != null)
+                    {
+                        modelHashes[i] = 0;
+                    }
+                    continue;
+                }
+
+                existingCount++;
+
+                if (positions != null)
+                {
+                    s_entityPosFunc(address, entityPosition);
+                    positions[i] = new FVector3(entityPosition[0], entityPosition[1], entityPosition[2]);
+                }
+                if (headings != null)
+                {
+                    // Calculate from the forward vector of the matrix in the same way as GET_ENTITY_HEADING
+                    var forwardVector = (float*)(address + 0x70);
+                    float heading = (float)Math.Atan2(-forwardVector[0], forwardVector[1]) * Rad2Deg;
+                    headings[i] = heading < 0f ? heading + 360f : heading;
+                }
+                if (healths != null)
+                {
+                    healths[i] = *(float*)(address + 0x280);
+                }
+                if (maxHealths != null)
+                {
+                    maxHealths[i] = maxHealthOffset != 0 ? *(float*)(address + (uint)maxHealthOffset) : 0f;
+                }
+                if (modelHashes != null)
+                {
+                    modelHashes[i] = GetModelHashFromEntity(new IntPtr((long)address));
+                }
+            }
+
+            return existingCount;
+        }
+
+        public static bool IsIndexOfEntityDamageRecordValid(IntPtr entityAddress, uint index)
+        {
+            if (NativeMemory.CAttackerArrayOfEntityOffset == 0 ||
                 NativeMemory.ElementCountOfCAttackerArrayOfEntityOffset == 0 ||
                 NativeMemory.ElementSizeOfCAttackerArrayOfEntity == 0)
             {
@@ -2879,617 +2990,2103 @@ namespace SHVDN
         private static int s_cStreamingAppropriateVehicleIndicesOffset;
         private static int s_cStreamingAppropriatePedIndicesOffset;
 
+        private static ModelInfoIndex s_modelInfoIndex;
+
         private static IntPtr FindCModelInfo(int modelHash)
         {
-            for (HashNode* cur = ((HashNode**)s_modelHashTable)[(uint)(modelHash) % s_modelHashEntries]; cur != null; cur = cur->Next)
+            ModelInfoIndex index = GetModelInfoIndex();
+            if (index == null)
             {
-                if (cur->Hash != modelHash)
-                {
-                    continue;
-                }
-
-                ushort data = cur->Data;
-                bool bitTest = ((*(int*)(s_modelNum2 + (ulong)(4 * data >> 5))) & (1 << (data & 0x1F))) != 0;
-                if (data >= s_modelNum1 || !bitTest)
-                {
-                    continue;
-                }
-
-                ulong addr1 = s_modelNum4 + s_modelNum3 * data;
-                if (addr1 == 0)
-                {
-                    continue;
-                }
+                return IntPtr.Zero;
+            }
+            // Archetypes registered since the index was updated this tick are only in the hash table of the game
+            if (!index.TryGetRecord(modelHash, out ModelInfoRecord record))
+            {
+                return FindCModelInfoInHashTable(modelHash);
+            }
 
-                long* address = (long*)(*(ulong*)(addr1));
-                return new IntPtr(address);
+            IntPtr modelInfo = GetModelInfoBySlot(record.Slot);
+            // A slot can be freed and taken by another archetype between two updates of the index
+            if (modelInfo != IntPtr.Zero && GetModelHashFromFwArcheType(modelInfo) == modelHash)
+            {
+                return modelInfo;
             }
 
-            return IntPtr.Zero;
+            index.Invalidate();
+            return FindCModelInfoInHashTable(modelHash);
         }
 
-        private static ModelInfoType GetModelInfoType(IntPtr address)
+        private static IntPtr FindCModelInfoInHashTable(int modelHash)
         {
-            if (address != IntPtr.Zero)
-            {
-                return ((ModelInfoType)((*(byte*)((ulong)address.ToInt64() + 157) & 0x1F)));
-            }
-
-            return ModelInfoType.Invalid;
+            return TryFindModelInfoSlotInHashTable(modelHash, out ushort slot) ? GetModelInfoBySlot(slot) : IntPtr.Zero;
         }
 
-        private static VehicleType GetVehicleStructClass(IntPtr modelInfoAddress)
+        private static bool TryFindModelInfoSlotInHashTable(int modelHash, out ushort slot)
         {
-            if (GetModelInfoType(modelInfoAddress) != ModelInfoType.Vehicle)
+            for (HashNode* cur = ((HashNode**)s_modelHashTable)[(uint)(modelHash) % s_modelHashEntries]; cur != null; cur = cur->Next)
             {
-                return VehicleType.None;
-            }
-
-            int typeInt = (*(int*)((byte*)modelInfoAddress.ToPointer() + s_vehicleTypeOffsetInModelInfo));
+                if (cur->Hash != modelHash || !IsModelInfoSlotInUse(cur->Data))
+                {
+                    continue;
+                }
 
-            // Normalize the value to vehicle type range for b944 or later versions if current game version is earlier than b944.
-            // The values for CAmphibiousAutomobile and CAmphibiousQuadBike were inserted between those for CSubmarineCar and CHeli in b944.
-            if (GetGameVersion() < 28 && typeInt >= 6)
-            {
-                typeInt += 2;
+                slot = cur->Data;
+                return true;
             }
 
-            return (VehicleType)typeInt;
-
+            slot = 0;
+            return false;
         }
-        public static int GetVehicleType(int modelHash)
-        {
-            IntPtr modelInfo = FindCModelInfo(modelHash);
-
-            if (modelInfo == IntPtr.Zero)
-            {
-                return -1;
-            }
 
-            return (int)GetVehicleStructClass(modelInfo);
+        private static bool IsModelInfoSlotInUse(ushort slot)
+        {
+            return slot < s_modelNum1 && ((*(int*)(s_modelNum2 + (ulong)(4 * slot >> 5))) & (1 << (slot & 0x1F))) != 0;
         }
 
-        private static IntPtr GetModelInfo(IntPtr entityAddress)
+        private static IntPtr GetModelInfoBySlot(ushort slot)
         {
-            if (entityAddress != IntPtr.Zero)
+            ulong addr1 = s_modelNum4 + s_modelNum3 * slot;
+            if (addr1 == 0)
             {
-                return new IntPtr(*(long*)((ulong)entityAddress.ToInt64() + 0x20));
+                return IntPtr.Zero;
             }
 
-            return IntPtr.Zero;
+            return new IntPtr(*(long*)addr1);
         }
 
-        private static int GetModelHashFromFwArcheType(IntPtr fwArcheTypeAddress)
+        /// <summary>
+        /// Gets the index of the registered model infos, which is brought up to date with the slots in use once per
+        /// tick.
+        /// </summary>
+        private static ModelInfoIndex GetModelInfoIndex()
         {
-            if (fwArcheTypeAddress != IntPtr.Zero)
+            if (s_modelHashTable == 0 || s_modelNum2 == 0 || s_modelNum1 == 0)
             {
-                return (*(int*)((ulong)fwArcheTypeAddress.ToInt64() + 0x18));
+                return null;
             }
 
-            return 0;
-        }
-        public static int GetModelHashFromEntity(IntPtr entityAddress)
-        {
-            if (entityAddress == IntPtr.Zero)
+            ModelInfoIndex index = s_modelInfoIndex;
+            uint tickStamp = TickStamp;
+            if (index != null && index.CheckedTickStamp == tickStamp)
             {
-                return 0;
+                return index;
             }
 
-            IntPtr modelInfoAddress = GetModelInfo(entityAddress);
-            if (modelInfoAddress != IntPtr.Zero)
+            if (index == null)
             {
-                return GetModelHashFromFwArcheType(modelInfoAddress);
+                index = new ModelInfoIndex();
+                s_modelInfoIndex = index;
             }
+            index.Update();
+            index.CheckedTickStamp = tickStamp;
 
-            return 0;
+            return index;
         }
 
-        private static bool IsFwArcheTypeAFragment(IntPtr fwArcheTypeAddress)
+        private static bool TryGetModelInfoRecord(int modelHash, out ModelInfoRecord record)
         {
-            if (fwArcheTypeAddress != IntPtr.Zero)
-            {
-                // The game can't draw fragment entities properly if this value is not 1
-                return (*(byte*)((ulong)fwArcheTypeAddress.ToInt64() + 0x60) == 1);
-            }
-
-            return false;
+            return TryGetModelInfoRecord(GetModelInfoIndex(), modelHash, out record);
         }
-        public static bool IsModelAFragment(int modelHash)
+
+        private static bool TryGetModelInfoRecord(ModelInfoIndex index, int modelHash, out ModelInfoRecord record)
         {
-            IntPtr modelInfo = FindCModelInfo(modelHash);
-            if (modelInfo == IntPtr.Zero)
+            if (index == null)
             {
+                record = default;
                 return false;
             }
 
-            return IsFwArcheTypeAFragment(modelInfo);
+            return index.TryGetRecord(modelHash, out record)
+                || ModelInfoIndex.TryCreateRecordFromHashTable(modelHash, GetGameVersion(), out record);
         }
 
-        private static IntPtr GetModelInfoByIndex(uint index)
-        {
-            if (s_modelInfoArrayPtr == null || index < 0)
-            {
-                return IntPtr.Zero;
-            }
-
-            ulong modelInfoArrayFirstElemPtr = *s_modelInfoArrayPtr;
-
-            return new IntPtr(*(long*)(modelInfoArrayFirstElemPtr + index * 0x8));
-        }
-        public static List<int> GetLoadedAppropriateVehicleHashes()
-        {
-            return GetLoadedHashesOfModelList(s_cStreamingAppropriateVehicleIndicesOffset);
-        }
-        public static List<int> GetLoadedAppropriatePedHashes()
+        /// <summary>
+        /// The properties of a model info the model queries need, packed so a query doesn't have to read the model info.
+        /// </summary>
+        private struct ModelInfoRecord
         {
-            return GetLoadedHashesOfModelList(s_cStreamingAppropriatePedIndicesOffset);
+            public int Hash;
+            // Zero for an unused record of the index, since every model info gets the Exists flag
+            public ModelClassFlags Classes;
+            public ModelInfoType Type;
+            public ushort Slot;
+            public sbyte VehicleType;
         }
-        internal static List<int> GetLoadedHashesOfModelList(int startOffsetOfCStreaming)
+
+        /// <summary>
+        /// A flat open addressing table of the registered model infos keyed by model hash, which replaces walking the
+        /// chained model hash table of the game for every model query.
+        /// </summary>
+        /// <remarks>
+        /// The index keeps a copy of the bitmap of the model info slots in use, and only updates the records of the
+        /// slots whose part of the bitmap changed, so registering a few archetypes doesn't rebuild the whole table.
+        /// Queries can come from any script thread, so the table is only read and updated with a lock held.
+        /// </remarks>
+        private sealed class ModelInfoIndex
         {
-            if (s_modelInfoArrayPtr == null || s_cStreamingAddr == null)
-            {
-                return new List<int>();
-            }
+            private readonly object _lock = new();
+            private ModelInfoRecord[] _records;
+            private int _mask;
+            private int _count;
+            // A copy of the bitmap of the model info slots in use as of the last update
+            private byte[] _slotBitmap;
+            // The model hash of the model info in each slot as of the last update, or 0 if the slot had none
+            private int[] _slotHashes;
+            // The hashes of the ped models whose personality was not loaded yet, so their personality flags are missing
+            private readonly HashSet<int> _incompleteHashes = new();
+            // The ped personality array as of the last time the incomplete records were created
+            private ulong _pedPersonalitiesArray;
+            private bool _isInvalidated = true;
 
-            var resultList = new List<int>();
+            internal uint CheckedTickStamp;
 
-            const int MaxModelListElementCount = 256;
-            var modelSet = (CModelList*)((ulong)s_cStreamingAddr + (uint)startOffsetOfCStreaming);
-            for (uint i = 0; i < MaxModelListElementCount; i++)
+            internal bool TryGetRecord(int modelHash, out ModelInfoRecord record)
             {
-                uint indexOfModelInfo = modelSet->ModelMemberIndices[i];
-
-                if (indexOfModelInfo == 0xFFFF)
+                lock (_lock)
                 {
-                    break;
+                    return TryGetRecordLocked(modelHash, out record);
                 }
-
-                resultList.Add(GetModelHashFromFwArcheType(GetModelInfoByIndex(indexOfModelInfo)));
             }
 
-            return resultList;
-        }
+            /// <summary>
+            /// Classifies many models with the lock taken once, falling back to the hash table of the game for models
+            /// not in the index the same way <see cref="TryGetModelInfoRecord(ModelInfoIndex, int, out ModelInfoRecord)"/>
+            /// does.
+            /// </summary>
+            internal int ClassifyModels(int* modelHashes, int count, ModelClassFlags* classes, int* vehicleTypes)
+            {
+                int gameVersion = GetGameVersion();
+                int existingCount = 0;
 
+                lock (_lock)
+                {
+                    for (int i = 0; i < count; i++)
+                    {
+                        int modelHash = modelHashes[i];
+                        if (TryGetRecordLocked(modelHash, out ModelInfoRecord record)
+                            || TryCreateRecordFromHashTable(modelHash, gameVersion, out record))
+                        {
+                            existingCount++;
+                        }
+                        else
+                        {
+                            record.VehicleType = (sbyte)VehicleType.None;
+                        }
 
-        public static bool IsModelAPed(int modelHash)
-        {
-            IntPtr modelInfo = FindCModelInfo(modelHash);
-            return GetModelInfoType(modelInfo) == ModelInfoType.Ped;
-        }
-        public static bool IsModelABlimp(int modelHash)
-        {
-            IntPtr modelInfo = FindCModelInfo(modelHash);
-            return GetVehicleStructClass(modelInfo) == VehicleType.Blimp;
-        }
-        public static bool IsModelAMotorcycle(int modelHash)
-        {
-            IntPtr modelInfo = FindCModelInfo(modelHash);
-            return GetVehicleStructClass(modelInfo) == VehicleType.Bike;
-        }
-        public static bool IsModelASubmarine(int modelHash)
-        {
-            IntPtr modelInfo = FindCModelInfo(modelHash);
-            return GetVehicleStructClass(modelInfo) == VehicleType.Submarine;
-        }
-        public static bool IsModelASubmarineCar(int modelHash)
-        {
-            IntPtr modelInfo = FindCModelInfo(modelHash);
-            return GetVehicleStructClass(modelInfo) == VehicleType.SubmarineCar;
-        }
-        public static bool IsModelATrailer(int modelHash)
-        {
-            IntPtr modelInfo = FindCModelInfo(modelHash);
-            return GetVehicleStructClass(modelInfo) == VehicleType.Trailer;
-        }
-        public static bool IsModelAMlo(int modelHash)
-        {
-            IntPtr modelInfo = FindCModelInfo(modelHash);
-            return GetModelInfoType(modelInfo) == ModelInfoType.Mlo;
-        }
+                        if (classes != null)
+                        {
+                            classes[i] = record.Classes;
+                        }
+                        if (vehicleTypes != null)
+                        {
+                            vehicleTypes[i] = record.VehicleType;
+                        }
+                    }
+                }
 
-        public static string GetVehicleMakeName(int modelHash)
-        {
-            IntPtr modelInfo = FindCModelInfo(modelHash);
+                return existingCount;
+            }
 
-            if (GetModelInfoType(modelInfo) == ModelInfoType.Vehicle)
+            /// <summary>
+            /// Creates the record of a model from the hash table of the game, for archetypes registered since the index
+            /// was updated this tick.
+            /// </summary>
+            internal static bool TryCreateRecordFromHashTable(int modelHash, int gameVersion, out ModelInfoRecord record)
             {
-                return StringMarshal.PtrToStringUtf8(modelInfo + s_vehicleMakeNameOffsetInModelInfo);
-            }
+                record = default;
+                if (!TryFindModelInfoSlotInHashTable(modelHash, out ushort slot))
+                {
+                    return false;
+                }
 
-            return "CARNOTFOUND";
-        }
+                IntPtr modelInfo = GetModelInfoBySlot(slot);
+                if (modelInfo == IntPtr.Zero)
+                {
+                    return false;
+                }
 
-        public static bool HasVehicleFlag(int modelHash, VehicleFlags flag) => HasVehicleFlagInternal(modelHash, (ulong)flag, 0x0);
-        public static bool HasVehicleFlag(int modelHash, VehicleModelInfoFlags flag) => HasVehicleFlagInternal(modelHash, (ulong)flag, 0x8);
-        private static bool HasVehicleFlagInternal(int modelHash, ulong flag, int flagOffset)
-        {
-            if (Vehicle.FirstVehicleFlagsOffset == 0)
-            {
-                return false;
+                bool isIncomplete = false;
+                record = CreateRecord(modelHash, slot, modelInfo, gameVersion, ref isIncomplete);
+                return true;
             }
 
-            IntPtr modelInfo = FindCModelInfo(modelHash);
+            private bool TryGetRecordLocked(int modelHash, out ModelInfoRecord record)
+            {
+                ModelInfoRecord[] records = _records;
+                // Model hashes are already well distributed, so the lower bits can be used as they are
+                for (int position = modelHash & _mask; ; position = (position + 1) & _mask)
+                {
+                    ref ModelInfoRecord current = ref records[position];
+                    if (current.Classes == ModelClassFlags.None)
+                    {
+                        record = default;
+                        return false;
+                    }
+                    if (current.Hash == modelHash)
+                    {
+                        record = current;
+                        return true;
+                    }
+                }
+            }
 
-            if (GetModelInfoType(modelInfo) != ModelInfoType.Vehicle)
+            /// <summary>
+            /// Makes the index be rebuilt on the next update, rather than right away so a model that keeps failing the
+            /// check doesn't make every query rebuild it.
+            /// </summary>
+            internal void Invalidate()
             {
-                return false;
+                _isInvalidated = true;
             }
 
-            ulong modelFlags = *(ulong*)(modelInfo + Vehicle.FirstVehicleFlagsOffset + flagOffset).ToPointer();
-            return (modelFlags & flag) != 0;
-        }
+            /// <summary>
+            /// Brings the index up to date with the model info slots in use, by updating the records of the slots
+            /// whose part of the bitmap changed since the last update.
+            /// </summary>
+            internal void Update()
+            {
+                lock (_lock)
+                {
+                    int bitmapSize = GetSlotBitmapSize();
+                    if (_isInvalidated || _slotBitmap.Length != bitmapSize || _slotHashes.Length != s_modelNum1)
+                    {
+                        Rebuild();
+                        return;
+                    }
 
-        public static ReadOnlyCollection<int> WeaponModels { get; }
-        public static ReadOnlyCollection<ReadOnlyCollection<int>> VehicleModels { get; }
-        public static ReadOnlyCollection<ReadOnlyCollection<int>> VehicleModelsGroupedByType { get; }
+                    var bitmap = (byte*)s_modelNum2;
+                    fixed (byte* copy = _slotBitmap)
+                    {
+                        int i = 0;
+                        for (; i + 8 <= bitmapSize; i += 8)
+                        {
+                            if (*(ulong*)(bitmap + i) != *(ulong*)(copy + i))
+                            {
+                                *(ulong*)(copy + i) = *(ulong*)(bitmap + i);
+                                UpdateSlotsReadingBytes(i, 8);
+                            }
+                        }
+                        for (; i < bitmapSize; i++)
+                        {
+                            if (bitmap[i] != copy[i])
+                            {
+                                copy[i] = bitmap[i];
+                                UpdateSlotsReadingBytes(i, 1);
+                            }
+                        }
+                    }
+
+                    // The personality of a ped model is missing only while the personality array is not loaded, so
+                    // the incomplete records are only created again once the array changes
+                    ulong pedPersonalitiesArray = GetPedPersonalitiesArray();
+                    if (_incompleteHashes.Count > 0 && pedPersonalitiesArray != _pedPersonalitiesArray)
+                    {
+                        _pedPersonalitiesArray = pedPersonalitiesArray;
+                        var incompleteHashes = new int[_incompleteHashes.Count];
+                        _incompleteHashes.CopyTo(incompleteHashes);
+                        _incompleteHashes.Clear();
+                        foreach (int modelHash in incompleteHashes)
+                        {
+                            RefreshRecord(modelHash);
+                        }
+                    }
+
+                    // Keep the load factor at 0.75 at most, so probe sequences stay short
+                    if (_count * 4 > _records.Length * 3)
+                    {
+                        Rebuild();
+                    }
+                }
+            }
+
+            private void Rebuild()
+            {
+                int modelCount = 0;
+                for (int i = 0; i < s_modelHashEntries; i++)
+                {
+                    for (HashNode* cur = ((HashNode**)s_modelHashTable)[i]; cur != null; cur = cur->Next)
+                    {
+                        modelCount++;
+                    }
+                }
+
+                // Start at a load factor of 0.5 at most, so archetypes can be registered for a long time before the
+                // table has to grow
+                int capacity = 16;
+                while (capacity < modelCount * 2)
+                {
+                    capacity <<= 1;
+                }
+
+                if (_records == null || _records.Length != capacity)
+                {
+                    _records = new ModelInfoRecord[capacity];
+                }
+                else
+                {
+                    Array.Clear(_records, 0, _records.Length);
+                }
+                _mask = capacity - 1;
+                _count = 0;
+
+                if (_slotHashes == null || _slotHashes.Length != s_modelNum1)
+                {
+                    _slotHashes = new int[s_modelNum1];
+                }
+                else
+                {
+                    Array.Clear(_slotHashes, 0, _slotHashes.Length);
+                }
+
+                int bitmapSize = GetSlotBitmapSize();
+                if (_slotBitmap == null || _slotBitmap.Length != bitmapSize)
+                {
+                    _slotBitmap = new byte[bitmapSize];
+                }
+                Marshal.Copy(new IntPtr((long)s_modelNum2), _slotBitmap, 0, bitmapSize);
+
+                _incompleteHashes.Clear();
+                _pedPersonalitiesArray = GetPedPersonalitiesArray();
+                _isInvalidated = false;
+
+                int gameVersion = GetGameVersion();
+                for (int i = 0; i < s_modelHashEntries; i++)
+                {
+                    for (HashNode* cur = ((HashNode**)s_modelHashTable)[i]; cur != null; cur = cur->Next)
+                    {
+                        if (!IsModelInfoSlotInUse(cur->Data))
+                        {
+                            continue;
+                        }
+
+                        IntPtr modelInfo = GetModelInfoBySlot(cur->Data);
+                        if (modelInfo == IntPtr.Zero)
+                        {
+                            continue;
+                        }
+
+                        _slotHashes[cur->Data] = GetModelHashFromFwArcheType(modelInfo);
+                        // Nodes of the same bucket are visited in the order FindCModelInfoInHashTable visits them, so
+                        // the first node in use wins as it does there
+                        if (!ContainsRecord(cur->Hash))
+                        {
+                            AddRecord(cur->Hash, cur->Data, modelInfo, gameVersion);
+                        }
+                    }
+                }
+            }
+
+            /// <summary>
+            /// Updates the records of the slots <see cref="IsModelInfoSlotInUse(ushort)"/> reads the changed bytes of the
+            /// bitmap for. It reads 4 bytes starting at the byte of the slot, so a byte is read for the slots of the 3
+            /// bytes before it as well.
+            /// </summary>
+            private void UpdateSlotsReadingBytes(int offset, int length)
+            {
+                int firstSlot = Math.Max(offset - 3, 0) * 8;
+                int lastSlot = Math.Min((offset + length) * 8, (int)s_modelNum1) - 1;
+                for (int slot = firstSlot; slot <= lastSlot; slot++)
+                {
+                    UpdateSlot((ushort)slot);
+                }
+            }
+
+            private void UpdateSlot(ushort slot)
+            {
+                int newHash = 0;
+                if (IsModelInfoSlotInUse(slot))
+                {
+                    IntPtr modelInfo = GetModelInfoBySlot(slot);
+                    if (modelInfo != IntPtr.Zero)
+                    {
+                        newHash = GetModelHashFromFwArcheType(modelInfo);
+                    }
+                }
+
+                int oldHash = _slotHashes[slot];
+                if (newHash == oldHash)
+                {
+                    return;
+                }
+
+                _slotHashes[slot] = newHash;
+                if (oldHash != 0)
+                {
+                    RefreshRecord(oldHash);
+                }
+                if (newHash != 0)
+                {
+                    RefreshRecord(newHash);
+                }
+            }
+
+            /// <summary>
+            /// Replaces the record of a model hash with the model info the hash table of the game finds for it now.
+            /// </summary>
+            private void RefreshRecord(int modelHash)
+            {
+                RemoveRecord(modelHash);
+
+                if (!TryFindModelInfoSlotInHashTable(modelHash, out ushort slot))
+                {
+                    return;
+                }
+
+                IntPtr modelInfo = GetModelInfoBySlot(slot);
+                if (modelInfo != IntPtr.Zero)
+                {
+                    AddRecord(modelHash, slot, modelInfo, GetGameVersion());
+                }
+            }
+
+            private bool ContainsRecord(int modelHash)
+            {
+                return FindPosition(modelHash) >= 0;
+            }
+
+            private int FindPosition(int modelHash)
+            {
+                for (int position = modelHash & _mask; ; position = (position + 1) & _mask)
+                {
+                    if (_records[position].Classes == ModelClassFlags.None)
+                    {
+                        return -1;
+                    }
+                    if (_records[position].Hash == modelHash)
+                    {
+                        return position;
+                    }
+                }
+            }
+
+            private void AddRecord(int modelHash, ushort slot, IntPtr modelInfo, int gameVersion)
+            {
+                int position = modelHash & _mask;
+                while (_records[position].Classes != ModelClassFlags.None)
+                {
+                    position = (position + 1) & _mask;
+                }
+
+                bool isIncomplete = false;
+                _records[position] = CreateRecord(modelHash, slot, modelInfo, gameVersion, ref isIncomplete);
+                _count++;
+
+                if (isIncomplete)
+                {
+                    _incompleteHashes.Add(modelHash);
+                }
+            }
+
+            private void RemoveRecord(int modelHash)
+            {
+                int position = FindPosition(modelHash);
+                if (position < 0)
+                {
+                    return;
+                }
+
+                // Shift the following records of the probe sequence back, so no probe stops at the removed record
+                // before reaching them
+                int next = position;
+                while (true)
+                {
+                    next = (next + 1) & _mask;
+                    if (_records[next].Classes == ModelClassFlags.None)
+                    {
+                        break;
+                    }
+
+                    int home = _records[next].Hash & _mask;
+                    // The record can move to the hole if its home position is not cyclically after the hole
+                    bool canMove = position <= next
+                        ? home <= position || home > next
+                        : home <= position && home > next;
+                    if (canMove)
+                    {
+                        _records[position] = _records[next];
+                        position = next;
+                    }
+                }
+
+                _records[position] = default;
+                _count--;
+            }
+
+            private static ulong GetPedPersonalitiesArray()
+            {
+                return s_pedPersonalitiesArrayAddr != null ? *s_pedPersonalitiesArrayAddr : 0;
+            }
+
+            private static int GetSlotBitmapSize()
+            {
+                // The bytes IsModelInfoSlotInUse reads for the slots below the slot count
+                return (int)((s_modelNum1 - 1) >> 3) + 4;
+            }
+
+            internal static ModelInfoRecord CreateRecord(int modelHash, ushort slot, IntPtr modelInfo, int gameVersion, ref bool isIncomplete)
+            {
+                var record = new ModelInfoRecord
+                {
+                    Hash = modelHash,
+                    Slot = slot,
+                    Type = GetModelInfoType(modelInfo),
+                    VehicleType = (sbyte)VehicleType.None,
+                    Classes = ModelClassFlags.Exists,
+                };
+
+                if (IsFwArcheTypeAFragment(modelInfo))
+                {
+                    record.Classes |= ModelClassFlags.Fragment;
+                }
+
+                switch (record.Type)
+                {
+                    case ModelInfoType.Object:
+                        record.Classes |= ModelClassFlags.Object;
+                        break;
+                    case ModelInfoType.Mlo:
+                        record.Classes |= ModelClassFlags.Mlo;
+                        break;
+                    case ModelInfoType.Time:
+                        record.Classes |= ModelClassFlags.Time;
+                        break;
+                    case ModelInfoType.Weapon:
+                        record.Classes |= ModelClassFlags.Weapon;
+                        break;
+                    case ModelInfoType.Vehicle:
+                        record.Classes |= ModelClassFlags.Vehicle;
+
+                        int vehicleTypeInt = *(int*)((byte*)modelInfo.ToPointer() + s_vehicleTypeOffsetInModelInfo);
+                        // Normalize the value to vehicle type range for b944 or later versions if current game version is earlier than b944.
+                        if (gameVersion < 28 && vehicleTypeInt >= 6)
+                        {
+                            vehicleTypeInt += 2;
+                        }
+                        record.VehicleType = (sbyte)vehicleTypeInt;
+                        break;
+                    case ModelInfoType.Ped:
+                        record.Classes |= ModelClassFlags.Ped;
+
+                        PersonalityData* personality = GetModelPersonalityDataAddress(modelInfo);
+                        if (personality == null)
+                        {
+                            isIncomplete |= s_pedPersonalitiesArrayAddr != null && s_pedPersonalityIndexOffsetInModelInfo != 0;
+                            break;
+                        }
+
+                        record.Classes |= personality->IsMale ? ModelClassFlags.MalePed : ModelClassFlags.FemalePed;
+                        record.Classes |= personality->IsHuman ? ModelClassFlags.HumanPed : ModelClassFlags.AnimalPed;
+                        if (personality->IsGang)
+                        {
+                            record.Classes |= ModelClassFlags.GangPed;
+                        }
+                        break;
+                }
+
+                return record;
+            }
+        }
+
+        private static ModelInfoType GetModelInfoType(IntPtr address)
+        {
+            if (address != IntPtr.Zero)
+            {
+                return ((ModelInfoType)((*(byte*)((ulong)address.ToInt64() + 157) & 0x1F)));
+            }
+
+            return ModelInfoType.Invalid;
+        }
+
+        private static VehicleType GetVehicleStructClass(int modelHash)
+        {
+            if (!TryGetModelInfoRecord(modelHash, out ModelInfoRecord record))
+            {
+                return VehicleType.None;
+            }
+
+            return (VehicleType)record.VehicleType;
+        }
+        public static int GetVehicleType(int modelHash)
+        {
+            return (int)GetVehicleStructClass(modelHash);
+        }
+
+        private static IntPtr GetModelInfo(IntPtr entityAddress)
+        {
+            if (entityAddress != IntPtr.Zero)
+            {
+                return new IntPtr(*(long*)((ulong)entityAddress.ToInt64() + 0x20));
+            }
+
+            return IntPtr.Zero;
+        }
+
+        private static int GetModelHashFromFwArcheType(IntPtr fwArcheTypeAddress)
+        {
+            if (fwArcheTypeAddress != IntPtr.Zero)
+            {
+                return (*(int*)((ulong)fwArcheTypeAddress.ToInt64() + 0x18));
+            }
+
+            return 0;
+        }
+        public static int GetModelHashFromEntity(IntPtr entityAddress)
+        {
+            if (entityAddress == IntPtr.Zero)
+            {
+                return 0;
+            }
+
+            IntPtr modelInfoAddress = GetModelInfo(entityAddress);
+            if (modelInfoAddress != IntPtr.Zero)
+            {
+                return GetModelHashFromFwArcheType(modelInfoAddress);
+            }
+
+            return 0;
+        }
+
+        private static bool IsFwArcheTypeAFragment(IntPtr fwArcheTypeAddress)
+        {
+            if (fwArcheTypeAddress != IntPtr.Zero)
+            {
+                // The game can't draw fragment entities properly if this value is not 1
+                return (*(byte*)((ulong)fwArcheTypeAddress.ToInt64() + 0x60) == 1);
+            }
+
+            return false;
+        }
+        public static bool IsModelAFragment(int modelHash)
+        {
+            return HasModelClassFlag(modelHash, ModelClassFlags.Fragment);
+        }
+
+        private static IntPtr GetModelInfoByIndex(uint index)
+        {
+            if (s_modelInfoArrayPtr == null || index < 0)
+            {
+                return IntPtr.Zero;
+            }
+
+            ulong modelInfoArrayFirstElemPtr = *s_modelInfoArrayPtr;
+
+            return new IntPtr(*(long*)(modelInfoArrayFirstElemPtr + index * 0x8));
+        }
+        public static List<int> GetLoadedAppropriateVehicleHashes()
+        {
+            return GetLoadedHashesOfModelList(s_cStreamingAppropriateVehicleIndicesOffset);
+        }
+        public static List<int> GetLoadedAppropriatePedHashes()
+        {
+            return GetLoadedHashesOfModelList(s_cStreamingAppropriatePedIndicesOffset);
+        }
+        internal static List<int> GetLoadedHashesOfModelList(int startOffsetOfCStreaming)
+        {
+            if (s_modelInfoArrayPtr == null || s_cStreamingAddr == null)
+            {
+                return new List<int>();
+            }
+
+            var resultList = new List<int>();
+
+            const int MaxModelListElementCount = 256;
+            var modelSet = (CModelList*)((ulong)s_cStreamingAddr + (uint)startOffsetOfCStreaming);
+            for (uint i = 0; i < MaxModelListElementCount; i++)
+            {
+                uint indexOfModelInfo = modelSet->ModelMemberIndices[i];
+
+                if (indexOfModelInfo == 0xFFFF)
+                {
+                    break;
+                }
+
+                resultList.Add(GetModelHashFromFwArcheType(GetModelInfoByIndex(indexOfModelInfo)));
+            }
+
+            return resultList;
+        }
+
+
+        private static bool HasModelClassFlag(int modelHash, ModelClassFlags flag)
+        {
+            return TryGetModelInfoRecord(modelHash, out ModelInfoRecord record) && (record.Classes & flag) != 0;
+        }
+
+        /// <summary>
+        /// Classifies many models at once with a single lookup in the model info index per model.
+        /// </summary>
+        /// <param name="modelHashes">The model hashes to classify.</param>
+        /// <param name="count">The number of model hashes.</param>
+        /// <param name="classes">
+        /// The array to write the classes of the models to, or <see langword="null"/> if they are not needed.
+        /// Models that don't exist get <see cref="ModelClassFlags.None"/>.
+        /// </param>
+        /// <param name="vehicleTypes">
+        /// The array to write the vehicle types of the models to the same way as <see cref="GetVehicleType(int)"/>,
+        /// or <see langword="null"/> if they are not needed.
+        /// </param>
+        /// <returns>The number of models that exist.</returns>
+        public static int ClassifyModels(int* modelHashes, int count, ModelClassFlags* classes, int* vehicleTypes)
+        {
+            ModelInfoIndex index = GetModelInfoIndex();
+            if (index != null)
+            {
+                return index.ClassifyModels(modelHashes, count, classes, vehicleTypes);
+            }
+
+            for (int i = 0; i < count; i++)
+            {
+                if (classes != null)
+                {
+                    classes[i] = ModelClassFlags.None;
+                }
+                if (vehicleTypes != null)
+                {
+                    vehicleTypes[i] = (int)VehicleType.None;
+                }
+            }
+
+            return 0;
+        }
+
+        public static bool IsModelAPed(int modelHash)
+        {
+            return HasModelClassFlag(modelHash, ModelClassFlags.Ped);
+        }
+        public static bool IsModelABlimp(int modelHash)
+        {
+            return GetVehicleStructClass(modelHash) == VehicleType.Blimp;
+        }
+        public static bool IsModelAMotorcycle(int modelHash)
+        {
+            return GetVehicleStructClass(modelHash) == VehicleType.Bike;
+        }
+        public static bool IsModelASubmarine(int modelHash)
+        {
+            return GetVehicleStructClass(modelHash) == VehicleType.Submarine;
+        }
+        public static bool IsModelASubmarineCar(int modelHash)
+        {
+            return GetVehicleStructClass(modelHash) == VehicleType.SubmarineCar;
+        }
+        public static bool IsModelATrailer(int modelHash)
+        {
+            return GetVehicleStructClass(modelHash) == VehicleType.Trailer;
+        }
+        public static bool IsModelAMlo(int modelHash)
+        {
+            return HasModelClassFlag(modelHash, ModelClassFlags.Mlo);
+        }
+
+        public static string GetVehicleMakeName(int modelHash)
+        {
+            IntPtr modelInfo = FindCModelInfo(modelHash);
+
+            if (GetModelInfoType(modelInfo) == ModelInfoType.Vehicle)
+            {
+                return StringMarshal.PtrToStringUtf8(modelInfo + s_vehicleMakeNameOffsetInModelInfo);
+            }
+
+            return "CARNOTFOUND";
+        }
+
+        public static bool HasVehicleFlag(int modelHash, VehicleFlags flag) => HasVehicleFlagInternal(modelHash, (ulong)flag, 0x0);
+        public static bool HasVehicleFlag(int modelHash, VehicleModelInfoFlags flag) => HasVehicleFlagInternal(modelHash, (ulong)flag, 0x8);
+        private static bool HasVehicleFlagInternal(int modelHash, ulong flag, int flagOffset)
+        {
+            if (Vehicle.FirstVehicleFlagsOffset == 0)
+            {
+                return false;
+            }
+
+            // The flags can be changed at runtime, so they are read from the model info rather than the index
+            IntPtr modelInfo = FindCModelInfo(modelHash);
+
+            if (GetModelInfoType(modelInfo) != ModelInfoType.Vehicle)
+            {
+                return false;
+            }
+
+            ulong modelFlags = *(ulong*)(modelInfo + Vehicle.FirstVehicleFlagsOffset + flagOffset).ToPointer();
+            return (modelFlags & flag) != 0;
+        }
+
+        public static ReadOnlyCollection<int> WeaponModels { get; }
+        public static ReadOnlyCollection<ReadOnlyCollection<int>> VehicleModels { get; }
+        public static ReadOnlyCollection<ReadOnlyCollection<int>> VehicleModelsGroupedByType { get; }
         public static ReadOnlyCollection<int> PedModels { get; }
 
 
-        private static delegate* unmanaged[Stdcall]<IntPtr, ulong> s_getHandlingDataByHash;
-        private static delegate* unmanaged[Stdcall]<int, ulong> s_getHandlingDataByIndex;
+        private static delegate* unmanaged[Stdcall]<IntPtr, ulong> s_getHandlingDataByHash;
+        private static delegate* unmanaged[Stdcall]<int, ulong> s_getHandlingDataByIndex;
+
+        public static IntPtr GetHandlingDataByModelHash(int modelHash)
+        {
+            IntPtr modelInfo = FindCModelInfo(modelHash);
+            if (GetModelInfoType(modelInfo) != ModelInfoType.Vehicle)
+            {
+                return IntPtr.Zero;
+            }
+
+            int handlingIndex = *(int*)(modelInfo + s_handlingIndexOffsetInModelInfo).ToPointer();
+            return new IntPtr((long)s_getHandlingDataByIndex(handlingIndex));
+        }
+        public static IntPtr GetHandlingDataByHandlingNameHash(int handlingNameHash)
+        {
+            return new IntPtr((long)s_getHandlingDataByHash(new IntPtr(&handlingNameHash)));
+        }
+
+        private static PersonalityData* GetModelPersonalityDataAddress(IntPtr modelInfoAddress)
+        {
+            if (modelInfoAddress == IntPtr.Zero ||
+                s_pedPersonalitiesArrayAddr == null ||
+                s_pedPersonalityIndexOffsetInModelInfo == 0 ||
+                *(ulong*)s_pedPersonalitiesArrayAddr == 0)
+            {
+                return null;
+            }
+
+            if (GetModelInfoType(modelInfoAddress) != ModelInfoType.Ped)
+            {
+                return null;
+            }
+
+            // This values is not likely to be changed in further updates
+            const int PedPersonalityElementSize = 0xB8;
+
+            ushort indexOfPedPersonality = *(ushort*)(modelInfoAddress + s_pedPersonalityIndexOffsetInModelInfo).ToPointer();
+            return (PersonalityData*)(*(ulong*)s_pedPersonalitiesArrayAddr + (uint)(indexOfPedPersonality * PedPersonalityElementSize));
+        }
+        public static bool IsModelAMalePed(int modelHash)
+        {
+            return HasModelClassFlag(modelHash, ModelClassFlags.MalePed);
+        }
+        public static bool IsModelAFemalePed(int modelHash)
+        {
+            return HasModelClassFlag(modelHash, ModelClassFlags.FemalePed);
+        }
+        public static bool IsModelHumanPed(int modelHash)
+        {
+            return HasModelClassFlag(modelHash, ModelClassFlags.HumanPed);
+        }
+        public static bool IsModelAnAnimalPed(int modelHash)
+        {
+            return HasModelClassFlag(modelHash, ModelClassFlags.AnimalPed);
+        }
+        public static bool IsModelAGangPed(int modelHash)
+        {
+            return HasModelClassFlag(modelHash, ModelClassFlags.GangPed);
+        }
+
+        #endregion
+
+        #region -- Entity Pools --
+
+        private static ulong* s_fwScriptGuidPoolAddress;
+        private static ulong* s_pedPoolAddress;
+        private static ulong* s_objectPoolAddress;
+        private static ulong* s_pickupObjectPoolAddress;
+        private static ulong* s_vehiclePoolAddress;
+        private static ulong* s_buildingPoolAddress;
+        private static ulong* s_animatedBuildingPoolAddress;
+        private static ulong* s_interiorInstPoolAddress;
+        private static ulong* s_interiorProxyPoolAddress;
+
+        private static ulong* s_projectilePoolAddress;
+        private static int* s_projectileCountAddress;
+
+        // if the entity is a ped and they are in a vehicle, the vehicle position will be returned instead (just like GET_ENTITY_COORDS does)
+        private static delegate* unmanaged[Stdcall]<ulong, float*, ulong> s_entityPosFunc;
+        // should be rage::fwScriptGuid::CreateGuid
+        private static delegate* unmanaged[Stdcall]<ulong, int> s_createGuid;
+
+        internal sealed class FwScriptGuidPoolTask : IScriptTask
+        {
+            #region Fields
+            internal PoolType _poolType;
+            internal IntPtr _poolAddress;
+
+            internal bool _doPosCheck = false;
+            internal bool _doModelCheck = false;
+            internal float _radiusSquared;
+            internal FVector3? _position;
+            internal HashSet<int> _modelHashes;
+            internal Func<IntPtr, bool> _predicate;
+            internal int[] _resultHandles = Array.Empty<int>();
+
+            #endregion
+
+            internal FwScriptGuidPoolTask(PoolType type, IntPtr poolAddress)
+            {
+                _poolType = type;
+                _poolAddress = poolAddress;
+            }
+            internal FwScriptGuidPoolTask(PoolType type, IntPtr poolAddress, int[] modelHashes) : this(type, poolAddress)
+            {
+                if (modelHashes == null || modelHashes.Length <= 0)
+                {
+                    return;
+                }
+
+                _doModelCheck = true;
+                this._modelHashes = new HashSet<int>(modelHashes);
+            }
+            internal FwScriptGuidPoolTask(PoolType type, IntPtr poolAddress, Func<IntPtr, bool> predicate) : this(type, poolAddress)
+            {
+                _predicate = predicate;
+            }
+            internal FwScriptGuidPoolTask(PoolType type, IntPtr poolAddress, FVector3 position, float radiusSquared,
+                int[] modelHashes = null, Func<IntPtr, bool> predicate = null) : this(type, poolAddress)
+            {
+                _doPosCheck = true;
+                this._radiusSquared = radiusSquared;
+                this._position = position;
+
+                _predicate = predicate;
+
+                if (modelHashes == null || modelHashes.Length <= 0)
+                {
+                    return;
+                }
+
+                _doModelCheck = true;
+                this._modelHashes = new HashSet<int>(modelHashes);
+            }
+
+            public void Run()
+            {
+                if (*NativeMemory.s_fwScriptGuidPoolAddress == 0)
+                {
+                    return;
+                }
+
+                var fwScriptGuidPool = (FwBasePool*)(*NativeMemory.s_fwScriptGuidPoolAddress);
+
+                switch (_poolType)
+                {
+                    case PoolType.Generic:
+                        var fwBasePool = (FwBasePool*)_poolAddress;
+                        _resultHandles = GetGuidHandlesFromFwBasePool(fwScriptGuidPool, fwBasePool);
+                        break;
+
+                    case PoolType.Vehicle:
+                        var poolAllocator = (RageSysMemPoolAllocator*)_poolAddress;
+                        _resultHandles = GetGuidHandlesFromRageSysMemPoolAllocator(fwScriptGuidPool, poolAllocator);
+                        break;
+
+                    case PoolType.Projectile:
+                        int projectilesCount = NativeMemory.GetProjectileCount();
+                        int projectileCapacity = NativeMemory.GetProjectileCapacity();
+                        ulong* projectilePoolAddress = (ulong*)_poolAddress;
+
+                        _resultHandles = GetGuidHandlesFromProjectilePool(fwScriptGuidPool, projectilePoolAddress, projectilesCount, projectileCapacity, _predicate);
+                        break;
+                }
+            }
+
+            private int[] GetGuidHandlesFromFwBasePool(FwBasePool* fwScriptGuidPool, FwBasePool* fwBasePool)
+            {
+                var resultList = new List<int>(fwBasePool->SlotsUsed);
+
+                FwBasePool.OccupiedSlotEnumerator slots = fwBasePool->GetOccupiedSlots();
+                while (slots.MoveNext())
+                {
+                    if (fwScriptGuidPool->IsFull())
+                    {
+                        throw new InvalidOperationException("The fwScriptGuid pool is full. The pool must be extended to retrieve all entity handles.");
+                    }
+
+                    ulong address = fwBasePool->GetAddress(slots.Current);
+
+                    if (_doPosCheck && !CheckEntityDistance(address, _position.GetValueOrDefault(), _radiusSquared))
+                    {
+                        continue;
+                    }
+
+                    if (_doModelCheck && !CheckEntityModel(address, _modelHashes))
+                    {
+                        continue;
+                    }
+
+                    int createdHandle = NativeMemory.s_createGuid(address);
+                    resultList.Add(createdHandle);
+                }
+
+                return resultList.ToArray();
+            }
+
+            private int[] GetGuidHandlesFromRageSysMemPoolAllocator(FwBasePool* fwScriptGuidPool, RageSysMemPoolAllocator* poolAllocator)
+            {
+                var resultList = new List<int>((int)poolAllocator->ItemCount);
+
+                uint poolSize = poolAllocator->Size;
+                for (uint i = 0; i < poolSize; i++)
+                {
+                    if (fwScriptGuidPool->IsFull())
+                    {
+                        throw new InvalidOperationException("The fwScriptGuid pool is full. The pool must be extended to retrieve all vehicle handles.");
+                    }
+
+                    if (!poolAllocator->IsValid(i))
+                    {
+                        continue;
+                    }
+
+                    ulong address = poolAllocator->GetAddress(i);
+
+                    if (_doPosCheck && !CheckEntityDistance(address, _position.GetValueOrDefault(), _radiusSquared))
+                    {
+                        continue;
+                    }
+
+                    if (_doModelCheck && !CheckEntityModel(address, _modelHashes))
+                    {
+                        continue;
+                    }
+
+                    int createdHandle = NativeMemory.s_createGuid(address);
+                    resultList.Add(createdHandle);
+                }
+
+                return resultList.ToArray();
+            }
+
+            private int[] GetGuidHandlesFromProjectilePool(FwBasePool* fwScriptGuidPool,
+                ulong* projectilePool, int itemCount, int maxItemCount, Func<IntPtr, bool> predicate)
+            {
+                int projectilesLeft = itemCount;
+                int projectileCapacity = maxItemCount;
+
+                var resultList = new List<int>(itemCount);
+
+                for (uint i = 0; (projectilesLeft > 0 && i < projectileCapacity); i++)
+                {
+                    if (fwScriptGuidPool->IsFull())
+                    {
+                        throw new InvalidOperationException("The fwScriptGuid pool is full. The pool must be extended to retrieve all projectile handles.");
+                    }
+
+                    ulong entityAddress = (ulong)MemDataMarshal.ReadAddress(new IntPtr(projectilePool + i)).ToInt64();
+                    if (entityAddress == 0)
+                    {
+                        continue;
+                    }
+
+                    projectilesLeft--;
+
+                    if (_doPosCheck && !CheckEntityDistance(entityAddress, _position.GetValueOrDefault(), _radiusSquared))
+                    {
+                        continue;
+                    }
+
+                    if (_doModelCheck && !CheckEntityModel(entityAddress, _modelHashes))
+                    {
+                        continue;
+                    }
+
+                    if (predicate != null && !predicate((IntPtr)entityAddress))
+                    {
+                        continue;
+                    }
+
+                    int createdHandle = NativeMemory.s_createGuid(entityAddress);
+                    resultList.Add(createdHandle);
+                }
+
+                return resultList.ToArray();
+            }
+
+            private static bool CheckEntityDistance(ulong address, FVector3 position, float radiusSquared)
+            {
+                float* entityPosition = stackalloc float[4];
+
+                NativeMemory.s_entityPosFunc(address, entityPosition);
+
+                float x = position.X - entityPosition[0];
+                float y = position.Y - entityPosition[1];
+                float z = position.Z - entityPosition[2];
+
+                float distanceSquared = (x * x) + (y * y) + (z * z);
+                if (distanceSquared > radiusSquared)
+                {
+                    return false;
+                }
+
+                return true;
+            }
+
+            private static bool CheckEntityModel(ulong address, HashSet<int> modelHashes)
+            {
+                int modelHash = GetModelHashFromEntity(new IntPtr((long)address));
+                if (!modelHashes.Contains(modelHash))
+                {
+                    return false;
+                }
+
+                return true;
+            }
+        }
+
+        internal sealed class GetEntityHandleTask : IScriptTask
+        {
+            #region Fields
+            internal ulong _entityAddress;
+            internal int _returnEntityHandle;
+            #endregion
+
+            internal GetEntityHandleTask(IntPtr entityAddress)
+            {
+                this._entityAddress = (ulong)entityAddress.ToInt64();
+            }
+
+            public void Run()
+            {
+                _returnEntityHandle = NativeMemory.s_createGuid(_entityAddress);
+            }
+        }
+
+        /// <summary>
+        /// Gets or sets whether the ped, vehicle, prop, pickup and building queries such as
+        /// <see cref="GetPedHandles(int[])"/> read from a snapshot of the pools taken once per tick, instead of
+        /// scanning the pools on every call.
+        /// </summary>
+        /// <remarks>
+        /// The snapshot is taken on the first query of a tick, so entities created later in the same tick are not
+        /// found and positions are the ones at the time of the first query until the next tick.
+        /// When this is <see langword="false"/>, the closest entity and box queries take a snapshot of only the queried
+        /// pools for each call.
+        /// </remarks>
+        public static bool UseEntityPoolSnapshot { get; set; }
+
+        /// <summary>
+        /// The pools an <see cref="EntityPoolSnapshot"/> can contain, which <see cref="EntityPoolEvent"/>s also
+        /// report.
+        /// </summary>
+        public enum EntityPoolKind : byte
+        {
+            Vehicle,
+            Ped,
+            Object,
+            PickupObject,
+            Building,
+            AnimatedBuilding,
+        }
+
+        private static EntityPoolSnapshot s_entityPoolSnapshot;
+        private static EntityPoolSnapshot s_buildingPoolSnapshot;
+
+        /// <summary>
+        /// Discards the entity pool snapshots of the last tick. Should be called at the start of every tick.
+        /// </summary>
+        internal static void InvalidateEntityPoolSnapshot()
+        {
+            s_entityPoolSnapshot?.Invalidate();
+            s_buildingPoolSnapshot?.Invalidate();
+        }
+
+        private static EntityPoolSnapshot GetEntityPoolSnapshot(EntityPoolKind kind)
+        {
+            EntityPoolSnapshot snapshot;
+            if (kind == EntityPoolKind.Building || kind == EntityPoolKind.AnimatedBuilding)
+            {
+                // Buildings don't move, so their snapshot is kept for as long as the slots of their pools stay the same
+                if (s_buildingPoolSnapshot == null)
+                {
+                    System.Threading.Interlocked.CompareExchange(ref s_buildingPoolSnapshot,
+                        new EntityPoolSnapshot(true, EntityPoolKind.Building, EntityPoolKind.AnimatedBuilding), null);
+                }
+                snapshot = s_buildingPoolSnapshot;
+            }
+            else if (UseEntityPoolSnapshot)
+            {
+                if (s_entityPoolSnapshot == null)
+                {
+                    System.Threading.Interlocked.CompareExchange(ref s_entityPoolSnapshot,
+                        new EntityPoolSnapshot(false, EntityPoolKind.Vehicle, EntityPoolKind.Ped,
+                            EntityPoolKind.Object, EntityPoolKind.PickupObject), null);
+                }
+                snapshot = s_entityPoolSnapshot;
+            }
+            else
+            {
+                // Without the per-tick snapshot, queries must see the pools as they are now, so only the queried pool
+                // is taken for the call as the pool scans do
+                snapshot = new EntityPoolSnapshot(false, kind);
+            }
+
+            return snapshot;
+        }
+
+        private static int[] GetHandlesFromEntityPoolSnapshot(EntityPoolKind kind, int[] modelHashes = null)
+        {
+            return GetEntityPoolSnapshot(kind).GetHandles(1u << (int)kind, null, 0f, modelHashes);
+        }
+        private static int[] GetHandlesFromEntityPoolSnapshot(EntityPoolKind kind, FVector3 position, float radius,
+            int[] modelHashes = null)
+        {
+            return GetEntityPoolSnapshot(kind).GetHandles(1u << (int)kind, position, radius, modelHashes);
+        }
+        private static int[] GetClosestHandlesFromEntityPoolSnapshot(EntityPoolKind kind, FVector3 position,
+            float radius, int count, int[] modelHashes)
+        {
+            if (count <= 0)
+            {
+                return Array.Empty<int>();
+            }
+
+            return GetEntityPoolSnapshot(kind).GetClosestHandles(1u << (int)kind, position, radius, count, modelHashes);
+        }
+
+        /// <summary>
+        /// A snapshot of entity pools in structure-of-arrays layout with a spatial grid over the positions, so
+        /// queries only touch the arrays they filter on and the cells around the queried position.
+        /// </summary>
+        /// <remarks>
+        /// <para>
+        /// Scripts can query from threads other than their script thread, such as thread pool threads, so every query
+        /// takes the snapshot up to date and reads it with a lock held. The buffers a query works in are kept in the
+        /// snapshot and reused by the next query.
+        /// </para>
+        /// <para>
+        /// Script handles are created only for the entities a query returns, since creating them for every entity
+        /// would fill up the <c>fwScriptGuid</c> pool. They are cached in the snapshot for later queries until the
+        /// snapshot is taken again.
+        /// </para>
+        /// </remarks>
+        internal sealed class EntityPoolSnapshot : IScriptTask
+        {
+            // The radius the search for the closest entities starts with, which grows until enough entities are found
+            private const float InitialClosestSearchRadius = 32f;
+
+            private readonly EntityPoolKind[] _pools;
+            private readonly bool _isStatic;
+            // The slot flags of each pool when the snapshot was taken, to tell whether a static snapshot is stale
+            private readonly byte[][] _poolSlotFlags;
+
+            private int _count;
+            private ulong[] _addresses = Array.Empty<ulong>();
+            private uint[] _slotIndices = Array.Empty<uint>();
+            private EntityPoolKind[] _kinds = Array.Empty<EntityPoolKind>();
+            private float[] _positionsX = Array.Empty<float>();
+            private float[] _positionsY = Array.Empty<float>();
+            private float[] _positionsZ = Array.Empty<float>();
+            private int[] _modelHashes = Array.Empty<int>();
+            // Zero until a query returns the entity, except for buildings whose handles are pool handles
+            private int[] _handles = Array.Empty<int>();
+
+            private readonly EntitySpatialGrid _grid = new();
+            private bool _isGridBuilt;
+
+            private readonly object _lock = new();
+            private readonly List<int> _candidateIndices = new();
+            private readonly List<int> _matchedIndices = new();
+            private readonly HashSet<int> _modelHashSet = new();
+            private int[] _sortedIndices = Array.Empty<int>();
+            private float[] _sortedDistances = Array.Empty<float>();
+            private CreateHandlesTask _createHandlesTask;
+
+            private bool _isCaptured;
+            private bool _needsValidation = true;
+
+            internal EntityPoolSnapshot(bool isStatic, params EntityPoolKind[] pools)
+            {
+                _isStatic = isStatic;
+                _pools = pools;
+                _poolSlotFlags = new byte[pools.Length][];
+            }
+
+            /// <summary>
+            /// Marks the snapshot to be taken again before the next query, or for a static snapshot, to be checked
+            /// against the pools.
+            /// </summary>
+            internal void Invalidate()
+            {
+                lock (_lock)
+                {
+                    _needsValidation = true;
+                }
+            }
+
+            /// <summary>
+            /// Takes the snapshot if it has been invalidated and the pools may have changed. Must be called with the
+            /// lock held.
+            /// </summary>
+            private void EnsureUpToDate()
+            {
+                if (!_needsValidation)
+                {
+                    return;
+                }
+
+                if (!_isCaptured || !_isStatic || HavePoolSlotsChanged())
+                {
+                    ScriptDomain.CurrentDomain.ExecuteTaskWithGameThreadTlsContext(this);
+                }
+
+                _needsValidation = false;
+            }
+
+            /// <summary>
+            /// Takes the snapshot. This must be called in the main thread of the game.
+            /// </summary>
+            public void Run()
+            {
+                _count = 0;
+                _isGridBuilt = false;
+
+                int expectedCount = 0;
+                foreach (EntityPoolKind kind in _pools)
+                {
+                    expectedCount += GetItemCount(kind);
+                }
+                EnsureCapacity(expectedCount);
+
+                // Keep the order of the pools, as GetEntityHandles returns vehicles first
+                for (int poolIndex = 0; poolIndex < _pools.Length; poolIndex++)
+                {
+                    EntityPoolKind kind = _pools[poolIndex];
+                    if (kind == EntityPoolKind.Vehicle)
+                    {
+                        RageSysMemPoolAllocator* vehiclePool = GetVehiclePool();
+                        if (vehiclePool == null)
+                        {
+                            continue;
+                        }
+
+                        uint poolSize = vehiclePool->Size;
+                        for (uint i = 0; i < poolSize; i++)
+                        {
+                            if (vehiclePool->IsValid(i))
+                            {
+                                Add(kind, i, vehiclePool->GetAddress(i), 0);
+                            }
+                        }
+
+                        continue;
+                    }
+
+                    FwBasePool* pool = GetFwBasePool(kind);
+                    if (pool == null)
+                    {
+                        _poolSlotFlags[poolIndex] = null;
+                        continue;
+                    }
+
+                    // Buildings have pool handles, which don't need a slot in the fwScriptGuid pool
+                    bool hasPoolHandles = kind == EntityPoolKind.Building || kind == EntityPoolKind.AnimatedBuilding;
+                    uint capacity = pool->Capacity;
+                    FwBasePool.OccupiedSlotEnumerator slots = pool->GetOccupiedSlots();
+                    while (slots.MoveNext())
+                    {
+                        Add(kind, slots.Current, pool->GetAddress(slots.Current), hasPoolHandles ? slots.CurrentHandle : 0);
+                    }
 
-        public static IntPtr GetHandlingDataByModelHash(int modelHash)
-        {
-            IntPtr modelInfo = FindCModelInfo(modelHash);
-            if (GetModelInfoType(modelInfo) != ModelInfoType.Vehicle)
-            {
-                return IntPtr.Zero;
-            }
+                    if (_isStatic)
+                    {
+                        byte[] slotFlags = _poolSlotFlags[poolIndex];
+                        if (slotFlags == null || slotFlags.Length != capacity)
+                        {
+                            slotFlags = _poolSlotFlags[poolIndex] = new byte[capacity];
+                        }
 
-            int handlingIndex = *(int*)(modelInfo + s_handlingIndexOffsetInModelInfo).ToPointer();
-            return new IntPtr((long)s_getHandlingDataByIndex(handlingIndex));
-        }
-        public static IntPtr GetHandlingDataByHandlingNameHash(int handlingNameHash)
-        {
-            return new IntPtr((long)s_getHandlingDataByHash(new IntPtr(&handlingNameHash)));
-        }
+                        Marshal.Copy(pool->Flags, slotFlags, 0, (int)capacity);
+                    }
+                }
 
-        private static PersonalityData* GetModelPersonalityDataAddress(IntPtr modelInfoAddress)
-        {
-            if (modelInfoAddress == IntPtr.Zero ||
-                s_pedPersonalitiesArrayAddr == null ||
-                s_pedPersonalityIndexOffsetInModelInfo == 0 ||
-                *(ulong*)s_pedPersonalitiesArrayAddr == 0)
-            {
-                return null;
+                _isCaptured = true;
             }
 
-            if (GetModelInfoType(modelInfoAddress) != ModelInfoType.Ped)
+            /// <summary>
+            /// Gets the handles of the entities of some pools that pass the filters.
+            /// </summary>
+            /// <param name="kindMask">The bit mask of the <see cref="EntityPoolKind"/>s to get.</param>
+            /// <param name="position">The position to check the distance from, or <see langword="null"/> not to check.</param>
+            /// <param name="radius">The max distance from <paramref name="position"/>.</param>
+            /// <param name="modelHashes">The model hashes to accept, or <see langword="null"/> or empty to accept any model.</param>
+            internal int[] GetHandles(uint kindMask, FVector3? position, float radius, int[] modelHashes)
             {
-                return null;
-            }
+                lock (_lock)
+                {
+                    EnsureUpToDate();
 
-            // This values is not likely to be changed in further updates
-            const int PedPersonalityElementSize = 0xB8;
+                    if (position.HasValue)
+                    {
+                        _candidateIndices.Clear();
+                        GetGrid().QueryRadius(position.GetValueOrDefault(), radius, _candidateIndices);
+                        FilterCandidates(kindMask, modelHashes);
+                    }
+                    else
+                    {
+                        FilterAll(kindMask, modelHashes);
+                    }
 
-            ushort indexOfPedPersonality = *(ushort*)(modelInfoAddress + s_pedPersonalityIndexOffsetInModelInfo).ToPointer();
-            return (PersonalityData*)(*(ulong*)s_pedPersonalitiesArrayAddr + (uint)(indexOfPedPersonality * PedPersonalityElementSize));
-        }
-        public static bool IsModelAMalePed(int modelHash)
-        {
-            PersonalityData* pedPersonalityAddress = GetModelPersonalityDataAddress(FindCModelInfo(modelHash));
+                    return CreateHandlesOfMatches();
+                }
+            }
 
-            if (pedPersonalityAddress == null)
+            /// <summary>
+            /// Gets the handles of the entities of some pools within an axis-aligned box.
+            /// </summary>
+            internal int[] GetHandlesInBox(uint kindMask, FVector3 min, FVector3 max)
             {
-                return false;
-            }
+                lock (_lock)
+                {
+                    EnsureUpToDate();
 
-            return pedPersonalityAddress->IsMale;
-        }
-        public static bool IsModelAFemalePed(int modelHash)
-        {
-            PersonalityData* pedPersonalityAddress = GetModelPersonalityDataAddress(FindCModelInfo(modelHash));
+                    _candidateIndices.Clear();
+                    GetGrid().QueryBox(min, max, _candidateIndices);
+                    FilterCandidates(kindMask, null);
 
-            if (pedPersonalityAddress == null)
+                    return CreateHandlesOfMatches();
+                }
+            }
+
+            /// <summary>
+            /// Gets the handles of the closest entities of some pools, sorted by the distance.
+            /// </summary>
+            /// <param name="kindMask">The bit mask of the <see cref="EntityPoolKind"/>s to get.</param>
+            /// <param name="position">The position to measure the distance from.</param>
+            /// <param name="radius">The max distance from <paramref name="position"/>.</param>
+            /// <param name="count">The max number of handles to get.</param>
+            /// <param name="modelHashes">The model hashes to accept, or <see langword="null"/> or empty to accept any model.</param>
+            internal int[] GetClosestHandles(uint kindMask, FVector3 position, float radius, int count, int[] modelHashes)
             {
-                return false;
+                lock (_lock)
+                {
+                    EnsureUpToDate();
+                    return GetClosestHandlesOfSnapshot(kindMask, position, radius, count, modelHashes);
+                }
             }
 
-            return !pedPersonalityAddress->IsMale;
-        }
-        public static bool IsModelHumanPed(int modelHash)
-        {
-            PersonalityData* pedPersonalityAddress = GetModelPersonalityDataAddress(FindCModelInfo(modelHash));
+            private int[] GetClosestHandlesOfSnapshot(uint kindMask, FVector3 position, float radius, int count,
+                int[] modelHashes)
+            {
+                EntitySpatialGrid grid = GetGrid();
+
+                // If enough entities are found within a radius, the closest entities must be among them, so the
+                // search only has to grow until then
+                float searchRadius = Math.Min(InitialClosestSearchRadius, radius);
+                while (true)
+                {
+                    _candidateIndices.Clear();
+                    grid.QueryRadius(position, searchRadius, _candidateIndices);
+                    FilterCandidates(kindMask, modelHashes);
+
+                    if (_matchedIndices.Count >= count || !(searchRadius < radius))
+                    {
+                        break;
+                    }
+
+                    searchRadius = Math.Min(searchRadius * 4f, radius);
+                }
+
+                int matchedCount = _matchedIndices.Count;
+                if (_sortedIndices.Length < matchedCount)
+                {
+                    _sortedIndices = new int[matchedCount];
+                    _sortedDistances = new float[matchedCount];
+                }
+                for (int i = 0; i < matchedCount; i++)
+                {
+                    int index = _matchedIndices[i];
+                    _sortedIndices[i] = index;
+                    _sortedDistances[i] = grid.GetDistanceSquared(index, position);
+                }
+                Array.Sort(_sortedDistances, _sortedIndices, 0, matchedCount);
+
+                _matchedIndices.Clear();
+                for (int i = 0; i < matchedCount && i < count; i++)
+                {
+                    _matchedIndices.Add(_sortedIndices[i]);
+                }
+
+                return CreateHandlesOfMatches();
+            }
 
-            if (pedPersonalityAddress == null)
+            private EntitySpatialGrid GetGrid()
             {
-                return false;
+                if (!_isGridBuilt)
+                {
+                    _grid.Build(_positionsX, _positionsY, _positionsZ, _count);
+                    _isGridBuilt = true;
+                }
+
+                return _grid;
             }
 
-            return pedPersonalityAddress->IsHuman;
-        }
-        public static bool IsModelAnAnimalPed(int modelHash)
-        {
-            PersonalityData* pedPersonalityAddress = GetModelPersonalityDataAddress(FindCModelInfo(modelHash));
+            private void FilterAll(uint kindMask, int[] modelHashes)
+            {
+                _matchedIndices.Clear();
+                HashSet<int> modelHashSet = FillModelHashSet(modelHashes);
+
+                for (int i = 0; i < _count; i++)
+                {
+                    if (IsMatch(i, kindMask, modelHashSet))
+                    {
+                        _matchedIndices.Add(i);
+                    }
+                }
+            }
 
-            if (pedPersonalityAddress == null)
+            private void FilterCandidates(uint kindMask, int[] modelHashes)
             {
-                return false;
+                _matchedIndices.Clear();
+                HashSet<int> modelHashSet = FillModelHashSet(modelHashes);
+
+                // Sort the candidates so the results keep the order of the pools like the full scan does
+                _candidateIndices.Sort();
+                foreach (int i in _candidateIndices)
+                {
+                    if (IsMatch(i, kindMask, modelHashSet))
+                    {
+                        _matchedIndices.Add(i);
+                    }
+                }
             }
 
-            return !pedPersonalityAddress->IsHuman;
-        }
-        public static bool IsModelAGangPed(int modelHash)
-        {
-            PersonalityData* pedPersonalityAddress = GetModelPersonalityDataAddress(FindCModelInfo(modelHash));
+            private bool IsMatch(int index, uint kindMask, HashSet<int> modelHashSet)
+            {
+                return (kindMask & (1u << (int)_kinds[index])) != 0
+                    && (modelHashSet == null || modelHashSet.Contains(_modelHashes[index]));
+            }
 
-            if (pedPersonalityAddress == null)
+            private HashSet<int> FillModelHashSet(int[] modelHashes)
             {
-                return false;
+                if (modelHashes == null || modelHashes.Length == 0)
+                {
+                    return null;
+                }
+
+                _modelHashSet.Clear();
+                foreach (int modelHash in modelHashes)
+                {
+                    _modelHashSet.Add(modelHash);
+                }
+
+                return _modelHashSet;
             }
 
-            return pedPersonalityAddress->IsGang;
-        }
+            private int[] CreateHandlesOfMatches()
+            {
+                foreach (int index in _matchedIndices)
+                {
+                    if (_handles[index] == 0)
+                    {
+                        ScriptDomain.CurrentDomain.ExecuteTaskWithGameThreadTlsContext(
+                            _createHandlesTask ??= new CreateHandlesTask(this));
+                        break;
+                    }
+                }
 
-        #endregion
+                // Zero if the entity has been deleted since the snapshot was taken
+                int resultCount = 0;
+                foreach (int index in _matchedIndices)
+                {
+                    if (_handles[index] != 0)
+                    {
+                        resultCount++;
+                    }
+                }
+                if (resultCount == 0)
+                {
+                    return Array.Empty<int>();
+                }
 
-        #region -- Entity Pools --
+                int[] result = new int[resultCount];
+                int resultIndex = 0;
+                foreach (int index in _matchedIndices)
+                {
+                    if (_handles[index] != 0)
+                    {
+                        result[resultIndex++] = _handles[index];
+                    }
+                }
 
-        private static ulong* s_fwScriptGuidPoolAddress;
-        private static ulong* s_pedPoolAddress;
-        private static ulong* s_objectPoolAddress;
-        private static ulong* s_pickupObjectPoolAddress;
-        private static ulong* s_vehiclePoolAddress;
-        private static ulong* s_buildingPoolAddress;
-        private static ulong* s_animatedBuildingPoolAddress;
-        private static ulong* s_interiorInstPoolAddress;
-        private static ulong* s_interiorProxyPoolAddress;
+                return result;
+            }
 
-        private static ulong* s_projectilePoolAddress;
-        private static int* s_projectileCountAddress;
+            private bool HavePoolSlotsChanged()
+            {
+                for (int poolIndex = 0; poolIndex < _pools.Length; poolIndex++)
+                {
+                    FwBasePool* pool = GetFwBasePool(_pools[poolIndex]);
+                    byte[] slotFlags = _poolSlotFlags[poolIndex];
+                    if (pool == null || slotFlags == null)
+                    {
+                        if (pool != null || slotFlags != null)
+                        {
+                            return true;
+                        }
 
-        // if the entity is a ped and they are in a vehicle, the vehicle position will be returned instead (just like GET_ENTITY_COORDS does)
-        private static delegate* unmanaged[Stdcall]<ulong, float*, ulong> s_entityPosFunc;
-        // should be rage::fwScriptGuid::CreateGuid
-        private static delegate* unmanaged[Stdcall]<ulong, int> s_createGuid;
+                        continue;
+                    }
 
-        internal sealed class FwScriptGuidPoolTask : IScriptTask
-        {
-            #region Fields
-            internal PoolType _poolType;
-            internal IntPtr _poolAddress;
+                    if (pool->Capacity != slotFlags.Length)
+                    {
+                        return true;
+                    }
 
-            internal bool _doPosCheck = false;
-            internal bool _doModelCheck = false;
-            internal float _radiusSquared;
-            internal FVector3? _position;
-            internal HashSet<int> _modelHashes;
-            internal Func<IntPtr, bool> _predicate;
-            internal int[] _resultHandles = Array.Empty<int>();
+                    // The flags also contain the reuse counters of the slots, so a replaced building is detected too.
+                    // Compare 8 flags at a time, as the building pool has tens of thousands of slots.
+                    var flags = (byte*)pool->Flags.ToPointer();
+                    fixed (byte* savedFlags = slotFlags)
+                    {
+                        int length = slotFlags.Length;
+                        int i = 0;
+                        for (; i + 8 <= length; i += 8)
+                        {
+                            if (*(ulong*)(flags + i) != *(ulong*)(savedFlags + i))
+                            {
+                                return true;
+                            }
+                        }
+                        for (; i < length; i++)
+                        {
+                            if (flags[i] != savedFlags[i])
+                            {
+                                return true;
+                            }
+                        }
+                    }
+                }
 
-            #endregion
+                return false;
+            }
 
-            internal FwScriptGuidPoolTask(PoolType type, IntPtr poolAddress)
+            private void Add(EntityPoolKind kind, uint slotIndex, ulong address, int handle)
             {
-                _poolType = type;
-                _poolAddress = poolAddress;
+                // The pools can't change while the snapshot is being taken, but grow just in case the counts are off
+                if (_count == _addresses.Length)
+                {
+                    EnsureCapacity(_count * 2 + 16);
+                }
+
+                float* entityPosition = stackalloc float[4];
+                NativeMemory.s_entityPosFunc(address, entityPosition);
+
+                int index = _count++;
+                _addresses[index] = address;
+                _slotIndices[index] = slotIndex;
+                _kinds[index] = kind;
+                _positionsX[index] = entityPosition[0];
+                _positionsY[index] = entityPosition[1];
+                _positionsZ[index] = entityPosition[2];
+                _modelHashes[index] = GetModelHashFromEntity(new IntPtr((long)address));
+                _handles[index] = handle;
             }
-            internal FwScriptGuidPoolTask(PoolType type, IntPtr poolAddress, int[] modelHashes) : this(type, poolAddress)
+
+            private void EnsureCapacity(int capacity)
             {
-                if (modelHashes == null || modelHashes.Length <= 0)
+                if (capacity <= _addresses.Length)
                 {
                     return;
                 }
 
-                _doModelCheck = true;
-                this._modelHashes = new HashSet<int>(modelHashes);
-            }
-            internal FwScriptGuidPoolTask(PoolType type, IntPtr poolAddress, Func<IntPtr, bool> predicate) : this(type, poolAddress)
-            {
-                _predicate = predicate;
+                Array.Resize(ref _addresses, capacity);
+                Array.Resize(ref _slotIndices, capacity);
+                Array.Resize(ref _kinds, capacity);
+                Array.Resize(ref _positionsX, capacity);
+                Array.Resize(ref _positionsY, capacity);
+                Array.Resize(ref _positionsZ, capacity);
+                Array.Resize(ref _modelHashes, capacity);
+                Array.Resize(ref _handles, capacity);
             }
-            internal FwScriptGuidPoolTask(PoolType type, IntPtr poolAddress, FVector3 position, float radiusSquared,
-                int[] modelHashes = null, Func<IntPtr, bool> predicate = null) : this(type, poolAddress)
-            {
-                _doPosCheck = true;
-                this._radiusSquared = radiusSquared;
-                this._position = position;
-
-                _predicate = predicate;
 
-                if (modelHashes == null || modelHashes.Length <= 0)
+            private static int GetItemCount(EntityPoolKind kind)
+            {
+                if (kind == EntityPoolKind.Vehicle)
                 {
-                    return;
+                    RageSysMemPoolAllocator* vehiclePool = GetVehiclePool();
+                    return vehiclePool != null ? (int)vehiclePool->ItemCount : 0;
                 }
 
-                _doModelCheck = true;
-                this._modelHashes = new HashSet<int>(modelHashes);
+                FwBasePool* pool = GetFwBasePool(kind);
+                return pool != null ? pool->SlotsUsed : 0;
             }
 
-            public void Run()
+            internal static RageSysMemPoolAllocator* GetVehiclePool()
             {
-                if (*NativeMemory.s_fwScriptGuidPoolAddress == 0)
+                if (s_vehiclePoolAddress == null || *s_vehiclePoolAddress == 0)
                 {
-                    return;
+                    return null;
                 }
 
-                var fwScriptGuidPool = (FwBasePool*)(*NativeMemory.s_fwScriptGuidPoolAddress);
+                return *(RageSysMemPoolAllocator**)(*s_vehiclePoolAddress);
+            }
 
-                switch (_poolType)
+            internal static FwBasePool* GetFwBasePool(EntityPoolKind kind)
+            {
+                ulong* ptrOfPoolPtr;
+                switch (kind)
                 {
-                    case PoolType.Generic:
-                        var fwBasePool = (FwBasePool*)_poolAddress;
-                        _resultHandles = GetGuidHandlesFromFwBasePool(fwScriptGuidPool, fwBasePool);
+                    case EntityPoolKind.Ped:
+                        ptrOfPoolPtr = s_pedPoolAddress;
                         break;
-
-                    case PoolType.Vehicle:
-                        var poolAllocator = (RageSysMemPoolAllocator*)_poolAddress;
-                        _resultHandles = GetGuidHandlesFromRageSysMemPoolAllocator(fwScriptGuidPool, poolAllocator);
+                    case EntityPoolKind.Object:
+                        ptrOfPoolPtr = s_objectPoolAddress;
                         break;
-
-                    case PoolType.Projectile:
-                        int projectilesCount = NativeMemory.GetProjectileCount();
-                        int projectileCapacity = NativeMemory.GetProjectileCapacity();
-                        ulong* projectilePoolAddress = (ulong*)_poolAddress;
-
-                        _resultHandles = GetGuidHandlesFromProjectilePool(fwScriptGuidPool, projectilePoolAddress, projectilesCount, projectileCapacity, _predicate);
+                    case EntityPoolKind.PickupObject:
+                        ptrOfPoolPtr = s_pickupObjectPoolAddress;
+                        break;
+                    case EntityPoolKind.Building:
+                        ptrOfPoolPtr = s_buildingPoolAddress;
+                        break;
+                    case EntityPoolKind.AnimatedBuilding:
+                        ptrOfPoolPtr = s_animatedBuildingPoolAddress;
                         break;
+                    default:
+                        return null;
                 }
+
+                return ptrOfPoolPtr != null ? (FwBasePool*)*ptrOfPoolPtr : null;
             }
 
-            private int[] GetGuidHandlesFromFwBasePool(FwBasePool* fwScriptGuidPool, FwBasePool* fwBasePool)
+            /// <summary>
+            /// Creates the script handles of the entities the last query matched.
+            /// </summary>
+            private sealed class CreateHandlesTask : IScriptTask
             {
-                var resultList = new List<int>(fwBasePool->SlotsUsed);
+                private readonly EntityPoolSnapshot _snapshot;
 
-                uint fwBasePoolSize = fwBasePool->Capacity;
-                for (uint i = 0; i < fwBasePoolSize; i++)
+                internal CreateHandlesTask(EntityPoolSnapshot snapshot)
                 {
-                    if (fwScriptGuidPool->IsFull())
-                    {
-                        throw new InvalidOperationException("The fwScriptGuid pool is full. The pool must be extended to retrieve all entity handles.");
-                    }
+                    _snapshot = snapshot;
+                }
 
-                    if (!fwBasePool->IsValid(i))
+                public void Run()
+                {
+                    if (*NativeMemory.s_fwScriptGuidPoolAddress == 0)
                     {
-                        continue;
+                        return;
                     }
 
-                    ulong address = fwBasePool->GetAddress(i);
+                    var fwScriptGuidPool = (FwBasePool*)(*NativeMemory.s_fwScriptGuidPoolAddress);
+                    RageSysMemPoolAllocator* vehiclePool = GetVehiclePool();
 
-                    if (_doPosCheck && !CheckEntityDistance(address, _position.GetValueOrDefault(), _radiusSquared))
+                    foreach (int index in _snapshot._matchedIndices)
                     {
-                        continue;
-                    }
+                        if (_snapshot._handles[index] != 0)
+                        {
+                            continue;
+                        }
 
-                    if (_doModelCheck && !CheckEntityModel(address, _modelHashes))
-                    {
-                        continue;
-                    }
+                        if (fwScriptGuidPool->IsFull())
+                        {
+                            throw new InvalidOperationException("The fwScriptGuid pool is full. The pool must be extended to retrieve all entity handles.");
+                        }
 
-                    int createdHandle = NativeMemory.s_createGuid(address);
-                    resultList.Add(createdHandle);
+                        // Scripts that ran after the snapshot was taken may have deleted the entity, so check the
+                        // slot still holds it before creating a handle from the address
+                        ulong address = _snapshot._addresses[index];
+                        uint slotIndex = _snapshot._slotIndices[index];
+                        EntityPoolKind kind = _snapshot._kinds[index];
+                        // Buildings already have their pool handles
+                        if (kind == EntityPoolKind.Building || kind == EntityPoolKind.AnimatedBuilding)
+                        {
+                            continue;
+                        }
+
+                        bool isAlive = kind == EntityPoolKind.Vehicle
+                            ? vehiclePool != null && slotIndex < vehiclePool->Size && vehiclePool->IsValid(slotIndex)
+                                && vehiclePool->GetAddress(slotIndex) == address
+                            : IsSlotAlive(GetFwBasePool(kind), slotIndex, address);
+                        if (!isAlive)
+                        {
+                            continue;
+                        }
+
+                        _snapshot._handles[index] = NativeMemory.s_createGuid(address);
+                    }
                 }
 
-                return resultList.ToArray();
+                private static bool IsSlotAlive(FwBasePool* pool, uint slotIndex, ulong address)
+                {
+                    return pool != null && slotIndex < pool->Capacity && pool->IsValid(slotIndex)
+                        && pool->GetAddress(slotIndex) == address;
+                }
             }
+        }
 
-            private int[] GetGuidHandlesFromRageSysMemPoolAllocator(FwBasePool* fwScriptGuidPool, RageSysMemPoolAllocator* poolAllocator)
+        /// <summary>
+        /// Publishes the creation and deletion of the entities in the watched pools since the last frame, by comparing
+        /// the slots of the pools against the ones it saw in the last frame.
+        /// </summary>
+        /// <remarks>
+        /// <para>
+        /// The slot flags of the <see cref="FwBasePool"/>s are compared 8 at a time, and only the slots in changed
+        /// words are looked at. The reuse counter in the flags changes when a slot is reused, so an entity deleted and
+        /// replaced by another one in the same slot during a frame is reported as both a deletion and a creation.
+        /// The vehicle pool has no reuse counters, so this counts the vehicles seen in each slot instead, and a vehicle
+        /// replaced in the same slot is only detected if a script handle was created for the old one.
+        /// </para>
+        /// <para>
+        /// Events only identify the entity by its pool, slot and reuse counter, so publishing creates no script handle.
+        /// The handle of a created entity is created when a reader asks for it with <see cref="TryResolveHandle"/>,
+        /// and deletion events carry that handle.
+        /// </para>
+        /// </remarks>
+        internal sealed class EntityPoolWatcher : IScriptTask
+        {
+            private readonly ScriptEventBuffer<EntityPoolEvent> _events;
+            // Taken while diffing and while resolving handles, since handles can be resolved from any script thread
+            private readonly object _lock = new();
+            // The slot flags of the fwBasePools, or the bit array of the vehicle pool, as of the last frame
+            private readonly byte[][] _slotFlags = new byte[(int)EntityPoolKind.PickupObject + 1][];
+            private uint[] _vehicleSlotBits;
+            // The number of vehicles seen in each slot of the vehicle pool, which stands in for a reuse counter
+            private uint[] _vehicleGenerations;
+            // The script handles resolved for the entities in the slots, or 0 if no reader asked for one
+            private readonly int[][] _handles = new int[(int)EntityPoolKind.PickupObject + 1][];
+
+            internal EntityPoolWatcher(ScriptEventBuffer<EntityPoolEvent> events)
             {
-                var resultList = new List<int>((int)poolAllocator->ItemCount);
+                _events = events;
+            }
 
-                uint poolSize = poolAllocator->Size;
-                for (uint i = 0; i < poolSize; i++)
+            /// <summary>
+            /// The bit mask of the <see cref="EntityPoolKind"/>s to watch. Only the vehicle, ped, object and pickup
+            /// object pools can be watched.
+            /// </summary>
+            internal uint KindMask { get; set; }
+
+            /// <summary>
+            /// Publishes the changes since the last frame. This must be called in the main thread of the game.
+            /// </summary>
+            public void Run()
+            {
+                lock (_lock)
                 {
-                    if (fwScriptGuidPool->IsFull())
+                    for (var kind = EntityPoolKind.Vehicle; kind <= EntityPoolKind.PickupObject; kind++)
                     {
-                        throw new InvalidOperationException("The fwScriptGuid pool is full. The pool must be extended to retrieve all vehicle handles.");
+                        if ((KindMask & (1u << (int)kind)) == 0)
+                        {
+                            continue;
+                        }
+
+                        if (kind == EntityPoolKind.Vehicle)
+                        {
+                            RageSysMemPoolAllocator* vehiclePool = EntityPoolSnapshot.GetVehiclePool();
+                            if (vehiclePool != null)
+                            {
+                                DiffVehiclePool(vehiclePool);
+                            }
+                        }
+                        else
+                        {
+                            FwBasePool* pool = EntityPoolSnapshot.GetFwBasePool(kind);
+                            if (pool != null)
+                            {
+                                DiffFwBasePool(kind, pool);
+                            }
+                        }
                     }
+                }
+            }
 
-                    if (!poolAllocator->IsValid(i))
+            /// <summary>
+            /// Gets the script handle of the entity a creation event was published for, creating one if the entity
+            /// doesn't have one yet. This must be called with the TLS context of the main thread of the game.
+            /// </summary>
+            /// <param name="ev">The creation event.</param>
+            /// <param name="handle">
+            /// The script handle, or 0 if the entity no longer exists or the handle can't be created yet.
+            /// </param>
+            /// <returns>
+            /// <see langword="false"/> if the <c>fwScriptGuid</c> pool is full and the handle should be asked for
+            /// again later; otherwise, <see langword="true"/>.
+            /// </returns>
+            internal bool TryResolveHandle(in EntityPoolEvent ev, out int handle)
+            {
+                handle = 0;
+
+                lock (_lock)
+                {
+                    int[] handles = _handles[(int)ev.Pool];
+                    if (handles == null || ev.SlotIndex >= handles.Length)
                     {
-                        continue;
+                        return true;
                     }
 
-                    ulong address = poolAllocator->GetAddress(i);
+                    ulong address = GetAddressOfSlot(ev.Pool, ev.SlotIndex, ev.Generation);
+                    if (address == 0)
+                    {
+                        return true;
+                    }
 
-                    if (_doPosCheck && !CheckEntityDistance(address, _position.GetValueOrDefault(), _radiusSquared))
+                    int resolvedHandle = handles[ev.SlotIndex];
+                    if (resolvedHandle != 0 && NativeMemory.s_getScriptEntity(resolvedHandle) == address)
                     {
-                        continue;
+                        handle = resolvedHandle;
+                        return true;
                     }
 
-                    if (_doModelCheck && !CheckEntityModel(address, _modelHashes))
+                    // No handle can be created while the fwScriptGuid pool is full
+                    if (*NativeMemory.s_fwScriptGuidPoolAddress == 0
+                        || ((FwBasePool*)(*NativeMemory.s_fwScriptGuidPoolAddress))->IsFull())
                     {
-                        continue;
+                        return false;
                     }
 
-                    int createdHandle = NativeMemory.s_createGuid(address);
-                    resultList.Add(createdHandle);
+                    handle = handles[ev.SlotIndex] = NativeMemory.s_createGuid(address);
+                    return true;
                 }
-
-                return resultList.ToArray();
             }
 
-            private int[] GetGuidHandlesFromProjectilePool(FwBasePool* fwScriptGuidPool,
-                ulong* projectilePool, int itemCount, int maxItemCount, Func<IntPtr, bool> predicate)
+            /// <summary>
+            /// Gets the address of the entity in a slot, if the slot still holds the entity an event was published
+            /// for.
+            /// </summary>
+            private ulong GetAddressOfSlot(EntityPoolKind kind, uint slotIndex, uint generation)
             {
-                int projectilesLeft = itemCount;
-                int projectileCapacity = maxItemCount;
-
-                var resultList = new List<int>(itemCount);
-
-                for (uint i = 0; (projectilesLeft > 0 && i < projectileCapacity); i++)
+                if (kind == EntityPoolKind.Vehicle)
                 {
-                    if (fwScriptGuidPool->IsFull())
+                    RageSysMemPoolAllocator* vehiclePool = EntityPoolSnapshot.GetVehiclePool();
+                    if (vehiclePool == null || _vehicleGenerations == null || slotIndex >= vehiclePool->Size
+                        || !vehiclePool->IsValid(slotIndex) || _vehicleGenerations[slotIndex] != generation)
                     {
-                        throw new InvalidOperationException("The fwScriptGuid pool is full. The pool must be extended to retrieve all projectile handles.");
+                        return 0;
                     }
 
-                    ulong entityAddress = (ulong)MemDataMarshal.ReadAddress(new IntPtr(projectilePool + i)).ToInt64();
-                    if (entityAddress == 0)
-                    {
-                        continue;
-                    }
+                    return vehiclePool->GetAddress(slotIndex);
+                }
 
-                    projectilesLeft--;
+                FwBasePool* pool = EntityPoolSnapshot.GetFwBasePool(kind);
+                // An occupied slot has the high bit of its flag cleared, so the flag equals the reuse counter
+                if (pool == null || slotIndex >= pool->Capacity || ((byte*)pool->Flags)[slotIndex] != generation)
+                {
+                    return 0;
+                }
 
-                    if (_doPosCheck && !CheckEntityDistance(entityAddress, _position.GetValueOrDefault(), _radiusSquared))
+                return pool->GetAddress(slotIndex);
+            }
+
+            private void DiffFwBasePool(EntityPoolKind kind, FwBasePool* pool)
+            {
+                uint capacity = pool->Capacity;
+                byte[] lastSlotFlags = _slotFlags[(int)kind];
+                int[] handles = _handles[(int)kind];
+                // Start with all slots free, so the entities that already exist are reported as created
+                if (lastSlotFlags == null || lastSlotFlags.Length != capacity)
+                {
+                    lastSlotFlags = _slotFlags[(int)kind] = new byte[capacity];
+                    handles = _handles[(int)kind] = new int[capacity];
+                    for (int i = 0; i < lastSlotFlags.Length; i++)
                     {
-                        continue;
+                        lastSlotFlags[i] = 0x80;
                     }
+                }
 
-                    if (_doModelCheck && !CheckEntityModel(entityAddress, _modelHashes))
+                var slotFlags = (byte*)pool->Flags;
+                uint wordCount = capacity / 8;
+                fixed (byte* lastSlotFlagsPtr = lastSlotFlags)
+                {
+                    for (uint wordIndex = 0; wordIndex < wordCount; wordIndex++)
                     {
-                        continue;
-                    }
+                        if (((ulong*)slotFlags)[wordIndex] == ((ulong*)lastSlotFlagsPtr)[wordIndex])
+                        {
+                            continue;
+                        }
 
-                    if (predicate != null && !predicate((IntPtr)entityAddress))
+                        uint end = wordIndex * 8 + 8;
+                        for (uint i = wordIndex * 8; i < end; i++)
+                        {
+                            DiffFwBasePoolSlot(kind, i, slotFlags, lastSlotFlagsPtr, handles);
+                        }
+                    }
+                    for (uint i = wordCount * 8; i < capacity; i++)
                     {
-                        continue;
+                        DiffFwBasePoolSlot(kind, i, slotFlags, lastSlotFlagsPtr, handles);
                     }
-
-                    int createdHandle = NativeMemory.s_createGuid(entityAddress);
-                    resultList.Add(createdHandle);
                 }
-
-                return resultList.ToArray();
             }
 
-            private static bool CheckEntityDistance(ulong address, FVector3 position, float radiusSquared)
+            private void DiffFwBasePoolSlot(EntityPoolKind kind, uint index, byte* slotFlags, byte* lastSlotFlags,
+                int[] handles)
             {
-                float* entityPosition = stackalloc float[4];
-
-                NativeMemory.s_entityPosFunc(address, entityPosition);
+                byte lastFlag = lastSlotFlags[index];
+                byte flag = slotFlags[index];
+                if (flag == lastFlag)
+                {
+                    return;
+                }
 
-                float x = position.X - entityPosition[0];
-                float y = position.Y - entityPosition[1];
-                float z = position.Z - entityPosition[2];
+                lastSlotFlags[index] = flag;
 
-                float distanceSquared = (x * x) + (y * y) + (z * z);
-                if (distanceSquared > radiusSquared)
+                // The high bit is set on free slots, and the low 7 bits are the reuse counter
+                if ((lastFlag & 0x80) == 0)
                 {
-                    return false;
+                    PublishDeleted(kind, index, lastFlag, ref handles[index]);
+                }
+                if ((flag & 0x80) == 0)
+                {
+                    _events.Publish(new EntityPoolEvent(kind, index, flag, 0, true));
                 }
-
-                return true;
             }
 
-            private static bool CheckEntityModel(ulong address, HashSet<int> modelHashes)
+            private void DiffVehiclePool(RageSysMemPoolAllocator* vehiclePool)
             {
-                int modelHash = GetModelHashFromEntity(new IntPtr((long)address));
-                if (!modelHashes.Contains(modelHash))
+                uint poolSize = vehiclePool->Size;
+                uint wordCount = (poolSize + 31) / 32;
+                uint[] lastSlotBits = _vehicleSlotBits;
+                uint[] generations = _vehicleGenerations;
+                int[] handles = _handles[(int)EntityPoolKind.Vehicle];
+                if (lastSlotBits == null || lastSlotBits.Length != wordCount)
                 {
-                    return false;
+                    lastSlotBits = _vehicleSlotBits = new uint[wordCount];
+                    generations = _vehicleGenerations = new uint[wordCount * 32];
+                    handles = _handles[(int)EntityPoolKind.Vehicle] = new int[wordCount * 32];
                 }
 
-                return true;
-            }
-        }
+                for (uint wordIndex = 0; wordIndex < wordCount; wordIndex++)
+                {
+                    uint slotBits = vehiclePool->BitArray[wordIndex];
+                    uint lastBits = lastSlotBits[wordIndex];
+                    if (slotBits == 0 && lastBits == 0)
+                    {
+                        continue;
+                    }
 
-        internal sealed class GetEntityHandleTask : IScriptTask
-        {
-            #region Fields
-            internal ulong _entityAddress;
-            internal int _returnEntityHandle;
-            #endregion
+                    lastSlotBits[wordIndex] = slotBits;
 
-            internal GetEntityHandleTask(IntPtr entityAddress)
-            {
-                this._entityAddress = (ulong)entityAddress.ToInt64();
+                    for (int bit = 0; bit < 32; bit++)
+                    {
+                        uint mask = 1u << bit;
+                        bool wasValid = (lastBits & mask) != 0;
+                        bool isValid = (slotBits & mask) != 0;
+                        uint index = wordIndex * 32 + (uint)bit;
+                        if (index >= poolSize || (!wasValid && !isValid))
+                        {
+                            continue;
+                        }
+
+                        ref int handle = ref handles[index];
+                        if (wasValid && isValid)
+                        {
+                            // The slot still holds a vehicle, but it may not be the same one. Without a handle there
+                            // is nothing to tell them apart by, but then no reader knows the old vehicle either.
+                            if (handle == 0 || NativeMemory.s_getScriptEntity(handle) == vehiclePool->GetAddress(index))
+                            {
+                                continue;
+                            }
+                        }
+
+                        if (wasValid)
+                        {
+                            PublishDeleted(EntityPoolKind.Vehicle, index, generations[index], ref handle);
+                        }
+                        if (isValid)
+                        {
+                            _events.Publish(new EntityPoolEvent(EntityPoolKind.Vehicle, index, ++generations[index], 0,
+                                true));
+                        }
+                    }
+                }
             }
 
-            public void Run()
+            private void PublishDeleted(EntityPoolKind kind, uint index, uint generation, ref int handle)
             {
-                _returnEntityHandle = NativeMemory.s_createGuid(_entityAddress);
+                _events.Publish(new EntityPoolEvent(kind, index, generation, handle, false));
+                handle = 0;
             }
         }
 
@@ -3547,19 +5144,39 @@ namespace SHVDN
 
         public static int[] GetPedHandles(int[] modelHashes = null)
         {
+            if (UseEntityPoolSnapshot)
+            {
+                return GetHandlesFromEntityPoolSnapshot(EntityPoolKind.Ped, modelHashes);
+            }
+
             return GetGuidsInFwBasePool(NativeMemory.s_pedPoolAddress, modelHashes);
         }
         public static int[] GetPedHandles(FVector3 position, float radius, int[] modelHashes = null)
         {
+            if (UseEntityPoolSnapshot)
+            {
+                return GetHandlesFromEntityPoolSnapshot(EntityPoolKind.Ped, position, radius, modelHashes);
+            }
+
             return GetGuidsInFwBasePool(NativeMemory.s_pedPoolAddress, position, radius, modelHashes);
         }
 
         public static int[] GetPropHandles(int[] modelHashes = null)
         {
+            if (UseEntityPoolSnapshot)
+            {
+                return GetHandlesFromEntityPoolSnapshot(EntityPoolKind.Object, modelHashes);
+            }
+
             return GetGuidsInFwBasePool(NativeMemory.s_objectPoolAddress, modelHashes);
         }
         public static int[] GetPropHandles(FVector3 position, float radius, int[] modelHashes = null)
         {
+            if (UseEntityPoolSnapshot)
+            {
+                return GetHandlesFromEntityPoolSnapshot(EntityPoolKind.Object, position, radius, modelHashes);
+            }
+
             return GetGuidsInFwBasePool(NativeMemory.s_objectPoolAddress, position, radius, modelHashes);
         }
 
@@ -3579,6 +5196,57 @@ namespace SHVDN
 
             return BuildOneArrayFromElementsOfEntityHandleArrays(vehicleHandles, pedHandles, propHandles);
         }
+        /// <summary>
+        /// Gets the handles of the vehicles, peds and props within an axis-aligned box.
+        /// </summary>
+        public static int[] GetEntityHandlesInBox(FVector3 min, FVector3 max)
+        {
+            const uint KindMask = (1u << (int)EntityPoolKind.Vehicle) | (1u << (int)EntityPoolKind.Ped)
+                | (1u << (int)EntityPoolKind.Object);
+            EntityPoolSnapshot snapshot;
+            if (UseEntityPoolSnapshot)
+            {
+                snapshot = GetEntityPoolSnapshot(EntityPoolKind.Vehicle);
+            }
+            else
+            {
+                snapshot = new EntityPoolSnapshot(false, EntityPoolKind.Vehicle, EntityPoolKind.Ped, EntityPoolKind.Object);
+            }
+
+            return snapshot.GetHandlesInBox(KindMask, min, max);
+        }
+
+        /// <summary>
+        /// Gets the handles of up to <paramref name="count"/> peds closest to a position, sorted by the distance.
+        /// </summary>
+        public static int[] GetClosestPedHandles(FVector3 position, float radius, int count, int[] modelHashes = null)
+            => GetClosestHandlesFromEntityPoolSnapshot(EntityPoolKind.Ped, position, radius, count, modelHashes);
+        /// <summary>
+        /// Gets the handles of up to <paramref name="count"/> vehicles closest to a position, sorted by the distance.
+        /// </summary>
+        public static int[] GetClosestVehicleHandles(FVector3 position, float radius, int count, int[] modelHashes = null)
+            => GetClosestHandlesFromEntityPoolSnapshot(EntityPoolKind.Vehicle, position, radius, count, modelHashes);
+        /// <summary>
+        /// Gets the handles of up to <paramref name="count"/> props closest to a position, sorted by the distance.
+        /// </summary>
+        public static int[] GetClosestPropHandles(FVector3 position, float radius, int count, int[] modelHashes = null)
+            => GetClosestHandlesFromEntityPoolSnapshot(EntityPoolKind.Object, position, radius, count, modelHashes);
+        /// <summary>
+        /// Gets the handles of up to <paramref name="count"/> pickup objects closest to a position, sorted by the distance.
+        /// </summary>
+        public static int[] GetClosestPickupObjectHandles(FVector3 position, float radius, int count)
+            => GetClosestHandlesFromEntityPoolSnapshot(EntityPoolKind.PickupObject, position, radius, count, null);
+        /// <summary>
+        /// Gets the handles of up to <paramref name="count"/> buildings closest to a position, sorted by the distance.
+        /// </summary>
+        public static int[] GetClosestBuildingHandles(FVector3 position, float radius, int count)
+            => GetClosestHandlesFromEntityPoolSnapshot(EntityPoolKind.Building, position, radius, count, null);
+        /// <summary>
+        /// Gets the handles of up to <paramref name="count"/> animated buildings closest to a position, sorted by the
+        /// distance.
+        /// </summary>
+        public static int[] GetClosestAnimatedBuildingHandles(FVector3 position, float radius, int count)
+            => GetClosestHandlesFromEntityPoolSnapshot(EntityPoolKind.AnimatedBuilding, position, radius, count, null);
 
         private static int[] BuildOneArrayFromElementsOfEntityHandleArrays(int[] vehicleHandles, int[] pedHandles, int[] propHandles)
         {
@@ -3594,6 +5262,11 @@ namespace SHVDN
 
         public static int[] GetVehicleHandles(int[] modelHashes = null)
         {
+            if (UseEntityPoolSnapshot)
+            {
+                return GetHandlesFromEntityPoolSnapshot(EntityPoolKind.Vehicle, modelHashes);
+            }
+
             if (*NativeMemory.s_vehiclePoolAddress == 0)
             {
                 return Array.Empty<int>();
@@ -3608,6 +5281,11 @@ namespace SHVDN
         }
         public static int[] GetVehicleHandles(FVector3 position, float radius, int[] modelHashes = null)
         {
+            if (UseEntityPoolSnapshot)
+            {
+                return GetHandlesFromEntityPoolSnapshot(EntityPoolKind.Vehicle, position, radius, modelHashes);
+            }
+
             if (*NativeMemory.s_vehiclePoolAddress == 0)
             {
                 return Array.Empty<int>();
@@ -3623,10 +5301,20 @@ namespace SHVDN
 
         public static int[] GetPickupObjectHandles()
         {
+            if (UseEntityPoolSnapshot)
+            {
+                return GetHandlesFromEntityPoolSnapshot(EntityPoolKind.PickupObject);
+            }
+
             return GetGuidsInFwBasePool(NativeMemory.s_pickupObjectPoolAddress);
         }
         public static int[] GetPickupObjectHandles(FVector3 position, float radius)
         {
+            if (UseEntityPoolSnapshot)
+            {
+                return GetHandlesFromEntityPoolSnapshot(EntityPoolKind.PickupObject, position, radius);
+            }
+
             return GetGuidsInFwBasePool(NativeMemory.s_pickupObjectPoolAddress, position, radius);
         }
         public static int[] GetProjectileHandles()
@@ -3771,6 +5459,11 @@ namespace SHVDN
                 return Array.Empty<int>();
             }
 
+            if (UseEntityPoolSnapshot)
+            {
+                return GetHandlesFromEntityPoolSnapshot(EntityPoolKind.Building, position, radius);
+            }
+
             return GetCEntityHandlesInRange(*NativeMemory.s_buildingPoolAddress, position, radius);
         }
 
@@ -3791,6 +5484,11 @@ namespace SHVDN
                 return Array.Empty<int>();
             }
 
+            if (UseEntityPoolSnapshot)
+            {
+                return GetHandlesFromEntityPoolSnapshot(EntityPoolKind.AnimatedBuilding, position, radius);
+            }
+
             return GetCEntityHandlesInRange(*NativeMemory.s_animatedBuildingPoolAddress, position, radius);
         }
 
@@ -3835,16 +5533,11 @@ namespace SHVDN
 
             // CInteriorProxy is not a subclass of CEntity and position data is placed at different offset
             var returnHandles = new List<int>();
-            uint poolSize = pool->Capacity;
             float radiusSquared = radius * radius;
-            for (uint i = 0; i < poolSize; i++)
+            FwBasePool.OccupiedSlotEnumerator slots = pool->GetOccupiedSlots();
+            while (slots.MoveNext())
             {
-                if (!pool->IsValid(i))
-                {
-                    continue;
-                }
-
-                ulong address = pool->GetAddress(i);
+                ulong address = pool->GetAddress(slots.Current);
 
                 float x = *(float*)(address + 0x70) - position.X;
                 float y = *(float*)(address + 0x74) - position.Y;
@@ -3856,7 +5549,7 @@ namespace SHVDN
                     continue;
                 }
 
-                returnHandles.Add(pool->GetGuidHandleByIndex(i));
+                returnHandles.Add(slots.CurrentHandle);
             }
 
             return returnHandles.ToArray();
@@ -3872,13 +5565,10 @@ namespace SHVDN
             var pool = (FwBasePool*)poolAddress;
 
             var returnHandles = new List<int>(pool->SlotsUsed);
-            uint poolSize = pool->Capacity;
-            for (uint i = 0; i < poolSize; i++)
+            FwBasePool.OccupiedSlotEnumerator slots = pool->GetOccupiedSlots();
+            while (slots.MoveNext())
             {
-                if (pool->IsValid(i))
-                {
-                    returnHandles.Add(pool->GetGuidHandleByIndex(i));
-                }
+                returnHandles.Add(slots.CurrentHandle);
             }
 
             return returnHandles.ToArray();
@@ -3889,17 +5579,12 @@ namespace SHVDN
             var pool = (FwBasePool*)poolAddress;
 
             var returnHandles = new List<int>();
-            uint poolSize = pool->Capacity;
             float radiusSquared = radius * radius;
             float* entityPosition = stackalloc float[4];
-            for (uint i = 0; i < poolSize; i++)
+            FwBasePool.OccupiedSlotEnumerator slots = pool->GetOccupiedSlots();
+            while (slots.MoveNext())
             {
-                if (!pool->IsValid(i))
-                {
-                    continue;
-                }
-
-                ulong address = pool->GetAddress(i);
+                ulong address = pool->GetAddress(slots.Current);
 
                 NativeMemory.s_entityPosFunc(address, entityPosition);
                 float x = entityPosition[0] - position.X;
@@ -3912,7 +5597,7 @@ namespace SHVDN
                     continue;
                 }
 
-                returnHandles.Add(pool->GetGuidHandleByIndex(i));
+                returnHandles.Add(slots.CurrentHandle);
             }
 
             return returnHandles.ToArray();
@@ -0,0 +1,310 @@
+//
+// Copyright (C) 2015 crosire & kagikn & contributors
+// License: https://github.com/scripthookvdotnet/scripthookvdotnet#license
+//
+
+using System.Collections.Generic;
+
+namespace SHVDN
+{
+    /// <summary>
+    /// The patterns <see cref="NativeMemory"/> searches for over the whole main module of the game.
+    /// </summary>
+    /// <remarks>
+    /// <see cref="PatternScanCache"/> finds all of these at once before <see cref="NativeMemory"/> starts its scans
+    /// when it has no usable cache file, so a pattern searched for over the whole module should be added here rather
+    /// than written at the call site. Patterns searched for from the hit of another scan depend on that hit, and are
+    /// written at their call sites.
+    /// </remarks>
+    internal static class NativeMemoryPatterns
+    {
+        // Declared first, since the fields are initialized in order
+        private static readonly List<MemPattern> s_all = new();
+
+        /// <summary>
+        /// Gets all the patterns, in the order they are declared.
+        /// </summary>
+        internal static IReadOnlyList<MemPattern> All => s_all;
+
+        internal static readonly MemPattern FwRefAwareBaseImplAddKnownRef = Add(
+            "\x74\x27\x48\x8D\x7E\x18\x48\x8B\x0F\x48\x3B\xCB\x74\x1B",
+            "xxxxxxxxxxxxxx");
+        internal static readonly MemPattern GetPtfxAddressFunc = Add(
+            "\x74\x21\x48\x8B\x48\x20\x48\x85\xC9\x74\x18\x48\x8B\xD6\xE8",
+            "xxxxxxxxxxxxxxx");
+        internal static readonly MemPattern GetScriptEntity = Add(
+            "\x85\xED\x74\x0F\x8B\xCD\xE8\x00\x00\x00\x00\x48\x8B\xF8\x48\x85\xC0\x74\x2E",
+            "xxxxxxx????xxxxxxxx");
+        internal static readonly MemPattern GetPlayerPedAddressFunc = Add(
+            "\x8B\xC2\xB2\x01\x8B\xC8\xE8\x00\x00\x00\x00\x48\x85\xC0\x74\x53\x8A\x88\x00\x00\x00\x00\xF6\xC1\x01\x75\x05\xF6\xC1\x02\x75\x43\x48",
+            "xxxxxxx????xxxxxxx????xxxxxxxxxxx");
+        internal static readonly MemPattern IsGameMultiplayerAddr = Add(
+            "\x0F\x84\xA1\x00\x00\x00\x33\xC9\x48\x89\x35",
+            "xxxxxxxxxxx");
+        internal static readonly MemPattern CreateGuid = Add(
+            "\x48\xF7\xF9\x49\x8B\x48\x08\x48\x63\xD0\xC1\xE0\x08\x0F\xB6\x1C\x11\x03\xD8",
+            "xxxxxxxxxxxxxxxxxxx");
+        internal static readonly MemPattern EntityPosFunc = Add(
+            "\x40\x53\x48\x83\xEC\x30\x48\x8B\xDA\xE8\x00\x00\x00\x00\xF3\x0F\x10\x44\x24\x2C\x33\xC9\xF3\x0F\x11\x43\x0C\x48\x89\x0B\x89\x4B\x08\x48\x85\xC0\x74\x2C",
+            "xxxxxxxxxx????xxxxxxxxxxxxxxxxxxxxxxxx");
+        internal static readonly MemPattern GetHandlingDataByIndex = Add(
+            "\x8B\xF7\x83\xF8\x01\x77\x08\x44\x8B\xF7\x8D\x77\xFF\xEB\x06\x41\xBE\x03\x00\x00\x00\x8B\x8B",
+            "xxxxxxxxxxxxxxxxxxxxxxx");
+        internal static readonly MemPattern GetHandlingDataByHash = Add(
+            "\x75\x5A\xB2\x01\x48\x8B\xCB\xE8\x00\x00\x00\x00\x41\x8B\xF5\x66\x44\x3B\xAB",
+            "xxxxxxxx????xxxxxxx");
+        internal static readonly MemPattern PedPoolAddress = Add(
+            "\x48\x8B\x05\x00\x00\x00\x00\x41\x0F\xBF\xC8\x0F\xBF\x40\x10",
+            "xxx????xxxxxxxx");
+        internal static readonly MemPattern ObjectPoolAddress = Add(
+            "\x48\x8B\x05\x00\x00\x00\x00\x8B\x78\x10\x85\xFF",
+            "xxx????xxxxx");
+        internal static readonly MemPattern FwScriptGuidPoolAddressSince3788 = Add(
+            "\x4C\x8B\x05\x00\x00\x00\x00\x41\x3B\x50\x00\x7D\x00\x49\x8B\x40",
+            "xxx????xxx?x?xxx");
+        internal static readonly MemPattern FwScriptGuidPoolAddress = Add(
+            "\x4C\x8B\x0D\x00\x00\x00\x00\x44\x8B\xC1\x49\x8B\x41\x08",
+            "xxx????xxxxxxx");
+        internal static readonly MemPattern VehiclePoolAddress = Add(
+            "\x48\x8B\x05\x00\x00\x00\x00\xF3\x0F\x59\xF6\x48\x8B\x08",
+            "xxx????xxxxxxx");
+        internal static readonly MemPattern PickupObjectPoolAddress = Add(
+            "\x4C\x8B\x05\x00\x00\x00\x00\x40\x8A\xF2\x8B\xE9",
+            "xxx????xxxxx");
+        internal static readonly MemPattern BuildingPoolAddress = Add(
+            "\x83\x38\xFF\x74\x27\xD1\xEA\xF6\xC2\x01\x74\x20",
+            "xxxxxxxxxxxx");
+        internal static readonly MemPattern InteriorInstPoolAddress = Add(
+            "\x83\xBB\x80\x01\x00\x00\x01\x75\x12",
+            "xxxxxxxxx");
+        internal static readonly MemPattern InteriorProxyPoolAddress = Add(
+            "\x48\x8B\x0D\x00\x00\x00\x00\xE8\x00\x00\x00\x00\x66\x89\x03",
+            "xxx????x????xxx");
+        internal static readonly MemPattern UiSizeAndGrcDeviceAddress = Add(
+            "\x0F\x84\x87\x00\x00\x00\xFF\xC9\x74\x79\xFF\xC9\x74\x6B\x66\x0F\x6E\x35",
+            "xxxxxxxxxxxxxxxxxx");
+        internal static readonly MemPattern InitMessageMemoryFunc = Add(
+            "\x40\x53\x48\x83\xEC\x20\x83\x61\x0C\x00\x44\x89\x41\x08\x49\x63\xC0",
+            "xxxxxxxxxxxxxxxxx");
+        internal static readonly MemPattern SendNmMessageToPedFunc = Add(
+            "\x0F\x84\x8B\x00\x00\x00\x48\x8B\x47\x30\x48\x8B\x48\x10\x48\x8B\x51\x20\x80\x7A\x10\x0A",
+            "xxxxxxxxxxxxxxxxxxxxxx");
+        internal static readonly MemPattern SetNmParameterInt = Add(
+            "\x48\x89\x5C\x24\x00\x57\x48\x83\xEC\x20\x48\x8B\xD9\x48\x63\x49\x0C\x41\x8B\xF8",
+            "xxxx?xxxxxxxxxxxxxxx");
+        internal static readonly MemPattern SetNmParameterBool = Add(
+            "\x48\x89\x5C\x24\x00\x57\x48\x83\xEC\x20\x48\x8B\xD9\x48\x63\x49\x0C\x41\x8A\xF8",
+            "xxxx?xxxxxxxxxxxxxxx");
+        internal static readonly MemPattern SetNmParameterFloat = Add(
+            "\x40\x53\x48\x83\xEC\x30\x48\x8B\xD9\x48\x63\x49\x0C",
+            "xxxxxxxxxxxxx");
+        internal static readonly MemPattern SetNmParameterString = Add(
+            "\x57\x48\x83\xEC\x20\x48\x8B\xD9\x48\x63\x49\x0C\x49\x8B\xE8",
+            "xxxxxxxxxxxxxxx");
+        internal static readonly MemPattern SetNmParameterVector = Add(
+            "\x40\x53\x48\x83\xEC\x40\x48\x8B\xD9\x48\x63\x49\x0C",
+            "xxxxxxxxxxxxx");
+        internal static readonly MemPattern GetActiveTaskFunc = Add(
+            "\x4D\x8B\xF0\x48\x8B\xF2\xE8\x00\x00\x00\x00\x33\xFF\x48\x85\xC0\x75\x07\x32\xC0\xE9\xD8\x03\x00\x00",
+            "xxxxxxx????xxxxxxxxxxxxxx");
+        internal static readonly MemPattern CTaskNmScriptControlTypeIndex = Add(
+            "\x75\xEF\x48\x8B\x5C\x24\x30\xB8",
+            "xxxxxxxx");
+        internal static readonly MemPattern GetEventTypeIndexVFuncOffset = Add(
+            "\x4C\x8B\x03\x48\x8B\xD5\x48\x8B\xCB\x41\xFF\x50\x00\x83\xFE\x04",
+            "xxxxxxxxxxxx?xxx");
+        internal static readonly MemPattern CEventSwitch2NmVfTableArray = Add(
+            "\x48\x8D\x05\x00\x00\x00\x00\x48\x89\x01\x8B\x44\x24\x50",
+            "xxx????xxxxxxx");
+        internal static readonly MemPattern FragInstNmGtaOffset = Add(
+            "\x48\x83\xEC\x28\x48\x8B\x42\x00\x48\x85\xC0\x74\x09\x48\x3B\x82\x00\x00\x00\x00\x74\x21",
+            "xxxxxxx?xxxxxxxx????xx");
+        internal static readonly MemPattern FragInstNmGtaGetUnkValVFuncOffset = Add(
+            "\xB2\x01\x48\x8B\x01\xFF\x90\x00\x00\x00\x00\x80",
+            "xxxxxxx????x");
+        internal static readonly MemPattern GetLabelTextByHashAddress = Add(
+            "\x84\xC0\x74\x34\x48\x8D\x0D\x00\x00\x00\x00\x48\x8B\xD3",
+            "xxxxxxx????xxx");
+        internal static readonly MemPattern DoesTextLabelExistFunc = Add(
+            "\x74\x64\x48\x8D\x15\x00\x00\x00\x00\x48\x8D\x0D\x00\x00\x00\x00\xE8\x00\x00\x00\x00\x84\xC0\x74\x33",
+            "xxxxx????xxx????x????xxxx");
+        internal static readonly MemPattern CheckpointPoolAddress = Add(
+            "\x8A\x4C\x24\x60\x8B\x50\x10\x44\x8A\xCE",
+            "xxxxxxxxxx");
+        internal static readonly MemPattern RadarBlipPoolAddress = Add(
+            "\x3B\x35\x00\x00\x00\x00\x74\x00\x48\x81\xFD",
+            "xx????x?xxx");
+        internal static readonly MemPattern PossibleRadarBlipCountAddress = Add(
+            "\xFF\xC6\x49\x83\xC6\x08\x3B\x35\x00\x00\x00\x00\x7C\x9B",
+            "xxxxxxxx????xx");
+        internal static readonly MemPattern UnkFirstRadarBlipIndexAddress = Add(
+            "\x8B\x44\x0A\x20\x89\x01\x48\x8D\x49\x04\x49\xFF\xC8\x75\xF1\xF3\xC3\x48\x63\x05",
+            "xxxxxxxxxxxxxxxxxxxx");
+        internal static readonly MemPattern NorthRadarBlipHandleAddress = Add(
+            "\x41\xB8\x07\x00\x00\x00\x8B\xD0\x89\x05\x00\x00\x00\x00\x41\x8D\x48\xFC",
+            "xxxxxxxxxx????xxxx");
+        internal static readonly MemPattern CenterRadarBlipHandleAddress = Add(
+            "\x41\xB8\x06\x00\x00\x00\x8B\xD0\x89\x05\x00\x00\x00\x00\x41\x8D\x48\xFD",
+            "xxxxxxxxxx????xxxx");
+        internal static readonly MemPattern GetLocalPlayerPedAddressFunc = Add(
+            "\x33\xDB\xE8\x00\x00\x00\x00\x48\x85\xC0\x74\x07\x48\x8B\x40\x20\x8B\x58\x18",
+            "xxx????xxxxxxxxxxxx");
+        internal static readonly MemPattern WaypointInfoArrayStartAddress = Add(
+            "\x4C\x8D\x05\x00\x00\x00\x00\x74\x07\xB8\x00\x00\x00\x00\xEB\x2D\x33\xC0",
+            "xxx????xxx????xxxx");
+        internal static readonly MemPattern IsDecoratorLocked = Add(
+            "\x80\x3D\x00\x00\x00\x00\x00\x8B\xDA\x75\x29\x48\x8B\xD1\x33\xC9\xE8",
+            "xx????xxxxxxxxxxx");
+        internal static readonly MemPattern GetRotationFromMatrixFunc = Add(
+            "\xF3\x0F\x10\x5C\x24\x20\xF3\x0F\x10\x54\x24\x24\xF3\x0F\x59\xD9\xF3\x0F\x59\xD1\xF3\x0F\x10\x44\x24\x28\xF3\x0F\x11\x1F",
+            "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxx");
+        internal static readonly MemPattern GetQuaternionFromMatrixFunc = Add(
+            "\xF3\x0F\x11\x4D\x38\xF3\x0F\x11\x45\x3C\xE8\x00\x00\x00\x00\x0F\x28\xC6\x0F\x28\xCE\xB9\x01\x00\x00\x00\xF3\x0F\x11\x73\x10\x66\x44\x03\xE9",
+            "xxxxxxxxxxx????xxxxxxxxxxxxxxxxxxxx");
+        internal static readonly MemPattern EntityMaxHealthOffset = Add(
+            "\x48\x8B\x42\x20\x48\x85\xC0\x74\x09\xF3\x0F\x10\x80",
+            "xxxxxxxxxxxxx");
+        internal static readonly MemPattern SetAngularVelocityVFuncOfEntityOffset = Add(
+            "\x75\x11\x48\x8B\x06\x48\x8D\x54\x24\x20\x48\x8B\xCE\xFF\x90",
+            "xxxxxxxxxxxxxxx");
+        internal static readonly MemPattern CAttackerArrayOfEntityOffset = Add(
+            "\x48\x8B\x89\x00\x00\x00\x00\x33\xC0\x44\x8B\xC2\x48\x85\xC9\x74\x20",
+            "xxx????xxxxxxxxxx");
+        internal static readonly MemPattern CursorSpriteAddr = Add(
+            "\x74\x11\x8B\xD1\x48\x8D\x0D\x00\x00\x00\x00\x45\x33\xC0",
+            "xxxxxxx????xxx");
+        internal static readonly MemPattern ReadWorldGravityAddress = Add(
+            "\x48\x63\xC1\x48\x8D\x0D\x00\x00\x00\x00\xF3\x0F\x10\x04\x81\xF3\x0F\x11\x05",
+            "xxxxxx????xxxxxxxxx");
+        internal static readonly MemPattern TimeScaleArray = Add(
+            "\xF3\x0F\x11\x05\x00\x00\x00\x00\xF3\x0F\x10\x08\x0F\x2F\xC8\x73\x03\x0F\x28\xC1\x48\x83\xC0\x04\x49\x2B",
+            "xxxx????xxxxxxxxxxxxxxxxxx");
+        internal static readonly MemPattern UnkClockFunc = Add(
+            "\xF3\x0F\x11\xB5\x60\x01\x00\x00\x84\xC0\x75\x4C\x85\xC9\x79\x1D\x33\xD2\xE8",
+            "xxxxxxxxxxxxxxxxxxx");
+        internal static readonly MemPattern IsClockPausedAddress = Add(
+            "\x75\x2D\x44\x38\x3D\x00\x00\x00\x00\x75\x24",
+            "xxxxx????xx");
+        internal static readonly MemPattern CameraPoolAddress = Add(
+            "\x48\x8B\x0D\x00\x00\x00\x00\x48\x8B\xD7\xE8\x00\x00\x00\x00\x8B\xD8\x8B\xC3",
+            "xxx????xxxx????xxxx");
+        internal static readonly MemPattern GameplayCameraAddress = Add(
+            "\x48\x8B\xC7\xF3\x0F\x10\x0D",
+            "xxxxxxx");
+        internal static readonly MemPattern VehicleTypeOffsetInModelInfo = Add(
+            "\x3C\x05\x75\x16\x8B\x81",
+            "xxxxxx");
+        internal static readonly MemPattern VehicleClassOffset = Add(
+            "\x66\x81\xF9\x00\x00\x74\x10\x4D\x85\xC0",
+            "xxx??xxxxx");
+        internal static readonly MemPattern ModelInfoArrayPtr = Add(
+            "\x33\xD2\x00\x8B\xD0\x00\x2B\x05\x00\x00\x00\x00\xC1\xE6\x10",
+            "xx?xx?xx????xxx");
+        internal static readonly MemPattern CStreamingAddr = Add(
+            "\x48\x83\xEC\x20\x48\x8B\x91\x00\x00\x00\x00\x33\xF6\x48\x8B\xD9\x48\x85\xD2\x74\x2B\x48\x8D\x0D",
+            "xxxxxxx??xxxxxxxxxxxxxxx");
+        internal static readonly MemPattern UnkFuncForVehicleModelIndices = Add(
+            "\x44\x39\x38\x74\x17\x48\xFF\xC1\x48\x83\xC0\x04\x48\x3B\xCB\x7C\xEF\x41\x8B\xD7\x49\x8B\xCE\xE8",
+            "xxxxxxxxxxxxxxxxxxxxxxxx");
+        internal static readonly MemPattern UnkFuncForPedModelIndices = Add(
+            "\x75\x0D\x8B\xD7\x49\x8B\xCE\xE8\x00\x00\x00\x00\x41\x2B\xDD\x45\x03\xFD\x41\x03\xDD\x41\x3B\xDC\x0F\x8C\x9A\xFE\xFF\xFF",
+            "xxxxxxxx????xxxxxxxxxxxxxxxxxx");
+        internal static readonly MemPattern WeaponAndAmmoInfoArrayPtr = Add(
+            "\x48\x8B\x05\x00\x00\x00\x00\x41\x8B\x1E",
+            "xxx????xxx");
+        internal static readonly MemPattern WeaponInfoHumanNameHashOffset = Add(
+            "\x84\xC0\x74\x20\x48\x8B\x47\x40\x48\x85\xC0\x74\x08\x8B\xB0\x00\x00\x00\x00\xEB\x02\x33\xF6\x48\x8D\x4D\x48\xE8",
+            "xxxxxxxxxxxxxxx????xxxxxxxxx");
+        internal static readonly MemPattern WeaponComponentArrayCountAddr = Add(
+            "\x8B\x05\x00\x00\x00\x00\x44\x8B\xD3\x8D\x48\xFF",
+            "xx????xxxxxx");
+        internal static readonly MemPattern VehicleMakeNameOffsetInModelInfo = Add(
+            "\x24\x1F\x3C\x05\x0F\x85\x00\x00\x00\x00\x48\x8D\x82\x00\x00\x00\x00\x48\x8D\xB2\x00\x00\x00\x00\x48\x85\xC0\x74\x09\x80\x38\x00\x74\x04\x8A\xCB",
+            "xxxxxx????xxx????xxx????xxxxxxxxxxxx");
+        internal static readonly MemPattern PedPersonalityIndexOffsetInModelInfo = Add(
+            "\x66\x89\x44\x24\x38\x8B\x44\x24\x38\x8B\xC8\x33\x4C\x24\x30\x81\xE1\x00\x00\xFF\x0F\x33\xC1\x0F\xBA\xF0\x1D\x8B\xC8\x33\x4C\x24\x30\x23\xCB\x33\xC1",
+            "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx");
+        internal static readonly MemPattern PedIntelligenceOffset = Add(
+            "\x48\x85\xC0\x74\x7F\xF6\x80\x00\x00\x00\x00\x02\x75\x76",
+            "xxxxxxx????xxx");
+        internal static readonly MemPattern CPlayerInfoMaxHealthOffset = Add(
+            "\x66\x0F\x6E\xF0\x0F\x5B\xF6\xE8\x00\x00\x00\x00\x0F\x28\xCE\x41\xB1\x01\x45\x33\xC0\x48\x8B\xC8\xE8",
+            "xxxxxxxx????xxxxxxxxxxxxx");
+        internal static readonly MemPattern CPlayerPedTargetingOffset = Add(
+            "\x48\x85\xFF\x74\x23\x48\x85\xDB\x74\x26",
+            "xxxxxxxxxx");
+        internal static readonly MemPattern CWantedOffset = Add(
+            "\x48\x85\xFF\x74\x3F\x48\x8B\xCF\xE8",
+            "xxxxxxxxx");
+        internal static readonly MemPattern CurrentCrimeValueOffset = Add(
+            "\x45\x84\xC9\x74\x32\x8B\x41\x00\x85\xC0\x74\x2B",
+            "xxxxxxx?xxxx");
+        internal static readonly MemPattern IsWantedStarFlashingOffset = Add(
+            "\xF6\x87\x00\x00\x00\x00\x02\x44\x8B\x00\x00\x00\x00\x00\x75\x0E",
+            "xx??xxxxx?????xx");
+        internal static readonly MemPattern ActivateSpecialAbilityFunc = Add(
+            "\xEB\x26\x8B\x87\x00\x00\x00\x00\x25\x00\xF8\xFF\xFF\xC1\xE0\x12",
+            "xxxx????xxxxxxxx");
+        internal static readonly MemPattern GetSpecialAbilityAddressFunc = Add(
+            "\x0F\x84\x49\x01\x00\x00\x33\xD2\xE8",
+            "xxxxxxxxx");
+        internal static readonly MemPattern PlayerPedSpecialAbilityOffset = Add(
+            "\x0F\x84\x46\x01\x00\x00\x48\x8B\x9B",
+            "xxxxxxxxx");
+        internal static readonly MemPattern ObjParentEntityAddressDetachedFromOffset = Add(
+            "\x48\x8B\x87\x00\x00\x00\x00\x48\x85\xC0\x0F\x84\x8B\x00\x00\x00",
+            "xxx????xxxxxxxxx");
+        internal static readonly MemPattern ProjectilePoolAddress = Add(
+            "\x48\x8D\x1D\x00\x00\x00\x00\x4C\x8B\x0B\x4D\x85\xC9\x74\x67",
+            "xxx????xxxxxxxx");
+        internal static readonly MemPattern ProjectileCountAddress = Add(
+            "\x44\x8B\x0D\x00\x00\x00\x00\x33\xDB\x45\x8A\xF8",
+            "xxx????xxxxx");
+        internal static readonly MemPattern ProjectileOwnerOffset = Add(
+            "\x48\x85\xED\x74\x09\x48\x39\xA9\x00\x00\x00\x00\x75\x2D",
+            "xxxxxxxx????xx");
+        internal static readonly MemPattern ProjectileAmmoInfoOffset = Add(
+            "\x45\x85\xF6\x74\x0D\x48\x8B\x81\x00\x00\x00\x00\x44\x39\x70\x10",
+            "xxxxxxxx????xxxx");
+        internal static readonly MemPattern GetAsCProjectileRocketConstVFuncOffset = Add(
+            "\x0F\x84\xBE\x00\x00\x00\x48\x8B\x0E\x48\x39\x88\x00\x00\x00\x00\x0F\x85\xAE\x00\x00\x00",
+            "xxxxxxxxxxxx??xxxxxxxx");
+        internal static readonly MemPattern ProjectileRocketTargetOffset = Add(
+            "\x74\x33\x48\x39\x98\x00\x00\x00\x00\x75\x2A\x48\x8B\x0F\x48\x3B\xCB",
+            "xxxxx??xxxxxxxxxx");
+        internal static readonly MemPattern ExplodeProjectileFunc = Add(
+            "\x39\x70\x10\x75\x17\x40\x84\xED\x74\x09\x33\xD2\xE8",
+            "xxxxxxxxxxxxx");
+        internal static readonly MemPattern GetFragInstVFuncOffset = Add(
+            "\x0F\x84\x8F\x00\x00\x00\x8A\x48\x28\x80\xE9\x02\x80\xF9\x03\x0F\x87\x80\x00\x00\x00\x48\x8B\x10\x48\x8B\xC8\xFF\x52",
+            "xxxxxxxxxxxxxxxxxxxxxxxxxxxxx");
+        internal static readonly MemPattern FragInstBreakOffAboveFunc = Add(
+            "\x0F\xBE\x5E\x06\x48\x8B\xCF\xFF\x50\x00\x8B\xD3\x48\x8B\xC8\xE8\x00\x00\x00\x00\x8B\x4E",
+            "xxxxxxxxx?xxxxxx????xx");
+        internal static readonly MemPattern PhSimulatorInstPtr = Add(
+            "\x74\x56\x48\x8B\x0D\x00\x00\x00\x00\x41\x0F\xB7\xD0\x45\x33\xC9\x45\x33\xC0",
+            "xxxxx????xxxxxxxxxx");
+        internal static readonly MemPattern ColliderCapacityOffset = Add(
+            "\xC0\xE8\x07\xA8\x01\x74\x57\x0F\xB7\x4E\x18\x85\xC9\x78\x4F",
+            "xxxxxxxxxxxxxxx");
+        internal static readonly MemPattern InteriorProxyPtrFromGameplayCamAddress = Add(
+            "\x48\x8B\x1D\x00\x00\x00\x00\x48\x85\xDB\x74\x04\x48\x8B\x5B\x48",
+            "xxx????xxxxxxxxx");
+        internal static readonly MemPattern RadarZoomValueAddress = Add(
+            "\x8D\x43\x64\x89\x05\x00\x00\x00\x00",
+            "xxxxx????");
+        internal static readonly MemPattern DrawableCollisionCheck = Add(
+            "\x74\x00\x00\x00\x00\x74\x00\xe8\x00\x00\x00\x00\x48\x85\xc0\x75\x00\x38\x00\x00\x0f\x84\x00\x00\x00\x00\x48\x8d\x4d\x00\xe8\x00\x00\x00\x00\x66\x89\x45\x00\x8b\x45\x00\x8b\xc8\x33\x4d",
+            "x????x?x????xxxx?x??xx????xxx?x????xxx?xx?xxxx");
+        internal static readonly MemPattern YscScriptTable = Add(
+            "\x48\x03\x15\x00\x00\x00\x00\x4C\x23\xC2\x49\x8B\x08",
+            "xxx????xxxxxx");
+
+        private static MemPattern Add(string pattern, string mask)
+        {
+            var memPattern = new MemPattern(pattern, mask);
+            s_all.Add(memPattern);
+            return memPattern;
+        }
+    }
+}
@@ -0,0 +1,426 @@
+//
+// Copyright (C) 2015 crosire & kagikn & contributors
+// License: https://github.com/scripthookvdotnet/scripthookvdotnet#license
+//
+
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Globalization;
+using System.IO;
+using System.Linq;
+using System.Reflection;
+using System.Text;
+
+namespace SHVDN
+{
+    /// <summary>
+    /// Records how many times each native function is called by each script and how long the calls take.
+    /// </summary>
+    /// <remarks>
+    /// Each script records into its own <see cref="NativeProfileBuffer"/>, and the buffers are merged into the results
+    /// at the end of each tick of the script domain. A buffer takes a lock that is almost never contended, since
+    /// natives can also be called from background threads of a script such as job workers. While the profiler is not
+    /// recording, the only overhead on a native call is a read of a volatile field.
+    /// All the methods other than <see cref="Record(ulong, long)"/> must be called in the main thread of the script
+    /// domain.
+    /// </remarks>
+    internal static class NativeProfiler
+    {
+        /// <summary>
+        /// The number of buckets of the latency histogram. The first bucket counts calls that took less than
+        /// 1 microsecond, the bucket <c>n</c> counts calls that took [2^(n-1), 2^n) microseconds, and the last bucket
+        /// counts all the calls that took longer.
+        /// </summary>
+        internal const int HistogramBucketCount = 16;
+
+        private const string ScriptDomainCallerName = "(script domain)";
+
+        private static volatile bool s_isRecording;
+        private static long s_recordEndTimestamp;
+        private static long s_recordStartTimestamp;
+        private static long s_recordedTicks;
+
+        // Records native calls that are not made by a script, such as ones from the console
+        private static readonly NativeProfileBuffer s_scriptDomainBuffer = new();
+        // Taken only when a script records its first native call, so two threads of the script don't create a buffer each
+        private static readonly object s_bufferCreationLock = new();
+        private static readonly Dictionary<CallerAndHash, NativeCallStats> s_results = new();
+        private static Dictionary<ulong, string> s_hashNames;
+
+        internal readonly struct CallerAndHash : IEquatable<CallerAndHash>
+        {
+            public CallerAndHash(string caller, ulong hash)
+            {
+                Caller = caller;
+                Hash = hash;
+            }
+
+            public string Caller { get; }
+            public ulong Hash { get; }
+
+            public bool Equals(CallerAndHash other) => Hash == other.Hash && Caller == other.Caller;
+            public override bool Equals(object obj) => obj is CallerAndHash other && Equals(other);
+            public override int GetHashCode() => Hash.GetHashCode() ^ (Caller?.GetHashCode() ?? 0);
+        }
+
+        /// <summary>
+        /// Gets whether the profiler is recording native calls.
+        /// </summary>
+        internal static bool IsRecording => s_isRecording;
+
+        /// <summary>
+        /// Discards the previous results and starts recording native calls.
+        /// </summary>
+        /// <param name="durationInMilliseconds">How long to record native calls for.</param>
+        internal static void Start(int durationInMilliseconds)
+        {
+            s_results.Clear();
+            s_scriptDomainBuffer.Reset();
+
+            ScriptDomain domain = ScriptDomain.CurrentDomain;
+            if (domain != null)
+            {
+                foreach (Script script in domain.RunningScripts)
+                {
+                    script.NativeProfileBuffer?.Reset();
+                }
+            }
+
+            s_recordStartTimestamp = Stopwatch.GetTimestamp();
+            s_recordEndTimestamp = s_recordStartTimestamp + durationInMilliseconds * Stopwatch.Frequency / 1000;
+            s_recordedTicks = 0;
+            s_isRecording = true;
+        }
+
+        /// <summary>
+        /// Records a native call. Called on every native call while the profiler is recording.
+        /// </summary>
+        /// <param name="hash">The hash of the called native function.</param>
+        /// <param name="elapsedTicks">The time the call took in <see cref="Stopwatch"/> ticks.</param>
+        internal static void Record(ulong hash, long elapsedTicks)
+        {
+            Script script = ScriptDomain.ExecutingScript;
+            NativeProfileBuffer buffer;
+            if (script != null)
+            {
+                buffer = script.NativeProfileBuffer;
+                if (buffer == null)
+                {
+                    lock (s_bufferCreationLock)
+                    {
+                        buffer = script.NativeProfileBuffer ??= new NativeProfileBuffer();
+                    }
+                }
+            }
+            else
+            {
+                buffer = s_scriptDomainBuffer;
+            }
+
+            buffer.Record(hash, elapsedTicks);
+        }
+
+        /// <summary>
+        /// Merges the native calls recorded in this tick into the results, and stops recording if the duration passed
+        /// to <see cref="Start(int)"/> has elapsed.
+        /// </summary>
+        internal static void OnTickEnd(ScriptDomain domain)
+        {
+            if (!s_isRecording)
+            {
+                return;
+            }
+
+            MergeBuffers(domain);
+
+            if (Stopwatch.GetTimestamp() < s_recordEndTimestamp)
+            {
+                return;
+            }
+
+            s_isRecording = false;
+            s_recordedTicks = Stopwatch.GetTimestamp() - s_recordStartTimestamp;
+
+            Log.Message(Log.Level.Info, "Finished profiling native calls. Use \"DumpNativeProfile(path)\" to save the results.");
+            foreach (string line in GetSummaryLines(10))
+            {
+                Log.Message(Log.Level.Info, line);
+            }
+        }
+
+        /// <summary>
+        /// Gets a summary of the native functions that took the most total time, summed over all scripts.
+        /// </summary>
+        /// <param name="maxCount">The max number of native functions to include.</param>
+        internal static IEnumerable<string> GetSummaryLines(int maxCount)
+        {
+            var statsPerHash = new Dictionary<ulong, NativeCallStats>();
+            foreach (KeyValuePair<CallerAndHash, NativeCallStats> kvp in s_results)
+            {
+                if (!statsPerHash.TryGetValue(kvp.Key.Hash, out NativeCallStats stats))
+                {
+                    stats = new NativeCallStats();
+                    statsPerHash.Add(kvp.Key.Hash, stats);
+                }
+
+                stats.MergeFrom(kvp.Value);
+            }
+
+            return statsPerHash
+                .OrderByDescending(x => x.Value.TotalTicks)
+                .Take(maxCount)
+                .Select(x => string.Format(CultureInfo.InvariantCulture,
+                    "{0}: {1} calls, {2:F3} ms total, {3:F2} us avg, {4:F2} us max",
+                    GetHashName(x.Key), x.Value.CallCount, TicksToMilliseconds(x.Value.TotalTicks),
+                    TicksToMicroseconds(x.Value.TotalTicks) / x.Value.CallCount,
+                    TicksToMicroseconds(x.Value.MaxTicks)));
+        }
+
+        /// <summary>
+        /// Writes the results to a CSV file with one row per script and native function.
+        /// </summary>
+        /// <param name="path">The path of the file to write to.</param>
+        /// <returns>The number of rows written.</returns>
+        internal static int WriteCsv(string path)
+        {
+            if (s_isRecording)
+            {
+                MergeBuffers(ScriptDomain.CurrentDomain);
+            }
+
+            var sb = new StringBuilder();
+            sb.Append("Script,Hash,Name,Calls,TotalMs,AvgUs,MaxUs,ShareOfRecordedTime");
+            for (int i = 0; i < HistogramBucketCount - 1; i++)
+            {
+                sb.Append(",Lt").Append(1 << i).Append("us");
+            }
+            sb.Append(",Ge").Append(1 << (HistogramBucketCount - 2)).Append("us");
+            sb.AppendLine();
+
+            long recordedTicks = s_isRecording ? Stopwatch.GetTimestamp() - s_recordStartTimestamp : s_recordedTicks;
+
+            int rowCount = 0;
+            foreach (KeyValuePair<CallerAndHash, NativeCallStats> kvp in s_results.OrderByDescending(x => x.Value.TotalTicks))
+            {
+                NativeCallStats stats = kvp.Value;
+                sb.AppendFormat(CultureInfo.InvariantCulture, "{0},0x{1:X16},{2},{3},{4:F3},{5:F3},{6:F3},{7:F6}",
+                    EscapeCsvField(kvp.Key.Caller), kvp.Key.Hash, GetHashName(kvp.Key.Hash), stats.CallCount,
+                    TicksToMilliseconds(stats.TotalTicks), TicksToMicroseconds(stats.TotalTicks) / stats.CallCount,
+                    TicksToMicroseconds(stats.MaxTicks),
+                    recordedTicks > 0 ? (double)stats.TotalTicks / recordedTicks : 0.0);
+                foreach (long count in stats.Histogram)
+                {
+                    sb.Append(',').Append(count.ToString(CultureInfo.InvariantCulture));
+                }
+                sb.AppendLine();
+                rowCount++;
+            }
+
+            File.WriteAllText(path, sb.ToString());
+            return rowCount;
+        }
+
+        /// <summary>
+        /// Gets the name of a native function from the <c>GTA.Native.Hash</c> enums of the loaded scripting API
+        /// assemblies, or the hash as a hexadecimal string if the name is not found.
+        /// </summary>
+        internal static string GetHashName(ulong hash)
+        {
+            if (s_hashNames == null)
+            {
+                s_hashNames = BuildHashNameDictionary();
+            }
+
+            return s_hashNames.TryGetValue(hash, out string name) ? name : "0x" + hash.ToString("X16");
+        }
+
+        internal static int GetHistogramBucketIndex(long elapsedTicks)
+        {
+            long elapsedMicroseconds = elapsedTicks * 1000000 / Stopwatch.Frequency;
+
+            int index = 0;
+            while (elapsedMicroseconds > 0 && index < HistogramBucketCount - 1)
+            {
+                elapsedMicroseconds >>= 1;
+                index++;
+            }
+
+            return index;
+        }
+
+        private static void MergeBuffers(ScriptDomain domain)
+        {
+            s_scriptDomainBuffer.MergeInto(s_results, ScriptDomainCallerName);
+
+            if (domain == null)
+            {
+                return;
+            }
+
+            foreach (Script script in domain.RunningScripts)
+            {
+                script.NativeProfileBuffer?.MergeInto(s_results, script.Name);
+            }
+        }
+
+        private static Dictionary<ulong, string> BuildHashNameDictionary()
+        {
+            var result = new Dictionary<ulong, string>();
+
+            // Prefer names of newer API versions, as names in the v2 API are older ones
+            IEnumerable<Assembly> apiAssemblies = AppDomain.CurrentDomain.GetAssemblies()
+                .Where(x => x.GetName().Name.StartsWith("ScriptHookVDotNet", StringComparison.OrdinalIgnoreCase))
+                .OrderByDescending(x => x.GetName().Name, StringComparer.OrdinalIgnoreCase);
+            foreach (Assembly asm in apiAssemblies)
+            {
+                Type hashType = asm.GetType("GTA.Native.Hash", false);
+                if (hashType == null || !hashType.IsEnum)
+                {
+                    continue;
+                }
+
+                foreach (FieldInfo field in hashType.GetFields(BindingFlags.Public | BindingFlags.Static))
+                {
+                    ulong hash = Convert.ToUInt64(field.GetRawConstantValue(), CultureInfo.InvariantCulture);
+                    if (!result.ContainsKey(hash))
+                    {
+                        result.Add(hash, field.Name);
+                    }
+                }
+            }
+
+            return result;
+        }
+
+        private static string EscapeCsvField(string value)
+        {
+            if (value == null)
+            {
+                return string.Empty;
+            }
+            if (value.IndexOfAny(new[] { ',', '"', '\n', '\r' }) < 0)
+            {
+                return value;
+            }
+
+            return "\"" + value.Replace("\"", "\"\"") + "\"";
+        }
+
+        private static double TicksToMilliseconds(long ticks) => ticks * 1000.0 / Stopwatch.Frequency;
+        private static double TicksToMicroseconds(long ticks) => ticks * 1000000.0 / Stopwatch.Frequency;
+
+        /// <summary>
+        /// The statistics of calls to one native function.
+        /// </summary>
+        internal sealed class NativeCallStats
+        {
+            public long CallCount;
+            public long TotalTicks;
+            public long MaxTicks;
+            public readonly long[] Histogram = new long[HistogramBucketCount];
+
+            public void Add(long elapsedTicks)
+            {
+                CallCount++;
+                TotalTicks += elapsedTicks;
+                if (elapsedTicks > MaxTicks)
+                {
+                    MaxTicks = elapsedTicks;
+                }
+                Histogram[GetHistogramBucketIndex(elapsedTicks)]++;
+            }
+
+            public void MergeFrom(NativeCallStats other)
+            {
+                CallCount += other.CallCount;
+                TotalTicks += other.TotalTicks;
+                if (other.MaxTicks > MaxTicks)
+                {
+                    MaxTicks = other.MaxTicks;
+                }
+                for (int i = 0; i < Histogram.Length; i++)
+                {
+                    Histogram[i] += other.Histogram[i];
+                }
+            }
+
+            public void Reset()
+            {
+                CallCount = 0;
+                TotalTicks = 0;
+                MaxTicks = 0;
+                Array.Clear(Histogram, 0, Histogram.Length);
+            }
+        }
+
+        /// <summary>
+        /// The native calls recorded for one caller since the last merge. All the methods lock the buffer, since
+        /// natives can be called from any thread of the caller while the script domain merges the buffer.
+        /// </summary>
+        internal sealed class NativeProfileBuffer
+        {
+            private readonly object _lock = new();
+            private readonly Dictionary<ulong, NativeCallStats> _stats = new();
+            // The stats touched since the last merge, so merging does not have to visit every native the caller
+            // has ever called
+            private readonly List<NativeCallStats> _touched = new();
+            private readonly List<ulong> _touchedHashes = new();
+
+            public void Record(ulong hash, long elapsedTicks)
+            {
+                lock (_lock)
+                {
+                    if (!_stats.TryGetValue(hash, out NativeCallStats stats))
+                    {
+                        stats = new NativeCallStats();
+                        _stats.Add(hash, stats);
+                    }
+                    if (stats.CallCount == 0)
+                    {
+                        _touched.Add(stats);
+                        _touchedHashes.Add(hash);
+                    }
+
+                    stats.Add(elapsedTicks);
+                }
+            }
+
+            public void MergeInto(Dictionary<CallerAndHash, NativeCallStats> results, string callerName)
+            {
+                lock (_lock)
+                {
+                    for (int i = 0; i < _touched.Count; i++)
+                    {
+                        var key = new CallerAndHash(callerName, _touchedHashes[i]);
+                        if (!results.TryGetValue(key, out NativeCallStats merged))
+                        {
+                            merged = new NativeCallStats();
+                            results.Add(key, merged);
+                        }
+
+                        merged.MergeFrom(_touched[i]);
+                        _touched[i].Reset();
+                    }
+
+                    _touched.Clear();
+                    _touchedHashes.Clear();
+                }
+            }
+
+            public void Reset()
+            {
+                lock (_lock)
+                {
+                    foreach (NativeCallStats stats in _touched)
+                    {
+                        stats.Reset();
+                    }
+
+                    _touched.Clear();
+                    _touchedHashes.Clear();
+                }
+            }
+        }
+    }
+}
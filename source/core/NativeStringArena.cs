@@ -0,0 +1,198 @@
+//
+// Copyright (C) 2015 crosire & kagikn & contributors
+// License: https://github.com/scripthookvdotnet/scripthookvdotnet#license
+//
+
+using System;
+using System.Collections.Generic;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using System.Text;
+
+namespace SHVDN
+{
+    /// <summary>
+    /// Holds the null-terminated UTF-8 copies of the strings passed to native functions in a frame. The strings are
+    /// encoded straight into native blocks that are reused every frame, and are all released at once at the end of
+    /// the frame.
+    /// </summary>
+    /// <remarks>
+    /// <para>
+    /// String literals, such as text labels and texture dictionary names, are passed again every frame as the same
+    /// string instance, so a short string pinned in two frames in a row is copied once into memory that is kept until
+    /// the arena is disposed. Strings are only looked up by reference, so strings built at runtime with the same
+    /// content are just copied to the frame blocks, and no lookup hashes the content of a string.
+    /// </para>
+    /// <para>
+    /// This class is not thread safe. <see cref="ScriptDomain"/> takes a lock around it, since scripts can pin
+    /// strings from their own tasks and job workers as well as from their script threads.
+    /// </para>
+    /// </remarks>
+    internal sealed unsafe class NativeStringArena : IDisposable
+    {
+        private const int BlockSize = 64 * 1024;
+        // Longer strings are rarely passed every frame, and would take a lot of memory kept until the arena is disposed
+        private const int MaxInternedStringLength = 64;
+        // Scripts that pin many long-lived strings could otherwise grow the table without bound
+        private const int MaxInternedStringCount = 4096;
+        // Scripts that pin many strings in a frame would otherwise grow the candidate sets without bound
+        private const int MaxCandidateStringCount = 1024;
+
+        private readonly List<IntPtr> _blocks = new();
+        private int _currentBlockIndex = -1;
+        private byte* _current;
+        private byte* _currentEnd;
+        // Strings too large for a block, freed at the end of the frame
+        private readonly List<IntPtr> _largeStrings = new();
+
+        private readonly Dictionary<string, IntPtr> _internedStrings = new(ReferenceComparer.Instance);
+        // The short strings pinned in the last and the current frame, which are interned when pinned again in the next
+        private HashSet<string> _lastFrameCandidates = new(ReferenceComparer.Instance);
+        private HashSet<string> _currentFrameCandidates = new(ReferenceComparer.Instance);
+
+        /// <summary>
+        /// Copies a string to the arena as null-terminated UTF-8.
+        /// </summary>
+        /// <returns>
+        /// A pointer to the copy, valid until <see cref="Reset"/> is called, or <see cref="IntPtr.Zero"/> if
+        /// <paramref name="str"/> is <see langword="null"/>.
+        /// </returns>
+        internal IntPtr Pin(string str)
+        {
+            if (str == null)
+            {
+                return IntPtr.Zero;
+            }
+
+            if (_internedStrings.TryGetValue(str, out IntPtr interned))
+            {
+                return interned;
+            }
+
+            if (str.Length <= MaxInternedStringLength && _internedStrings.Count < MaxInternedStringCount)
+            {
+                if (_lastFrameCandidates.Contains(str))
+                {
+                    interned = StringMarshal.StringToCoTaskMemUtf8(str);
+                    _internedStrings.Add(str, interned);
+                    return interned;
+                }
+
+                if (_currentFrameCandidates.Count < MaxCandidateStringCount)
+                {
+                    _currentFrameCandidates.Add(str);
+                }
+            }
+
+            return Pin(str, 0, str.Length);
+        }
+
+        /// <summary>
+        /// Copies a part of a string to the arena as null-terminated UTF-8, without creating a substring.
+        /// </summary>
+        /// <returns>A pointer to the copy, valid until <see cref="Reset"/> is called.</returns>
+        internal IntPtr Pin(string str, int startIndex, int length)
+        {
+            // A char takes at most 3 bytes in UTF-8, as a surrogate pair takes 4 bytes for 2 chars
+            int maxByteCount = length * 3 + 1;
+            byte* dest = Allocate(maxByteCount);
+
+            int byteCount;
+            fixed (char* chars = str)
+            {
+                byteCount = Encoding.UTF8.GetBytes(chars + startIndex, length, dest, maxByteCount);
+            }
+            dest[byteCount] = 0;
+
+            // Give back the bytes the upper bound reserved but the string didn't use
+            if (dest + maxByteCount == _current)
+            {
+                _current = dest + byteCount + 1;
+            }
+
+            return new IntPtr(dest);
+        }
+
+        /// <summary>
+        /// Releases all the strings of the frame at once. The interned strings stay valid.
+        /// </summary>
+        internal void Reset()
+        {
+            HashSet<string> lastFrameCandidates = _lastFrameCandidates;
+            _lastFrameCandidates = _currentFrameCandidates;
+            _currentFrameCandidates = lastFrameCandidates;
+            _currentFrameCandidates.Clear();
+
+            _currentBlockIndex = -1;
+            _current = null;
+            _currentEnd = null;
+
+            if (_largeStrings.Count > 0)
+            {
+                foreach (IntPtr largeString in _largeStrings)
+                {
+                    Marshal.FreeCoTaskMem(largeString);
+                }
+                _largeStrings.Clear();
+            }
+        }
+
+        public void Dispose()
+        {
+            Reset();
+
+            foreach (IntPtr block in _blocks)
+            {
+                Marshal.FreeCoTaskMem(block);
+            }
+            _blocks.Clear();
+
+            foreach (IntPtr interned in _internedStrings.Values)
+            {
+                Marshal.FreeCoTaskMem(interned);
+            }
+            _internedStrings.Clear();
+            _lastFrameCandidates.Clear();
+            _currentFrameCandidates.Clear();
+        }
+
+        private byte* Allocate(int size)
+        {
+            if (_currentEnd - _current >= size)
+            {
+                byte* result = _current;
+                _current += size;
+                return result;
+            }
+
+            if (size > BlockSize)
+            {
+                IntPtr largeString = Marshal.AllocCoTaskMem(size);
+                _largeStrings.Add(largeString);
+                return (byte*)largeString;
+            }
+
+            // Move on to the next block, allocating it the first time a frame needs this many
+            _currentBlockIndex++;
+            if (_currentBlockIndex == _blocks.Count)
+            {
+                _blocks.Add(Marshal.AllocCoTaskMem(BlockSize));
+            }
+
+            _current = (byte*)_blocks[_currentBlockIndex];
+            _currentEnd = _current + BlockSize;
+
+            byte* block = _current;
+            _current += size;
+            return block;
+        }
+
+        private sealed class ReferenceComparer : IEqualityComparer<string>
+        {
+            internal static readonly ReferenceComparer Instance = new();
+
+            public bool Equals(string x, string y) => ReferenceEquals(x, y);
+            public int GetHashCode(string obj) => RuntimeHelpers.GetHashCode(obj);
+        }
+    }
+}
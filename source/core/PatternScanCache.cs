@@ -0,0 +1,335 @@
+//
+// Copyright (C) 2015 crosire & kagikn & contributors
+// License: https://github.com/scripthookvdotnet/scripthookvdotnet#license
+//
+
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.IO;
+
+namespace SHVDN
+{
+    /// <summary>
+    /// Persists the results of the pattern scans over the main module of the game to a file, so loading and
+    /// reloading script domains don't scan the whole module for every pattern again.
+    /// </summary>
+    /// <remarks>
+    /// <para>
+    /// The file is keyed by the file version of the game and a hash of its code section. When there is no file yet,
+    /// or the game is updated or its code is patched differently, the patterns that are searched for over the whole
+    /// module are found all at once with <see cref="MultiPatternScanner"/> before the scans start. Each cached
+    /// address is also checked against the pattern before it is used, and a full scan is only done when it no longer
+    /// matches.
+    /// </para>
+    /// <para>
+    /// Only scans that start in the main module are cached, and only their hits, since a pattern that is not found
+    /// might have been searched for in data that changes at runtime.
+    /// </para>
+    /// </remarks>
+    internal static unsafe class PatternScanCache
+    {
+        private const uint FileMagic = 0x43535053; // "SPSC"
+        private const int FileFormatVersion = 1;
+
+        // Null while no cache is open, which makes every lookup miss
+        private static Dictionary<Entry, long> s_offsets;
+        private static ulong s_moduleBaseAddress;
+        private static ulong s_moduleSize;
+        private static string s_gameVersion;
+        private static ulong s_codeHash;
+        private static bool s_isDirty;
+
+        private static string FilePath => Path.ChangeExtension(typeof(ScriptDomain).Assembly.Location, ".patterns.cache");
+
+        /// <summary>
+        /// Opens the cache for the scans that follow, reading the file if it was written for the same game executable.
+        /// Otherwise, the patterns searched for over the whole module are found all at once before the scans start.
+        /// </summary>
+        internal static void Open(Version gameFileVersion)
+        {
+            ProcessModule module = Process.GetCurrentProcess().MainModule;
+            s_moduleBaseAddress = (ulong)module.BaseAddress.ToInt64();
+            s_moduleSize = (ulong)module.ModuleMemorySize;
+            s_gameVersion = gameFileVersion.ToString();
+            s_codeHash = HashCodeSection((byte*)s_moduleBaseAddress);
+            s_offsets = new Dictionary<Entry, long>();
+            s_isDirty = false;
+
+            var wholeModulePatterns = new HashSet<Entry>();
+            if (TryReadFile(wholeModulePatterns))
+            {
+                return;
+            }
+
+            // Without a usable file, such as on the first run, the scans would each go over the whole module
+            AddWholeModulePatternsOfNativeMemory(wholeModulePatterns);
+            ScanWholeModulePatterns(wholeModulePatterns);
+        }
+
+        /// <summary>
+        /// Reads the file into the cache.
+        /// </summary>
+        /// <param name="wholeModulePatterns">
+        /// The set the patterns of the file searched for over the whole module are added to, if the file was written
+        /// for another game executable.
+        /// </param>
+        /// <returns>
+        /// <see langword="true"/> if the file was written for the same game executable; otherwise,
+        /// <see langword="false"/>, and the cache is left empty.
+        /// </returns>
+        private static bool TryReadFile(HashSet<Entry> wholeModulePatterns)
+        {
+            try
+            {
+                if (!File.Exists(FilePath))
+                {
+                    return false;
+                }
+
+                using (var reader = new BinaryReader(File.OpenRead(FilePath)))
+                {
+                    if (reader.ReadUInt32() != FileMagic || reader.ReadInt32() != FileFormatVersion)
+                    {
+                        return false;
+                    }
+
+                    // Both fields must be read to get to the entries
+                    bool isSameExecutable = reader.ReadString() == s_gameVersion & reader.ReadUInt64() == s_codeHash;
+                    int count = reader.ReadInt32();
+                    for (int i = 0; i < count; i++)
+                    {
+                        var entry = new Entry(reader.ReadString(), reader.ReadString(), reader.ReadUInt64(), reader.ReadUInt64());
+                        long offset = reader.ReadInt64();
+                        if (isSameExecutable)
+                        {
+                            s_offsets[entry] = offset;
+                        }
+                        else if (entry.StartOffset == 0)
+                        {
+                            // The other entries depend on the hits of earlier scans, so they are scanned for again
+                            wholeModulePatterns.Add(new Entry(entry.Pattern, entry.Mask, 0, s_moduleSize));
+                        }
+                    }
+
+                    return isSameExecutable;
+                }
+            }
+            catch
+            {
+                // A broken file is just rewritten
+                s_offsets.Clear();
+                s_isDirty = true;
+                return false;
+            }
+        }
+
+        /// <summary>
+        /// Adds the patterns <see cref="NativeMemory"/> searches for over the whole module, which are listed in
+        /// <see cref="NativeMemoryPatterns"/>.
+        /// </summary>
+        private static void AddWholeModulePatternsOfNativeMemory(HashSet<Entry> wholeModulePatterns)
+        {
+            foreach (MemPattern pattern in NativeMemoryPatterns.All)
+            {
+                wholeModulePatterns.Add(new Entry(pattern.Pattern, pattern.Mask, 0, s_moduleSize));
+            }
+        }
+
+        /// <summary>
+        /// Finds the hits of patterns searched for over the whole module in a single pass with
+        /// <see cref="MultiPatternScanner"/>, and adds them to the cache.
+        /// </summary>
+        private static void ScanWholeModulePatterns(HashSet<Entry> wholeModulePatterns)
+        {
+            var scanner = new MultiPatternScanner();
+            var patterns = new List<Entry>();
+            foreach (Entry entry in wholeModulePatterns)
+            {
+                try
+                {
+                    scanner.Add(entry.Pattern, entry.Mask);
+                    patterns.Add(entry);
+                }
+                catch (ArgumentException)
+                {
+                    // A pattern of wildcards only is left to the scan on its own
+                }
+            }
+
+            s_isDirty = true;
+            if (patterns.Count == 0)
+            {
+                return;
+            }
+
+            IntPtr[] addresses = scanner.Scan((IntPtr)(long)s_moduleBaseAddress, s_moduleSize);
+            for (int i = 0; i < addresses.Length; i++)
+            {
+                if (addresses[i] != IntPtr.Zero)
+                {
+                    s_offsets[patterns[i]] = (long)((ulong)addresses[i].ToInt64() - s_moduleBaseAddress);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Writes the file if there were new scans since it was read, and closes the cache.
+        /// </summary>
+        internal static void Close()
+        {
+            if (s_offsets == null)
+            {
+                return;
+            }
+
+            try
+            {
+                if (s_isDirty)
+                {
+                    using (var writer = new BinaryWriter(File.Create(FilePath)))
+                    {
+                        writer.Write(FileMagic);
+                        writer.Write(FileFormatVersion);
+                        writer.Write(s_gameVersion);
+                        writer.Write(s_codeHash);
+                        writer.Write(s_offsets.Count);
+                        foreach (KeyValuePair<Entry, long> pair in s_offsets)
+                        {
+                            writer.Write(pair.Key.Pattern);
+                            writer.Write(pair.Key.Mask);
+                            writer.Write(pair.Key.StartOffset);
+                            writer.Write(pair.Key.Size);
+                            writer.Write(pair.Value);
+                        }
+                    }
+                }
+            }
+            catch
+            {
+                // Ignore exceptions, the scans are just done again next time
+            }
+
+            s_offsets = null;
+        }
+
+        /// <summary>
+        /// Gets the cached hit of a scan, if the bytes at the address still match the pattern.
+        /// </summary>
+        internal static bool TryGet(string pattern, string mask, IntPtr startAddress, ulong size, out byte* address)
+        {
+            address = null;
+            if (s_offsets == null || !TryGetStartOffset(startAddress, out ulong startOffset))
+            {
+                return false;
+            }
+
+            var entry = new Entry(pattern, mask, startOffset, size);
+            if (!s_offsets.TryGetValue(entry, out long offset))
+            {
+                return false;
+            }
+
+            ulong hitAddress = s_moduleBaseAddress + (ulong)offset;
+            ulong start = (ulong)startAddress.ToInt64();
+            // The hit must lie in the range the scan would have searched, as well as in the module
+            if (hitAddress < start || hitAddress - start + (ulong)pattern.Length > size
+                || (ulong)offset + (ulong)pattern.Length > s_moduleSize || !Matches((byte*)hitAddress, pattern, mask))
+            {
+                s_offsets.Remove(entry);
+                s_isDirty = true;
+                return false;
+            }
+
+            address = (byte*)hitAddress;
+            return true;
+        }
+
+        /// <summary>
+        /// Adds the hit of a full scan to the cache.
+        /// </summary>
+        internal static void Add(string pattern, string mask, IntPtr startAddress, ulong size, byte* address)
+        {
+            if (s_offsets == null || address == null || !TryGetStartOffset(startAddress, out ulong startOffset))
+            {
+                return;
+            }
+
+            s_offsets[new Entry(pattern, mask, startOffset, size)] = (long)((ulong)address - s_moduleBaseAddress);
+            s_isDirty = true;
+        }
+
+        private static bool TryGetStartOffset(IntPtr startAddress, out ulong startOffset)
+        {
+            startOffset = (ulong)startAddress.ToInt64() - s_moduleBaseAddress;
+            return (ulong)startAddress.ToInt64() >= s_moduleBaseAddress && startOffset < s_moduleSize;
+        }
+
+        private static bool Matches(byte* address, string pattern, string mask)
+        {
+            for (int i = 0; i < pattern.Length; i++)
+            {
+                if (mask[i] != '?' && address[i] != (byte)pattern[i])
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        private static ulong HashCodeSection(byte* moduleBaseAddress)
+        {
+            // IMAGE_DOS_HEADER::e_lfanew, then IMAGE_OPTIONAL_HEADER64::SizeOfCode and BaseOfCode
+            byte* ntHeaders = moduleBaseAddress + *(int*)(moduleBaseAddress + 0x3C);
+            uint sizeOfCode = *(uint*)(ntHeaders + 0x1C);
+            uint baseOfCode = *(uint*)(ntHeaders + 0x2C);
+
+            // Hash 4 words at a time in independent lanes, so the multiplications don't wait on each other
+            var words = (ulong*)(moduleBaseAddress + baseOfCode);
+            ulong wordCount = sizeOfCode / 8;
+            ulong hash0 = 0xCBF29CE484222325, hash1 = 0x84222325CBF29CE4, hash2 = 0x9E3779B97F4A7C15, hash3 = sizeOfCode;
+            ulong i = 0;
+            for (; i + 4 <= wordCount; i += 4)
+            {
+                hash0 = (hash0 ^ words[i]) * 0x100000001B3;
+                hash1 = (hash1 ^ words[i + 1]) * 0x100000001B3;
+                hash2 = (hash2 ^ words[i + 2]) * 0x100000001B3;
+                hash3 = (hash3 ^ words[i + 3]) * 0x100000001B3;
+            }
+            for (; i < wordCount; i++)
+            {
+                hash0 = (hash0 ^ words[i]) * 0x100000001B3;
+            }
+
+            return hash0 ^ (hash1 << 16 | hash1 >> 48) ^ (hash2 << 32 | hash2 >> 32) ^ (hash3 << 48 | hash3 >> 16);
+        }
+
+        private readonly struct Entry : IEquatable<Entry>
+        {
+            internal Entry(string pattern, string mask, ulong startOffset, ulong size)
+            {
+                Pattern = pattern;
+                Mask = mask;
+                StartOffset = startOffset;
+                Size = size;
+            }
+
+            internal string Pattern { get; }
+            internal string Mask { get; }
+            internal ulong StartOffset { get; }
+            internal ulong Size { get; }
+
+            public bool Equals(Entry other)
+            {
+                return StartOffset == other.StartOffset && Size == other.Size && Pattern == other.Pattern
+                    && Mask == other.Mask;
+            }
+            public override bool Equals(object obj) => obj is Entry other && Equals(other);
+            public override int GetHashCode()
+            {
+                return Pattern.GetHashCode() ^ (Mask.GetHashCode() * 31) ^ StartOffset.GetHashCode();
+            }
+        }
+    }
+}
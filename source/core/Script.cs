@@ -5,8 +5,10 @@
 
 using System;
 using System.Collections.Concurrent;
+using System.Collections.Generic;
 using System.Diagnostics;
 using System.Threading;
+using System.Threading.Tasks;
 using System.Windows.Forms;
 
 namespace SHVDN
@@ -15,7 +17,11 @@ namespace SHVDN
     {
         internal SemaphoreSlim _waitEvent;
         internal SemaphoreSlim _continueEvent;
-        internal readonly ConcurrentQueue<KeyboardEvent> _keyboardEvents = new();
+        // The position of this script in the keyboard event buffer of the script domain
+        internal long _keyboardEventCursor;
+        // Jobs whose work has finished in a worker thread, waiting to be published at the next tick boundary
+        private readonly ConcurrentQueue<ScriptJob> _completedJobs = new();
+        private readonly CancellationTokenSource _jobCancellationSource = new();
 
         private Thread _thread; // The thread hosting the execution of the script
 
@@ -26,12 +32,38 @@ namespace SHVDN
         private string _fileName;
         private object _scriptInstance;
 
-        private bool _nativeCallResetsTimeout;
+        // Read on every native call, so this is not guarded by `_rwLock`. A `bool` is always read and written atomically.
+        private volatile bool _nativeCallResetsTimeout;
+
+        // Only set for cooperative scripts, which run in the main thread of the script domain without a thread
+        private ScriptSynchronizationContext _synchronizationContext;
+        // Only accessed in the main thread of the script domain
+        private readonly List<CooperativeWait> _pendingWaits = new();
+        private int _cooperativeSliceCount;
+        private int _lastCooperativeTickTickCount;
+        // Environment.TickCount can be negative, so the first tick can't be detected from the last tick count alone
+        private bool _hasDoneCooperativeTick;
+
+        private readonly struct CooperativeWait
+        {
+            public CooperativeWait(int resumeTickCount, int registeredSliceCount, TaskCompletionSource<object> tcs)
+            {
+                ResumeTickCount = resumeTickCount;
+                RegisteredSliceCount = registeredSliceCount;
+                Tcs = tcs;
+            }
+
+            public int ResumeTickCount { get; }
+            public int RegisteredSliceCount { get; }
+            public TaskCompletionSource<object> Tcs { get; }
+        }
 
         // Use a reader-writer lock rather than a monitor lock because all the fields are not too frequently written
         private readonly ReaderWriterLockSlim _rwLock = new ();
 
-        private readonly CheapThreadSafeStopwatch _stopwatch = new();
+        // The value of `Environment.TickCount` when the timeout clock was last restarted. Written with a single
+        // volatile write so native calls can restart the clock without any lock.
+        private int _timeoutClockStartTimestamp;
 
         public void Dispose()
         {
@@ -94,7 +126,55 @@ namespace SHVDN
             }
         }
 
-        internal CheapThreadSafeStopwatch StopwatchForTimeout => _stopwatch;
+        /// <summary>
+        /// Gets the elapsed time in milliseconds since the last call of <see cref="RestartTimeoutClock"/>.
+        /// </summary>
+        internal uint ElapsedMillisecondsSinceTimeoutClockRestart
+            => (uint)(Environment.TickCount - Volatile.Read(ref _timeoutClockStartTimestamp));
+
+        /// <summary>
+        /// Restarts the clock that is used to check whether this script is blocking the game for too long.
+        /// </summary>
+        internal void RestartTimeoutClock()
+        {
+            Volatile.Write(ref _timeoutClockStartTimestamp, Environment.TickCount);
+        }
+
+        /// <summary>
+        /// Gets or sets the buffer where <see cref="NativeProfiler"/> records native calls made by this script.
+        /// Only accessed while this script is executing or in the main thread of the script domain.
+        /// </summary>
+        internal NativeProfiler.NativeProfileBuffer NativeProfileBuffer { get; set; }
+
+        /// <summary>
+        /// Gets the rolling tick time statistics of this script.
+        /// </summary>
+        internal ScriptTickStats TickStats { get; } = new();
+
+        /// <summary>
+        /// The number of native calls this script has made. Only incremented while this script is executing, so
+        /// the main thread of the script domain can read it after the script yields.
+        /// </summary>
+        internal long NativeCallCount;
+
+        /// <summary>
+        /// Gets or sets the priority <see cref="ScriptScheduler"/> runs this script with.
+        /// </summary>
+        internal ScriptPriority Priority { get; set; }
+        /// <summary>
+        /// Gets the <see cref="Stopwatch"/> timestamp the last <see cref="Wait(int)"/> call of this script ends at.
+        /// Only written by the script thread before it yields, so the main thread of the script domain can read it
+        /// after the script yields.
+        /// </summary>
+        internal long WakeUpTimestamp { get; private set; }
+        /// <summary>
+        /// Gets or sets whether this script is parked in <see cref="ScriptScheduler"/> until its wait is over.
+        /// </summary>
+        internal bool IsSleeping { get; set; }
+        /// <summary>
+        /// Gets or sets the number of frames in a row this script has been deferred because the frame budget was used up.
+        /// </summary>
+        internal int DeferredFrameCount { get; set; }
 
         private Thread Thread
         {
@@ -228,6 +308,12 @@ namespace SHVDN
         /// </summary>
         public bool IsUsingThread => _thread != null;
 
+        /// <summary>
+        /// Gets whether this script runs cooperatively in the main thread of the script domain, where its tick and
+        /// <see cref="WaitAsync(int)"/> run as continuations instead of in a dedicated thread.
+        /// </summary>
+        public bool IsCooperative => _synchronizationContext != null;
+
         /// <summary>
         /// An event that is raised every tick of the script.
         /// </summary>
@@ -341,30 +427,8 @@ namespace SHVDN
 
         internal bool NativeCallResetsTimeout
         {
-            get
-            {
-                _rwLock.EnterReadLock();
-                try
-                {
-                    return _nativeCallResetsTimeout;
-                }
-                finally
-                {
-                    _rwLock.ExitReadLock();
-                }
-            }
-            set
-            {
-                _rwLock.EnterWriteLock();
-                try
-                {
-                    _nativeCallResetsTimeout = value;
-                }
-                finally
-                {
-                    _rwLock.ExitWriteLock();
-                }
-            }
+            get => _nativeCallResetsTimeout;
+            set => _nativeCallResetsTimeout = value;
         }
 
         /// <summary>
@@ -394,8 +458,11 @@ namespace SHVDN
         }
         internal void DoTick()
         {
+            PublishCompletedJobs();
+
             // Process keyboard events
-            while (_keyboardEvents.TryDequeue(out KeyboardEvent ev))
+            ScriptEventBuffer<KeyboardEvent> keyboardEvents = ScriptDomain.CurrentDomain.KeyboardEvents;
+            while (keyboardEvents.TryRead(ref _keyboardEventCursor, out KeyboardEvent ev))
             {
                 try
                 {
@@ -438,6 +505,110 @@ namespace SHVDN
             }
         }
 
+        /// <summary>
+        /// Starts a job that runs the specified work in a worker thread of the script domain.
+        /// The job completes at a tick boundary of this script, where <paramref name="completed"/> is invoked.
+        /// </summary>
+        /// <param name="work">The work to run, which must not call native functions or access the game memory.</param>
+        /// <param name="completed">The callback invoked in the thread of this script after the job completes.</param>
+        public ScriptJob StartJob(Func<CancellationToken, object> work, Action<ScriptJob> completed)
+        {
+            if (work == null)
+            {
+                throw new ArgumentNullException(nameof(work));
+            }
+            if (!IsRunning)
+            {
+                throw new InvalidOperationException("Jobs can only be started by running scripts.");
+            }
+
+            var job = new ScriptJob(this, work, completed, _jobCancellationSource.Token);
+            ScriptDomain.CurrentDomain.JobSystem.Schedule(job);
+            return job;
+        }
+
+        internal void EnqueueCompletedJob(ScriptJob job) => _completedJobs.Enqueue(job);
+
+        private void PublishCompletedJobs()
+        {
+            while (_completedJobs.TryDequeue(out ScriptJob job))
+            {
+                try
+                {
+                    job.Publish();
+                }
+                catch (ThreadAbortException)
+                {
+                    // Stop main loop immediately on a thread abort exception
+                    throw;
+                }
+                catch (Exception ex)
+                {
+                    ScriptDomain.HandleUnhandledException(this, new UnhandledExceptionEventArgs(ex, false));
+                }
+            }
+        }
+
+        /// <summary>
+        /// Runs a slice of a cooperative script: resumes continuations whose waits are over, then raises
+        /// <see cref="Tick"/> if no asynchronous tick handler is still running and the interval has elapsed.
+        /// </summary>
+        internal void DoCooperativeTick()
+        {
+            SynchronizationContext previousContext = SynchronizationContext.Current;
+            SynchronizationContext.SetSynchronizationContext(_synchronizationContext);
+            try
+            {
+                _cooperativeSliceCount++;
+                PublishCompletedJobs();
+                ResumeFinishedWaits();
+                _synchronizationContext.RunPendingCallbacks();
+
+                if (!IsRunning || _synchronizationContext.HasOutstandingOperations)
+                {
+                    return;
+                }
+
+                int nowTickCount = Environment.TickCount;
+                if (_hasDoneCooperativeTick && nowTickCount - _lastCooperativeTickTickCount < Interval)
+                {
+                    return;
+                }
+
+                _hasDoneCooperativeTick = true;
+                _lastCooperativeTickTickCount = nowTickCount;
+                DoTick();
+            }
+            finally
+            {
+                SynchronizationContext.SetSynchronizationContext(previousContext);
+            }
+        }
+
+        private void ResumeFinishedWaits()
+        {
+            if (_pendingWaits.Count == 0)
+            {
+                return;
+            }
+
+            int nowTickCount = Environment.TickCount;
+            for (int i = _pendingWaits.Count - 1; i >= 0; i--)
+            {
+                CooperativeWait wait = _pendingWaits[i];
+                // A wait always lasts until the next slice, even if it's for 0 ms
+                if (wait.RegisteredSliceCount == _cooperativeSliceCount || nowTickCount - wait.ResumeTickCount < 0)
+                {
+                    continue;
+                }
+
+                // The continuation doesn't run inline (see WaitAsync), so it can't abort the script and clear the list
+                // while this loop still iterates over it
+                _pendingWaits.RemoveAt(i);
+                wait.Tcs.SetResult(null);
+            }
+        }
+
         /// <summary>
         /// Starts execution of this script.
         /// </summary>
@@ -465,6 +636,18 @@ namespace SHVDN
             Log.Message(Log.Level.Info, "Started script ", Name, ".");
         }
         /// <summary>
+        /// Starts execution of this script in cooperative mode, where the script runs in the main thread of the script
+        /// domain and yields with <see cref="WaitAsync(int)"/> instead of blocking a dedicated thread.
+        /// </summary>
+        public void StartCooperative()
+        {
+            _synchronizationContext
+                = new ScriptSynchronizationContext(System.Threading.Thread.CurrentThread.ManagedThreadId);
+            IsRunning = true;
+
+            Log.Message(Log.Level.Info, "Started script ", Name, " in cooperative mode.");
+        }
+        /// <summary>
         /// Aborts execution of this script.
         /// </summary>
         /// <remarks>
@@ -478,6 +661,9 @@ namespace SHVDN
         {
             IsRunning = false;
 
+            // Jobs that haven't started yet won't run, and running ones see the cancellation through their token
+            _jobCancellationSource.Cancel();
+
             try
             {
                 Aborted?.Invoke(this, EventArgs.Empty);
@@ -496,6 +682,13 @@ namespace SHVDN
             }
             else
             {
+                if (IsCooperative)
+                {
+                    // Drop the pending continuations, so the script won't run any more code
+                    _synchronizationContext.Clear();
+                    _pendingWaits.Clear();
+                }
+
                 Log.Message(Log.Level.Warning, "Aborted script ", Name, ".");
             }
         }
@@ -540,6 +733,9 @@ namespace SHVDN
                 Stopwatch sw = new Stopwatch();
                 sw.Start();
 
+                // Lets the script domain skip resuming this script until the wait is over
+                WakeUpTimestamp = Stopwatch.GetTimestamp() + Math.Max(ms, 0) * Stopwatch.Frequency / 1000;
+
                 do
                 {
                     _waitEvent.Release();
@@ -549,8 +745,27 @@ namespace SHVDN
             }
             else
             {
+                // Cooperative scripts block the main thread of the script domain here as scripts without a thread do,
+                // so the API helpers that yield while loading a resource keep working in them
                 System.Threading.Thread.Sleep(ms);
             }
         }
+        /// <summary>
+        /// Returns a task that completes in a later slice of this cooperative script after at least the specified
+        /// duration. Awaiting the task in the script resumes the script in the main thread of the script domain.
+        /// </summary>
+        /// <param name="ms">The duration in milliseconds to pause.</param>
+        public Task WaitAsync(int ms)
+        {
+            if (!IsCooperative)
+            {
+                throw new InvalidOperationException("WaitAsync can only be used in scripts that run in cooperative mode.");
+            }
+
+            // Post the continuation to the synchronization context rather than running it inside ResumeFinishedWaits
+            var tcs = new TaskCompletionSource<object>(TaskCreationOptions.RunContinuationsAsynchronously);
+            _pendingWaits.Add(new CooperativeWait(Environment.TickCount + Math.Max(ms, 0), _cooperativeSliceCount, tcs));
+            return tcs.Task;
+        }
     }
 }
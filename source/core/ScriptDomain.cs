@@ -6,6 +6,7 @@
 using System;
 using System.CodeDom.Compiler;
 using System.Collections.Generic;
+using System.Diagnostics;
 using System.IO;
 using System.Linq;
 using System.Reflection;
@@ -96,22 +97,44 @@ namespace SHVDN
         private static readonly Regex s_ScriptingApiModuleNamePatternWithVersionCapture
             = new Regex(@"^ScriptHookVDotNet(?<ver>\d)\.dll$", RegexOptions.IgnoreCase | RegexOptions.Compiled);
 
-        private static ScriptDomain s_currentDomain;
-        // `Dispose` won't be called in this instance because it may be too difficult to call correctly due to how
-        // separate `AppDomain`s have different static variables, but it's acceptable since `ReaderWriterLockSlim` uses
-        // `EventWaitHandle`, which uses `SafeHandle`.
-        private static readonly ReaderWriterLockSlim s_currentDomainPropertyLock = new();
+        // Only a reference is stored in this field, so reading and writing it is atomic. `volatile` is enough to make
+        // sure other threads see the new domain without taking a lock on every native call.
+        private static volatile ScriptDomain s_currentDomain;
 
         private readonly int _executingThreadId = Thread.CurrentThread.ManagedThreadId;
-        private Script _executingScript = null;
-        private readonly List<IntPtr> _pinnedStrings = new();
+        // Only written in the main thread of `ScriptDomain` (with `_lockForFieldsThatFrequentlyWritten` held), but
+        // read without the lock on every native call from script threads.
+        private volatile Script _executingScript = null;
+        private readonly NativeStringArena _pinnedStrings = new();
+        // Scripts can pin strings from tasks and job workers while the main thread of `ScriptDomain` or a script
+        // thread is also pinning, so the arena is only touched with this lock held
+        private readonly object _pinnedStrListLock = new();
         private readonly List<Script> _runningScripts = new();
         private readonly ConcurrentQueue<IScriptTask> _taskQueue = new();
         // this is only used in the main thread of `ScriptDomain`, so no lock is needed
+        private readonly ScriptScheduler _scheduler = new();
+        // Created on the first job, so the worker threads are only started if some script uses them
+        private JobSystem _jobSystem;
+        // The console that lives in this domain, ticked and fed key events from `DoFrame` and `DoKeyMessage`
+        private volatile Console _console;
+        // this is only used in the main thread of `ScriptDomain`, so no lock is needed
         private readonly Dictionary<string, int> _scriptInstances = new();
         private readonly SortedList<string, ScriptTypeInfo> _scriptTypes = new();
-        private bool _recordKeyboardEvents = true;
-        private bool[] _keyboardState = new bool[256];
+        private volatile bool _recordKeyboardEvents = true;
+        private readonly ScriptEventBuffer<KeyboardEvent> _keyboardEvents = new(1024);
+        // Points to the native array where the main domain puts the key messages of the current frame
+        private IntPtr _frameKeyMessages;
+        // Only written in the main thread of `ScriptDomain` while it handles the key messages of a frame
+        private KeyboardState _pendingKeysDown;
+        private KeyboardState _pendingKeysPressed;
+        private KeyboardState _pendingKeysReleased;
+        // Published once per tick and replaced as a whole, so reading it needs no lock
+        private volatile KeyboardFrameState _keyboardFrameState = KeyboardFrameState.Empty;
+        // Object pools churn a lot more than the keyboard, so keep more events for scripts that wait a few frames
+        private readonly ScriptEventBuffer<EntityPoolEvent> _entityPoolEvents = new(4096);
+        private readonly NativeMemory.EntityPoolWatcher _entityPoolWatcher;
+        // The bit mask of the pools scripts have asked to watch, only ever added to
+        private int _watchedEntityPools;
         private readonly List<Assembly> _scriptingApiAsms = new List<Assembly>();
         private readonly HashSet<string> _scriptingApiAsmNamesCache = new HashSet<string>();
         private readonly Dictionary<int, Type> _scriptingGtaClassTypesCacheDict = new Dictionary<int, Type>();
@@ -119,18 +142,9 @@ namespace SHVDN
         // HashSet takes way more time (like 2x or 3x time) to search, at least for `System.Type`.
         private readonly Type[] _scriptingGtaClassTypesCacheArray = Array.Empty<Type>();
 
-        private unsafe delegate* unmanaged[Cdecl]<IntPtr> _getTlsContext;
-        private unsafe delegate* unmanaged[Cdecl]<IntPtr, void> _setTlsContext;
-
-        private IntPtr _tlsContextOfMainThread;
-        private uint _gameMainThreadIdUnmanaged;
-
-        private bool _areTlsVarsInitialized;
-
-        // Since `ConcurrentQueue` doesn't have `Clear` method in .NET Framework where the head and tail will be set
-        // to a new segment instance, we read `_pinnedStrings` sequentially to dispose pinned strings.
-        private readonly object _pinnedStrListLock = new();
-        private readonly ReaderWriterLockSlim _tlsVariablesLock = new();
+        // The TLS variables never change once they are initialized, so they are published as an immutable snapshot
+        // and native calls can read them without a lock. `null` until `InitTlsStuffForTlsContextSwitch` is called.
+        private volatile TlsContextSnapshot _tlsSnapshot;
 
         // These locks are used to avoid race conditions, but the code looks so terrible with a lot of lock blocks.
         // If there is a better way to avoid using them a lot by refactoring the code especially on data structures,
@@ -147,35 +161,78 @@ namespace SHVDN
         /// </remarks>
         private static byte[] s_cellEmailBconByteStr = Encoding.ASCII.GetBytes("CELL_EMAIL_BCON\0");
 
-        internal unsafe void InitTlsStuffForTlsContextSwitch(IntPtr getTlsContextFunc, IntPtr setTlsContextFunc,
-            IntPtr tlsAddr, uint threadId)
+        /// <summary>
+        /// Holds the TLS variables used to switch to the TLS context of the main thread of the exe.
+        /// All the fields are read-only, so the instance can be shared across threads without a lock.
+        /// </summary>
+        private sealed unsafe class TlsContextSnapshot
         {
-            _tlsVariablesLock.EnterWriteLock();
-            try
+            internal readonly delegate* unmanaged[Cdecl]<IntPtr> _getTlsContext;
+            internal readonly delegate* unmanaged[Cdecl]<IntPtr, void> _setTlsContext;
+            internal readonly IntPtr _tlsContextOfMainThread;
+            internal readonly uint _gameMainThreadIdUnmanaged;
+
+            internal TlsContextSnapshot(IntPtr getTlsContextFunc, IntPtr setTlsContextFunc, IntPtr tlsAddr,
+                uint threadId)
             {
                 _getTlsContext = (delegate* unmanaged[Cdecl]<IntPtr>)getTlsContextFunc;
                 _setTlsContext = (delegate* unmanaged[Cdecl]<IntPtr, void>)setTlsContextFunc;
                 _tlsContextOfMainThread = tlsAddr;
                 _gameMainThreadIdUnmanaged = threadId;
-                _areTlsVarsInitialized = true;
-            }
-            finally
-            {
-                _tlsVariablesLock.ExitWriteLock();
             }
         }
 
-        internal bool IsTlsStuffInitialized()
+        internal void InitTlsStuffForTlsContextSwitch(IntPtr getTlsContextFunc, IntPtr setTlsContextFunc,
+            IntPtr tlsAddr, uint threadId)
         {
-            _tlsVariablesLock.EnterReadLock();
-            try
-            {
-                return _areTlsVarsInitialized;
-            }
-            finally
-            {
-                _tlsVariablesLock.ExitReadLock();
-            }
+            _tlsSnapshot = new TlsContextSnapshot(getTlsContextFunc, setTlsContextFunc, tlsAddr, threadId);
+        }
+
+        internal bool IsTlsStuffInitialized() => _tlsSnapshot != null;
+
+        /// <summary>
+        /// The layout of a key message in the native array passed to <see cref="InitKeyMessageBuffer(IntPtr)"/>.
+        /// </summary>
+        [StructLayout(LayoutKind.Sequential)]
+        private struct NativeKeyMessage
+        {
+            internal uint Keys;
+            internal int IsDown;
+        }
+
+        /// <summary>
+        /// Sets the native array the main domain puts the key messages of each frame in, which
+        /// <see cref="DoFrame(bool, long, int)"/> reads without another cross-domain call.
+        /// </summary>
+        internal void InitKeyMessageBuffer(IntPtr frameKeyMessages)
+        {
+            _frameKeyMessages = frameKeyMessages;
+        }
+
+        /// <summary>
+        /// Gets the buffer the keyboard events of this domain are broadcast to scripts through.
+        /// </summary>
+        internal ScriptEventBuffer<KeyboardEvent> KeyboardEvents => _keyboardEvents;
+
+        /// <summary>
+        /// Sets the console that lives in this domain, so <see cref="DoFrame(bool, long, int)"/> and
+        /// <see cref="DoKeyMessage(Keys, bool)"/> can drive it without extra calls from the main domain.
+        /// </summary>
+        internal void AttachConsole(Console console)
+        {
+            _console = console;
+        }
+
+        internal void InitNativeInvoker(IntPtr invokeNativeFunc)
+        {
+            // `NativeFunc` is a static class, so this sets the function for the application domain of this script
+            // domain rather than for the one where the caller lives
+            NativeFunc.InitNativeInvoker(invokeNativeFunc);
+        }
+
+        internal void InitTimelineTracer(IntPtr setClrThreadTickTracingEnabledFunc)
+        {
+            TimelineTracer.Init(setClrThreadTickTracingEnabledFunc);
         }
 
         internal void InitNativeNemoryMembers()
@@ -210,30 +267,8 @@ namespace SHVDN
         /// </summary>
         public static ScriptDomain CurrentDomain
         {
-            get
-            {
-                s_currentDomainPropertyLock.EnterReadLock();
-                try
-                {
-                    return s_currentDomain;
-                }
-                finally
-                {
-                    s_currentDomainPropertyLock.ExitReadLock();
-                }
-            }
-            set
-            {
-                s_currentDomainPropertyLock.EnterWriteLock();
-                try
-                {
-                    s_currentDomain = value;
-                }
-                finally
-                {
-                    s_currentDomainPropertyLock.ExitWriteLock();
-                }
-            }
+            get => s_currentDomain;
+            set => s_currentDomain = value;
         }
 
         /// <summary>
@@ -268,10 +303,7 @@ namespace SHVDN
                     return null;
                 }
 
-                lock (dom._lockForFieldsThatFrequentlyWritten)
-                {
-                    return dom._executingScript;
-                }
+                return dom._executingScript;
             }
         }
 
@@ -280,6 +312,56 @@ namespace SHVDN
         /// </summary>
         public uint ScriptTimeoutThreshold { get; set; }
 
+        /// <summary>
+        /// Gets or sets the time in milliseconds all scripts can take in one tick before low priority scripts are
+        /// deferred to the next tick. Zero disables the budget.
+        /// </summary>
+        public double ScriptFrameBudget
+        {
+            get => _scheduler.FrameBudgetInMilliseconds;
+            set => _scheduler.FrameBudgetInMilliseconds = value;
+        }
+        /// <summary>
+        /// Gets the number of times a low priority script has been deferred because the frame budget was used up.
+        /// </summary>
+        internal long DeferredScriptTickCount => _scheduler.DeferredScriptCount;
+
+        /// <summary>
+        /// Gets or sets whether entity queries such as <see cref="NativeMemory.GetPedHandles(int[])"/> read from a
+        /// snapshot of the entity pools taken once per tick.
+        /// </summary>
+        public bool UseEntityPoolSnapshot
+        {
+            get => NativeMemory.UseEntityPoolSnapshot;
+            set => NativeMemory.UseEntityPoolSnapshot = value;
+        }
+
+        /// <summary>
+        /// Gets the job system that runs <see cref="ScriptJob"/>s of the scripts in this domain.
+        /// </summary>
+        internal JobSystem JobSystem
+        {
+            get
+            {
+                JobSystem jobSystem = Volatile.Read(ref _jobSystem);
+                if (jobSystem != null)
+                {
+                    return jobSystem;
+                }
+
+                var newJobSystem = new JobSystem();
+                jobSystem = Interlocked.CompareExchange(ref _jobSystem, newJobSystem, null);
+                if (jobSystem != null)
+                {
+                    // Another script thread created one first
+                    newJobSystem.Dispose();
+                    return jobSystem;
+                }
+
+                return newJobSystem;
+            }
+        }
+
         /// <summary>
         /// Gets the dictionary of deprecated script names.
         /// </summary>
@@ -298,6 +380,8 @@ namespace SHVDN
             // Each application domain has its own copy of this static variable, so only need to set it once
             CurrentDomain = this;
 
+            _entityPoolWatcher = new NativeMemory.EntityPoolWatcher(_entityPoolEvents);
+
             // Attach resolve handler to new domain
             AppDomain.AssemblyResolve += HandleResolve;
             AppDomain.UnhandledException += HandleUnhandledException;
@@ -370,15 +454,21 @@ namespace SHVDN
         }
         public void Dispose()
         {
+            // Stop the job workers, the running scripts have already canceled their jobs
+            Volatile.Read(ref _jobSystem)?.Dispose();
+            // Finish the timeline file before the unload of the domain aborts the writer thread
+            TimelineTracer.Stop();
             DisposeUnmanagedResource();
             GC.SuppressFinalize(this);
         }
 
         private void DisposeUnmanagedResource()
         {
-            _tlsVariablesLock.Dispose();
             // Need to free native strings when disposing the script domain
-            CleanupStrings();
+            lock (_pinnedStrListLock)
+            {
+                _pinnedStrings.Dispose();
+            }
             // Need to free unmanaged resources in NativeMemory
             NativeMemory.DisposeUnmanagedResources();
         }
@@ -1125,7 +1215,8 @@ namespace SHVDN
 
             Log.Message(Log.Level.Debug, "Instantiating script ", scriptType.FullName, " ...");
 
-            var script = new Script();
+            // Only events published after the script is instantiated are sent to it
+            var script = new Script { _keyboardEventCursor = _keyboardEvents.WriteSequence };
             // Keep track of current script, so it can be restored down below
             Script previousScript = null;
 
@@ -1320,9 +1411,7 @@ namespace SHVDN
                 ScriptInitOption initOpt = BuildScriptInitOptionFromScriptAttribute(scriptTypeInfo.Type,
                     scriptTypeInfo.TargetApiVersion);
                 Type systemTypeOfScript = scriptTypeInfo.Type;
-                InstantiateScriptFast(systemTypeOfScript, initOpt)?
-                    .Start(!(GetScriptAttribute(systemTypeOfScript, "NoScriptThread") is bool NoScriptThread)
-                            || !NoScriptThread);
+                StartScript(InstantiateScriptFast(systemTypeOfScript, initOpt));
             }
 
             void WarnOfScriptsUsingDeprecatedApi()
@@ -1407,7 +1496,7 @@ namespace SHVDN
 
             foreach (Type type in scriptTypesToInstantiate)
             {
-                InstantiateScript(type)?.Start(!(GetScriptAttribute(type, "NoScriptThread") is bool NoScriptThread) || !NoScriptThread);
+                StartScript(InstantiateScript(type));
             }
         }
         /// <summary>
@@ -1458,46 +1547,9 @@ namespace SHVDN
             }
         }
 
-        private bool ResetTimeoutStopwatchOfExecutingScriptIfScriptWantsToResetWhenCallingANativeFunc()
+        private void RestartTimeoutClockOfExecutingScript()
         {
-            lock (_lockForFieldsThatFrequentlyWritten)
-            {
-                if (_executingScript == null)
-                {
-                    return false;
-                }
-                if (_executingScript.NativeCallResetsTimeout)
-                {
-                    _executingScript.StopwatchForTimeout.Reset();
-                    return true;
-                }
-
-                return false;
-            }
-        }
-        private void ResetTimeoutStopwatchOfExecutingScript()
-        {
-            lock (_lockForFieldsThatFrequentlyWritten)
-            {
-                if (_executingScript == null)
-                {
-                    return;
-                }
-
-                _executingScript.StopwatchForTimeout.Reset();
-            }
-        }
-        private void StartTimeoutStopwatchOfExecutingScript()
-        {
-            lock (_lockForFieldsThatFrequentlyWritten)
-            {
-                if (_executingScript == null)
-                {
-                    return;
-                }
-
-                _executingScript.StopwatchForTimeout.Start();
-            }
+            _executingScript?.RestartTimeoutClock();
         }
 
         /// <summary>
@@ -1508,60 +1560,40 @@ namespace SHVDN
         /// <param name="task">The task to execute.</param>
         public void ExecuteTaskWithGameThreadTlsContext(IScriptTask task, bool forceResetTimeoutStopwatch = false)
         {
-            bool timeoutStopwatchHasBeenReset;
-            if (forceResetTimeoutStopwatch)
-            {
-                ResetTimeoutStopwatchOfExecutingScript();
-                timeoutStopwatchHasBeenReset = true;
-            }
-            else
-            {
-                timeoutStopwatchHasBeenReset
-                    = ResetTimeoutStopwatchOfExecutingScriptIfScriptWantsToResetWhenCallingANativeFunc();
-            }
+            ExecuteTaskWithGameThreadTlsContext(ref task, forceResetTimeoutStopwatch);
+        }
+        /// <summary>
+        /// Execute a script task in this script domain with the tls context of the main thread of the exe.
+        /// Takes no locks and allocates nothing, so a struct task can be used for calls that are made very frequently
+        /// such as native calls.
+        /// </summary>
+        /// <param name="task">
+        /// The task to execute. Passed by reference so a struct task can write its result back to the caller.
+        /// </param>
+        internal void ExecuteTaskWithGameThreadTlsContext<TTask>(ref TTask task, bool forceResetTimeoutStopwatch = false)
+            where TTask : IScriptTask
+        {
+            // Only the main thread of `ScriptDomain` changes `_executingScript`, and it waits for the script thread
+            // while the script is running, so the value will not change until this method returns
+            Script executingScript = _executingScript;
+            bool resetsTimeout = executingScript != null
+                && (forceResetTimeoutStopwatch || executingScript.NativeCallResetsTimeout);
 
-            // Store the TLS variables to local variables, so we can perform the `IScriptTask` without the lock
-            // and that makes sure the task won't be able to cause a `LockRecursionException` by calling this method
-            // again in the task.
             // Since `delegate* unmanaged` is allowed only in unsafe context, we have to use `unsafe` keyword for
             // the entire block.
             unsafe
             {
-                uint gameMainThreadIdUnmanaged;
-                IntPtr tlsContextOfMainThread;
-                delegate* unmanaged[Cdecl]<IntPtr> getTlsContext;
-                delegate* unmanaged[Cdecl]<IntPtr, void> setTlsContext;
-
-                #region Read TLS variables with the Lock for Them and Store to Local Variables
-                _tlsVariablesLock.EnterReadLock();
-                try
-                {
-                    gameMainThreadIdUnmanaged = _gameMainThreadIdUnmanaged;
-                    tlsContextOfMainThread = _tlsContextOfMainThread;
-                    getTlsContext = _getTlsContext;
-                    setTlsContext = _setTlsContext;
-                }
-                catch
-                {
-                    // We should abort the method if reading the TLS variables *should* fail, so we can see the error
-                    // in the log when it's predictable.
-                    throw;
-                }
-                finally
-                {
-                    _tlsVariablesLock.ExitReadLock();
-                }
-                #endregion
+                TlsContextSnapshot tlsSnapshot = _tlsSnapshot;
 
-                if (gameMainThreadIdUnmanaged == GetCurrentThreadId())
+                if (tlsSnapshot._gameMainThreadIdUnmanaged == GetCurrentThreadId())
                 {
                     // Request came from the main thread of the exe, so can just execute it right away
                     task.Run();
                 }
                 else
                 {
-                    IntPtr tlsContextOfScriptThread = getTlsContext();
-                    setTlsContext(tlsContextOfMainThread);
+                    IntPtr tlsContextOfScriptThread = tlsSnapshot._getTlsContext();
+                    tlsSnapshot._setTlsContext(tlsSnapshot._tlsContextOfMainThread);
 
                     try
                     {
@@ -1570,14 +1602,16 @@ namespace SHVDN
                     finally
                     {
                         // Need to revert TLS context to the real one of the script thread
-                        setTlsContext(tlsContextOfScriptThread);
+                        tlsSnapshot._setTlsContext(tlsContextOfScriptThread);
                     }
                 }
             }
 
-            if (timeoutStopwatchHasBeenReset)
+            // The timeout is only checked after the script yields, so restarting the clock after the call is
+            // equivalent to pausing it during the call
+            if (resetsTimeout)
             {
-                StartTimeoutStopwatchOfExecutingScript();
+                executingScript.RestartTimeoutClock();
             }
         }
 
@@ -1587,9 +1621,9 @@ namespace SHVDN
         /// <param name="task">The task to execute.</param>
         public void ExecuteTaskInScriptDomainThread(IScriptTask task)
         {
-            // Timeout stopwatch should always be reset, as an `IScriptTask` that must be executed in the script domain
+            // Timeout clock should always be reset, as an `IScriptTask` that must be executed in the script domain
             // may take time to execute longer than the timeout threshold in poor PC environments but not in good ones.
-            ResetTimeoutStopwatchOfExecutingScript();
+            RestartTimeoutClockOfExecutingScript();
 
             if (Thread.CurrentThread.ManagedThreadId == _executingThreadId)
             {
@@ -1609,7 +1643,7 @@ namespace SHVDN
                 SignalAndWait(executingScript.WaitEvent, executingScript.ContinueEvent);
             }
 
-            StartTimeoutStopwatchOfExecutingScript();
+            RestartTimeoutClockOfExecutingScript();
         }
 
         /// <summary>
@@ -1624,9 +1658,111 @@ namespace SHVDN
 
         public bool IsKeyPressed(Keys key)
         {
-            lock (_lockForFieldsThatFrequentlyWritten)
+            return _keyboardFrameState.Down.IsDown(key);
+        }
+        /// <summary>
+        /// Checks whether a key went down since the last frame, even if it has been released again.
+        /// </summary>
+        /// <param name="key">The key to check. Keys with an integer value greater than 255 will throw an <see cref="IndexOutOfRangeException"/>.</param>
+        public bool IsKeyJustPressed(Keys key)
+        {
+            return _keyboardFrameState.Pressed.IsDown(key);
+        }
+        /// <summary>
+        /// Checks whether a key went up since the last frame.
+        /// </summary>
+        /// <param name="key">The key to check. Keys with an integer value greater than 255 will throw an <see cref="IndexOutOfRangeException"/>.</param>
+        public bool IsKeyJustReleased(Keys key)
+        {
+            return _keyboardFrameState.Released.IsDown(key);
+        }
+        /// <summary>
+        /// Checks whether all the keys of a chord are held down, in a single operation.
+        /// </summary>
+        /// <param name="chord">The chord created with <see cref="KeyboardState.FromChord(Keys[])"/>.</param>
+        public bool IsChordPressed(KeyboardState chord)
+        {
+            return _keyboardFrameState.Down.IsChordDown(chord);
+        }
+
+        /// <summary>
+        /// Starts publishing the creation and deletion of the entities in the specified pools, which are read with
+        /// <see cref="TryReadEntityPoolEvent(ref long, out EntityPoolEvent)"/>.
+        /// The pools are compared against the last frame once per frame for all scripts, and keep being watched until
+        /// the script domain is unloaded. The entities that already exist are reported as created in the next frame.
+        /// </summary>
+        /// <param name="kindMask">
+        /// The bit mask of the <see cref="NativeMemory.EntityPoolKind"/>s to watch. Only the vehicle, ped, object and
+        /// pickup object pools can be watched, and other bits are ignored.
+        /// </param>
+        public void WatchEntityPools(uint kindMask)
+        {
+            const uint WatchablePools = (1u << (int)NativeMemory.EntityPoolKind.Vehicle)
+                | (1u << (int)NativeMemory.EntityPoolKind.Ped)
+                | (1u << (int)NativeMemory.EntityPoolKind.Object)
+                | (1u << (int)NativeMemory.EntityPoolKind.PickupObject);
+
+            int watchedPools, newWatchedPools;
+            do
+            {
+                watchedPools = _watchedEntityPools;
+                newWatchedPools = watchedPools | (int)(kindMask & WatchablePools);
+            }
+            while (Interlocked.CompareExchange(ref _watchedEntityPools, newWatchedPools, watchedPools) != watchedPools);
+        }
+        /// <summary>
+        /// Gets the sequence number the next entity pool event will be published with. A new cursor for
+        /// <see cref="TryReadEntityPoolEvent(ref long, out EntityPoolEvent)"/> should start here.
+        /// </summary>
+        public long EntityPoolEventSequence => _entityPoolEvents.WriteSequence;
+        /// <summary>
+        /// Reads the next entity pool event at a cursor and advances the cursor.
+        /// A cursor that falls more than 4096 events behind misses the oldest events.
+        /// </summary>
+        /// <param name="cursor">The cursor of the reader, which starts at <see cref="EntityPoolEventSequence"/>.</param>
+        /// <param name="ev">The event read.</param>
+        /// <returns><see langword="true"/> if an event was read; <see langword="false"/> if there are no new events.</returns>
+        public bool TryReadEntityPoolEvent(ref long cursor, out EntityPoolEvent ev)
+        {
+            return _entityPoolEvents.TryRead(ref cursor, out ev);
+        }
+        /// <summary>
+        /// Gets the script handle of the entity of an entity pool event. For a creation event, the handle is created
+        /// if the entity doesn't have one yet, so deletion events for the entity carry it later.
+        /// </summary>
+        /// <param name="ev">The event read with <see cref="TryReadEntityPoolEvent(ref long, out EntityPoolEvent)"/>.</param>
+        /// <param name="handle">
+        /// The script handle, or 0 if the created entity no longer exists or no handle was asked for the deleted one.
+        /// </param>
+        /// <returns>
+        /// <see langword="false"/> if the pool of script handles is full, in which case the handle should be asked
+        /// for again later; otherwise, <see langword="true"/>.
+        /// </returns>
+        public bool TryGetEntityPoolEventHandle(in EntityPoolEvent ev, out int handle)
+        {
+            if (!ev.IsCreated)
             {
-                return _keyboardState[(int)key];
+                handle = ev.Handle;
+                return true;
+            }
+
+            var task = new ResolveEntityPoolEventHandleTask { _watcher = _entityPoolWatcher, _event = ev };
+            ExecuteTaskWithGameThreadTlsContext(ref task);
+
+            handle = task._handle;
+            return task._isResolved;
+        }
+
+        private struct ResolveEntityPoolEventHandleTask : IScriptTask
+        {
+            internal NativeMemory.EntityPoolWatcher _watcher;
+            internal EntityPoolEvent _event;
+            internal int _handle;
+            internal bool _isResolved;
+
+            public void Run()
+            {
+                _isResolved = _watcher.TryResolveHandle(in _event, out _handle);
             }
         }
         /// <summary>
@@ -1635,21 +1771,48 @@ namespace SHVDN
         /// <param name="pause"><see langword="true" /> to pause or <see langword="false" /> to resume</param>
         public void PauseKeyEvents(bool pause)
         {
-            _rwLock.EnterWriteLock();
-            try
+            _recordKeyboardEvents = !pause;
+        }
+
+        /// <summary>
+        /// Main execution logic of the script domain.
+        /// </summary>
+        internal void DoTick()
+        {
+            long doTickStartTimestamp = Stopwatch.GetTimestamp();
+
+            _scheduler.WakeUpScripts(doTickStartTimestamp);
+
+            if (_scheduler.HasFrameBudget)
             {
-                _recordKeyboardEvents = !pause;
+                // Run important scripts first, so they are the least likely to be deferred if the budget is used up
+                TickScripts(doTickStartTimestamp, ScriptPriority.High);
+                TickScripts(doTickStartTimestamp, ScriptPriority.Normal);
+                TickScripts(doTickStartTimestamp, ScriptPriority.Low);
             }
-            finally
+            else
             {
-                _rwLock.ExitWriteLock();
+                TickScripts(doTickStartTimestamp, null);
+            }
+
+            NativeProfiler.OnTickEnd(this);
+
+            if (TimelineTracer.IsRecording)
+            {
+                TimelineTracer.AddCompleteEvent("ScriptDomain.DoTick", TimelineTracer.CategoryTick,
+                    doTickStartTimestamp);
             }
+
+            // Clean up any pinned strings of this frame
+            CleanupStrings();
         }
 
         /// <summary>
-        /// Main execution logic of the script domain.
+        /// Runs a tick of the running scripts that aren't waiting.
         /// </summary>
-        internal void DoTick()
+        /// <param name="doTickStartTimestamp">The timestamp the tick of the script domain started at.</param>
+        /// <param name="priority">The priority of the scripts to run, or <see langword="null"/> to run all scripts.</param>
+        private void TickScripts(long doTickStartTimestamp, ScriptPriority? priority)
         {
             // Execute running scripts. Running scripts count should be read every time we execute `DoTick` on a script
             // because a script may instantiate additional script instances. Otherwise, the loop will end up skipping
@@ -1677,12 +1840,21 @@ namespace SHVDN
                     continue;
                 }
 
+                if ((priority.HasValue && script.Priority != priority.Value) || script.IsSleeping
+                    || _scheduler.ShouldDefer(script, doTickStartTimestamp))
+                {
+                    continue;
+                }
+
                 lock (_lockForFieldsThatFrequentlyWritten)
                 {
                     _executingScript = script;
                 }
 
-                script.StopwatchForTimeout.Restart();
+                script.RestartTimeoutClock();
+                uint elapsedTimeForTimeout = 0;
+                long tickStartTimestamp = Stopwatch.GetTimestamp();
+                long nativeCallCountBeforeTick = script.NativeCallCount;
                 try
                 {
                     if (script.IsUsingThread)
@@ -1699,16 +1871,38 @@ namespace SHVDN
                         {
                             if (_taskQueue.TryDequeue(out IScriptTask poppedTask))
                             {
+                                long taskStartTimestamp = Stopwatch.GetTimestamp();
                                 poppedTask.Run();
+                                if (TimelineTracer.IsRecording)
+                                {
+                                    TimelineTracer.AddCompleteEvent(poppedTask.GetType().Name,
+                                        TimelineTracer.CategoryTask, taskStartTimestamp);
+                                }
                             }
                             SignalAndWait(continueEvent, waitEvent);
                         }
                     }
+                    else if (script.IsCooperative)
+                    {
+                        script.DoCooperativeTick();
+                    }
                     else
                     {
                         script.DoTick();
                     }
-                    script.StopwatchForTimeout.Stop();
+                    elapsedTimeForTimeout = script.ElapsedMillisecondsSinceTimeoutClockRestart;
+                    long tickEndTimestamp = Stopwatch.GetTimestamp();
+                    script.TickStats.Record(tickEndTimestamp - tickStartTimestamp,
+                        script.NativeCallCount - nativeCallCountBeforeTick);
+                    if (script.IsUsingThread && script.IsRunning)
+                    {
+                        _scheduler.ScheduleWakeUp(script, tickEndTimestamp);
+                    }
+                    if (TimelineTracer.IsRecording)
+                    {
+                        TimelineTracer.AddCompleteEvent(script.Name, TimelineTracer.CategoryScript,
+                            tickStartTimestamp);
+                    }
                 }
                 catch (Exception ex)
                 {
@@ -1725,10 +1919,8 @@ namespace SHVDN
                     continue;
                 }
 
-                uint elapsedTimeForTimeout = 0;
                 lock (_lockForFieldsThatFrequentlyWritten)
                 {
-                    elapsedTimeForTimeout = _executingScript.StopwatchForTimeout.ElapsedMilliseconds;
                     _executingScript = null;
                 }
 
@@ -1744,9 +1936,31 @@ namespace SHVDN
                 script.Abort();
                 continue;
             }
+        }
 
-            // Clean up any pinned strings of this frame
-            CleanupStrings();
+        /// <summary>
+        /// Records a tick of the CLR thread in the timeline, which is driven from the main domain.
+        /// </summary>
+        internal void TraceClrThreadTick(long startTimestamp, long endTimestamp)
+        {
+            if (TimelineTracer.IsRecording)
+            {
+                TimelineTracer.AddCompleteEvent("ClrThreadProc tick", TimelineTracer.CategoryTick, startTimestamp,
+                    endTimestamp);
+            }
+        }
+
+        /// <summary>
+        /// Gets the tick time statistics of all running scripts, sorted by the 95th percentile tick time in descending
+        /// order. This must only be called in the main thread.
+        /// </summary>
+        internal KeyValuePair<Script, ScriptTickStatsSnapshot>[] GetScriptTickStats()
+        {
+            return RunningScripts
+                .Where(x => x.IsRunning)
+                .Select(x => new KeyValuePair<Script, ScriptTickStatsSnapshot>(x, x.TickStats.GetSnapshot()))
+                .OrderByDescending(x => x.Value.P95)
+                .ToArray();
         }
 
         private int GetRunningScriptsCount()
@@ -1766,51 +1980,147 @@ namespace SHVDN
         }
 
         /// <summary>
-        /// Keyboard handling logic of the script domain.
+        /// Runs a frame of the console and the scripts. This is the only call the main domain makes into this domain
+        /// per frame, since every call through the proxy of this domain is a costly cross-domain transition.
         /// </summary>
-        /// <param name="keys">The key that was originated this event and its modifiers.</param>
-        /// <param name="status"><see langword="true" /> on a key down, <see langword="false" /> on a key up event.</param>
-        internal void DoKeyEvent(Keys keys, bool status)
-        {
-            var e = new KeyEventArgs(keys);
+        /// <param name="traceClrThreadTick">Whether to record the tick of the CLR thread in the timeline.</param>
+        /// <param name="clrThreadTickStartTimestamp">The timestamp the tick of the CLR thread started at.</param>
+        /// <param name="keyMessageCount">
+        /// The number of key messages the main domain has put in the array passed to
+        /// <see cref="InitKeyMessageBuffer(IntPtr)"/> for this frame.
+        /// </param>
+        internal void DoFrame(bool traceClrThreadTick, long clrThreadTickStartTimestamp, int keyMessageCount)
+        {
+            // Deliver the key messages since the last frame before anything runs, so the console and all scripts see
+            // the same events in this frame
+            if (keyMessageCount > 0 && _frameKeyMessages != IntPtr.Zero)
+            {
+                unsafe
+                {
+                    var keyMessages = (NativeKeyMessage*)_frameKeyMessages;
+                    for (int i = 0; i < keyMessageCount; i++)
+                    {
+                        DoKeyMessage((Keys)keyMessages[i].Keys, keyMessages[i].IsDown != 0);
+                    }
+                }
+            }
 
-            // Only update state of the primary key (without modifiers) here
-            lock (_lockForFieldsThatFrequentlyWritten)
+            PublishKeyboardState();
+
+            // Entities may have been created, deleted or moved since the last frame, and blocks of global variables
+            // may have been loaded or unloaded
+            NativeMemory.AdvanceTickStamp();
+            NativeMemory.InvalidateEntityPoolSnapshot();
+            PublishEntityPoolEvents();
+
+            _console?.DoTick();
+
+            DoTick();
+
+            if (traceClrThreadTick)
             {
-                _keyboardState[(int)e.KeyCode] = status;
+                TraceClrThreadTick(clrThreadTickStartTimestamp, Stopwatch.GetTimestamp());
             }
 
-            bool recordKeyEvents = false;
-            _rwLock.EnterReadLock();
-            try
+            // Hand the chunk to the writer only after the tick of the CLR thread is in it, or the last tick of a
+            // recording would be missing from the file
+            TimelineTracer.OnTickEnd();
+        }
+
+        /// <summary>
+        /// Publishes the entities created and deleted in the watched pools since the last frame, so the pools are
+        /// compared once and the changes are shared by all scripts.
+        /// </summary>
+        private void PublishEntityPoolEvents()
+        {
+            uint watchedPools = (uint)Volatile.Read(ref _watchedEntityPools);
+            if (watchedPools == 0 || !IsTlsStuffInitialized())
             {
-                recordKeyEvents = _recordKeyboardEvents;
+                return;
             }
-            finally
+
+            _entityPoolWatcher.KindMask = watchedPools;
+            ExecuteTaskWithGameThreadTlsContext(_entityPoolWatcher);
+        }
+
+        /// <summary>
+        /// Publishes the key state of this frame along with the edges since the last frame, so they are computed once
+        /// and shared by all scripts.
+        /// </summary>
+        private void PublishKeyboardState()
+        {
+            KeyboardFrameState current = _keyboardFrameState;
+            bool hasEdges = !_pendingKeysPressed.IsEmpty || !_pendingKeysReleased.IsEmpty;
+            // Only allocate a new state in frames where something changed or the edges of the last frame expire
+            if (!hasEdges && !current.HasEdges && current.Down.Equals(_pendingKeysDown))
             {
-                _rwLock.ExitReadLock();
+                return;
             }
 
-            if (!recordKeyEvents)
+            _keyboardFrameState = new KeyboardFrameState(_pendingKeysDown, _pendingKeysPressed, _pendingKeysReleased);
+            _pendingKeysPressed = default;
+            _pendingKeysReleased = default;
+        }
+
+        /// <summary>
+        /// Sends a key event to the console and, unless the console is open, to the scripts.
+        /// </summary>
+        /// <param name="keys">The key that was originated this event and its modifiers.</param>
+        /// <param name="status"><see langword="true" /> on a key down, <see langword="false" /> on a key up event.</param>
+        private void DoKeyMessage(Keys keys, bool status)
+        {
+            // If the TLS stuff is not initialized, the console or some script can call a native function without
+            // swapping TLS address, leading the whole process to crash
+            if (!IsTlsStuffInitialized())
             {
                 return;
             }
 
-            var eventInfo = new KeyboardEvent(status, e);
+            Console console = _console;
+            if (console != null)
+            {
+                console.DoKeyEvent(keys, status);
 
-            // we are only interested in the running script list as a lock target
-            _rwLock.EnterReadLock();
-            try
+                // Do not send keyboard events to other running scripts when console is open
+                if (console.IsOpen)
+                {
+                    return;
+                }
+            }
+
+            DoKeyEvent(keys, status);
+        }
+
+        /// <summary>
+        /// Keyboard handling logic of the script domain.
+        /// </summary>
+        /// <param name="keys">The key that was originated this event and its modifiers.</param>
+        /// <param name="status"><see langword="true" /> on a key down, <see langword="false" /> on a key up event.</param>
+        internal void DoKeyEvent(Keys keys, bool status)
+        {
+            var e = new KeyEventArgs(keys);
+
+            // Record the edges, so a key tapped within a frame is still seen as just pressed in the next frame
+            if (status != _pendingKeysDown.IsDown(e.KeyCode))
             {
-                foreach (Script script in _runningScripts)
+                if (status)
+                {
+                    _pendingKeysPressed = _pendingKeysPressed.WithKey(e.KeyCode, true);
+                }
+                else
                 {
-                    script._keyboardEvents.Enqueue(eventInfo);
+                    _pendingKeysReleased = _pendingKeysReleased.WithKey(e.KeyCode, true);
                 }
             }
-            finally
+            _pendingKeysDown = _pendingKeysDown.WithKey(e.KeyCode, status).WithModifiers(e.Modifiers);
+
+            if (!_recordKeyboardEvents)
             {
-                _rwLock.ExitReadLock();
+                return;
             }
+
+            // Stored once and read by every script through its own cursor
+            _keyboardEvents.Publish(new KeyboardEvent(status, e));
         }
 
         /// <summary>
@@ -1820,34 +2130,44 @@ namespace SHVDN
         {
             lock (_pinnedStrListLock)
             {
-                foreach (IntPtr handle in _pinnedStrings)
-                {
-                    Marshal.FreeCoTaskMem(handle);
-                }
-
-                _pinnedStrings.Clear();
+                _pinnedStrings.Reset();
             }
         }
         /// <summary>
         /// Pins the memory of a string so that it can be used in native calls without worrying about the GC invalidating its pointer.
+        /// The pointer is valid until the end of the current frame.
         /// </summary>
         /// <param name="str">The string to pin to a fixed pointer.</param>
         /// <returns>A pointer to the pinned memory containing the string.</returns>
         public IntPtr PinString(string str)
         {
-            IntPtr handle = StringMarshal.StringToCoTaskMemUtf8(str);
+            IntPtr handle;
+            lock (_pinnedStrListLock)
+            {
+                handle = _pinnedStrings.Pin(str);
+            }
 
             if (handle == IntPtr.Zero)
             {
                 return NativeMemory.NullString;
             }
 
+            return handle;
+        }
+        /// <summary>
+        /// Pins the memory of a part of a string without creating a substring.
+        /// The pointer is valid until the end of the current frame.
+        /// </summary>
+        /// <param name="str">The string the part is in.</param>
+        /// <param name="startIndex">The index of the first char of the part.</param>
+        /// <param name="length">The number of chars in the part.</param>
+        /// <returns>A pointer to the pinned memory containing the part of the string.</returns>
+        internal IntPtr PinString(string str, int startIndex, int length)
+        {
             lock (_pinnedStrListLock)
             {
-                _pinnedStrings.Add(handle);
+                return _pinnedStrings.Pin(str, startIndex, length);
             }
-
-            return handle;
         }
 
         /// <summary>
@@ -1910,6 +2230,33 @@ namespace SHVDN
             }
         }
 
+        /// <summary>
+        /// Starts a script in the mode its 'GTA.ScriptAttributes' attribute asks for.
+        /// </summary>
+        /// <param name="script">The script to start, or <see langword="null"/> if it failed to instantiate.</param>
+        private static void StartScript(Script script)
+        {
+            if (script == null)
+            {
+                return;
+            }
+
+            Type scriptType = script.ScriptInstance.GetType();
+            if (GetScriptAttribute(scriptType, "Priority") is int priority)
+            {
+                // Clamp the value in case the script casts an undefined value to the enum
+                script.Priority = (ScriptPriority)Math.Sign(priority);
+            }
+
+            if (GetScriptAttribute(scriptType, "CooperativeAsync") is bool cooperativeAsync && cooperativeAsync)
+            {
+                script.StartCooperative();
+                return;
+            }
+
+            script.Start(!(GetScriptAttribute(scriptType, "NoScriptThread") is bool NoScriptThread) || !NoScriptThread);
+        }
+
         /// <summary>
         /// Checks if the script has a 'GTA.ScriptAttributes' attribute with the specified argument attached to it and returns it.
         /// </summary>
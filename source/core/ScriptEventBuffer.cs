@@ -0,0 +1,80 @@
+//
+// Copyright (C) 2015 crosire & kagikn & contributors
+// License: https://github.com/scripthookvdotnet/scripthookvdotnet#license
+//
+
+using System.Threading;
+
+namespace SHVDN
+{
+    /// <summary>
+    /// A broadcast buffer of events of a script domain, such as keyboard events. Each script reads the events through
+    /// its own cursor, so an event is stored once no matter how many scripts are running.
+    /// </summary>
+    /// <remarks>
+    /// Events are only published in the main thread of the script domain at the start of a tick, before any script
+    /// runs, and scripts only read them while they are running, so the buffer needs no lock.
+    /// A script that falls more than <see cref="Capacity"/> events behind, such as one that waits for a long time,
+    /// misses the oldest events.
+    /// </remarks>
+    internal sealed class ScriptEventBuffer<T> where T : struct
+    {
+        private readonly T[] _events;
+        private readonly int _indexMask;
+        private long _writeSequence;
+
+        /// <param name="capacity">The number of events to keep. Must be a power of 2.</param>
+        internal ScriptEventBuffer(int capacity)
+        {
+            _events = new T[capacity];
+            _indexMask = capacity - 1;
+        }
+
+        /// <summary>
+        /// Gets the number of events kept in the buffer.
+        /// </summary>
+        internal int Capacity => _events.Length;
+
+        /// <summary>
+        /// Gets the sequence number the next event will be published with. A new cursor should start here.
+        /// </summary>
+        internal long WriteSequence => Volatile.Read(ref _writeSequence);
+
+        /// <summary>
+        /// Publishes an event to all scripts.
+        /// This must be called in the main thread of the script domain.
+        /// </summary>
+        internal void Publish(T ev)
+        {
+            long writeSequence = _writeSequence;
+            _events[writeSequence & _indexMask] = ev;
+            Volatile.Write(ref _writeSequence, writeSequence + 1);
+        }
+
+        /// <summary>
+        /// Reads the next event at a cursor and advances the cursor.
+        /// </summary>
+        /// <param name="cursor">The cursor of the reading script.</param>
+        /// <param name="ev">The event read.</param>
+        /// <returns><see langword="true"/> if an event was read; <see langword="false"/> if there are no new events.</returns>
+        internal bool TryRead(ref long cursor, out T ev)
+        {
+            long writeSequence = Volatile.Read(ref _writeSequence);
+            if (cursor >= writeSequence)
+            {
+                ev = default;
+                return false;
+            }
+
+            // Skip the events that have already been overwritten
+            if (writeSequence - cursor > _events.Length)
+            {
+                cursor = writeSequence - _events.Length;
+            }
+
+            ev = _events[cursor & _indexMask];
+            cursor++;
+            return true;
+        }
+    }
+}
@@ -0,0 +1,121 @@
+//
+// Copyright (C) 2015 crosire & kagikn & contributors
+// License: https://github.com/scripthookvdotnet/scripthookvdotnet#license
+//
+
+using System;
+using System.Threading;
+
+namespace SHVDN
+{
+    /// <summary>
+    /// A job that runs pure managed work of a script in a worker thread of <see cref="JobSystem"/>.
+    /// </summary>
+    /// <remarks>
+    /// The state of the job only changes at a tick boundary of the owner script, right before its
+    /// <see cref="Script.Tick"/> event is raised. The script can check <see cref="IsCompleted"/> and read
+    /// <see cref="Result"/> in its tick without any synchronization.
+    /// </remarks>
+    public sealed class ScriptJob
+    {
+        private readonly Func<CancellationToken, object> _work;
+        private readonly Action<ScriptJob> _completed;
+        private readonly CancellationTokenSource _cancellationSource;
+
+        // Written by the worker thread, then published to the public properties in the thread of the owner script
+        private object _pendingResult;
+        private Exception _pendingException;
+        private bool _pendingIsCanceled;
+
+        internal ScriptJob(Script owner, Func<CancellationToken, object> work, Action<ScriptJob> completed,
+            CancellationToken cancellationToken)
+        {
+            Owner = owner;
+            _work = work;
+            _completed = completed;
+            // Linked to the token of the script, so the job is canceled when the script is aborted
+            _cancellationSource = CancellationTokenSource.CreateLinkedTokenSource(cancellationToken);
+        }
+
+        /// <summary>
+        /// Gets the script that started this job.
+        /// </summary>
+        public Script Owner { get; }
+
+        /// <summary>
+        /// Gets whether this job has finished, whether it succeeded, threw an exception or was canceled.
+        /// </summary>
+        public bool IsCompleted { get; private set; }
+        /// <summary>
+        /// Gets whether this job was canceled with <see cref="Cancel"/> before it finished.
+        /// </summary>
+        public bool IsCanceled { get; private set; }
+        /// <summary>
+        /// Gets the value the work returned, or <see langword="null"/> if the job has not completed successfully.
+        /// </summary>
+        public object Result { get; private set; }
+        /// <summary>
+        /// Gets the exception the work threw, or <see langword="null"/> if it didn't throw one.
+        /// </summary>
+        public Exception Exception { get; private set; }
+
+        /// <summary>
+        /// Requests this job to stop. The job will complete as canceled if it hasn't started yet, or if the work
+        /// throws an <see cref="OperationCanceledException"/> for the token it was passed.
+        /// This must be called in the thread of the owner script.
+        /// </summary>
+        public void Cancel()
+        {
+            if (!IsCompleted)
+            {
+                _cancellationSource.Cancel();
+            }
+        }
+
+        /// <summary>
+        /// Runs the work in the current worker thread.
+        /// </summary>
+        internal void Execute()
+        {
+            CancellationToken cancellationToken = _cancellationSource.Token;
+            if (cancellationToken.IsCancellationRequested)
+            {
+                _pendingIsCanceled = true;
+            }
+            else
+            {
+                try
+                {
+                    _pendingResult = _work(cancellationToken);
+                }
+                catch (OperationCanceledException) when (cancellationToken.IsCancellationRequested)
+                {
+                    _pendingIsCanceled = true;
+                }
+                catch (Exception ex)
+                {
+                    _pendingException = ex;
+                }
+            }
+
+            // The queue of an aborted script is never drained, so the job is just dropped in that case
+            Owner.EnqueueCompletedJob(this);
+        }
+
+        /// <summary>
+        /// Makes the result visible to the owner script and invokes the completion callback.
+        /// This must be called in the thread of the owner script.
+        /// </summary>
+        internal void Publish()
+        {
+            Result = _pendingResult;
+            Exception = _pendingException;
+            IsCanceled = _pendingIsCanceled;
+            IsCompleted = true;
+            // Unregisters the job from the token of the script
+            _cancellationSource.Dispose();
+
+            _completed?.Invoke(this);
+        }
+    }
+}
@@ -0,0 +1,170 @@
+//
+// Copyright (C) 2015 crosire & kagikn & contributors
+// License: https://github.com/scripthookvdotnet/scripthookvdotnet#license
+//
+
+using System.Collections.Generic;
+using System.Diagnostics;
+
+namespace SHVDN
+{
+    /// <summary>
+    /// The priorities of scripts, which decide the order scripts run in and which scripts can be deferred when
+    /// the frame budget is used up.
+    /// </summary>
+    internal enum ScriptPriority
+    {
+        Low = -1,
+        Normal = 0,
+        High = 1,
+    }
+
+    /// <summary>
+    /// Decides which scripts run in a tick of the script domain.
+    /// </summary>
+    /// <remarks>
+    /// <para>
+    /// Scripts waiting in <see cref="Script.Wait(int)"/> are parked in a timing wheel until their wait is over,
+    /// so the script domain doesn't have to resume their threads every frame only for them to wait again.
+    /// </para>
+    /// <para>
+    /// When a frame budget is set, scripts run in the order of their priorities, and <see cref="ScriptPriority.Low"/>
+    /// scripts are deferred to the next frame once the scripts in the frame have used up the budget.
+    /// </para>
+    /// <para>
+    /// Only accessed in the main thread of the script domain, so no lock is used.
+    /// </para>
+    /// </remarks>
+    internal sealed class ScriptScheduler
+    {
+        // Must be a power of 2. 64 slots of 8 ms cover about half a second per round of the wheel, so most waits are
+        // visited only once. Longer waits stay in their slot and are checked once per round.
+        private const int WheelSlotCount = 64;
+        private const int WheelSlotMask = WheelSlotCount - 1;
+        private const int SlotDurationInMilliseconds = 8;
+
+        /// <summary>
+        /// The number of frames in a row a <see cref="ScriptPriority.Low"/> script can be deferred for, so it can't be
+        /// starved by other scripts that always use up the budget.
+        /// </summary>
+        internal const int MaxDeferredFrameCount = 10;
+
+        private readonly List<Script>[] _wheelSlots = new List<Script>[WheelSlotCount];
+        private readonly long _slotDurationInTicks = Stopwatch.Frequency * SlotDurationInMilliseconds / 1000;
+        // The absolute index of the last slot whose time has completely passed
+        private long _lastPassedSlotIndex;
+        private long _frameBudgetInTicks;
+
+        internal ScriptScheduler()
+        {
+            for (int i = 0; i < _wheelSlots.Length; i++)
+            {
+                _wheelSlots[i] = new List<Script>();
+            }
+
+            _lastPassedSlotIndex = Stopwatch.GetTimestamp() / _slotDurationInTicks - 1;
+        }
+
+        /// <summary>
+        /// Gets or sets the time in milliseconds all scripts can take in a frame before <see cref="ScriptPriority.Low"/>
+        /// scripts are deferred. Zero or less disables the budget.
+        /// </summary>
+        internal double FrameBudgetInMilliseconds
+        {
+            get => _frameBudgetInTicks * 1000.0 / Stopwatch.Frequency;
+            set => _frameBudgetInTicks = value > 0 ? (long)(value * Stopwatch.Frequency / 1000) : 0;
+        }
+
+        /// <summary>
+        /// Gets whether a frame budget is set, in which case scripts should run in the order of their priorities.
+        /// </summary>
+        internal bool HasFrameBudget => _frameBudgetInTicks > 0;
+
+        /// <summary>
+        /// Gets the number of times a script has been deferred because the frame budget was used up.
+        /// </summary>
+        internal long DeferredScriptCount { get; private set; }
+
+        /// <summary>
+        /// Parks a script that has just yielded until <see cref="Script.WakeUpTimestamp"/>, if the time is in the future.
+        /// </summary>
+        internal void ScheduleWakeUp(Script script, long nowTimestamp)
+        {
+            long wakeUpTimestamp = script.WakeUpTimestamp;
+            if (wakeUpTimestamp <= nowTimestamp || script.IsSleeping)
+            {
+                return;
+            }
+
+            long slotIndex = wakeUpTimestamp / _slotDurationInTicks;
+            if (slotIndex <= _lastPassedSlotIndex)
+            {
+                slotIndex = _lastPassedSlotIndex + 1;
+            }
+
+            script.IsSleeping = true;
+            _wheelSlots[slotIndex & WheelSlotMask].Add(script);
+        }
+
+        /// <summary>
+        /// Wakes up the parked scripts whose waits are over. Should be called at the start of every tick.
+        /// </summary>
+        internal void WakeUpScripts(long nowTimestamp)
+        {
+            long currentSlotIndex = nowTimestamp / _slotDurationInTicks;
+
+            // Visit every slot at most once, even after a long pause such as a loading screen. The current slot is
+            // visited again in the next tick since its time hasn't completely passed yet.
+            long firstSlotIndex = _lastPassedSlotIndex + 1;
+            if (currentSlotIndex - firstSlotIndex >= WheelSlotCount)
+            {
+                firstSlotIndex = currentSlotIndex - WheelSlotCount + 1;
+            }
+
+            for (long slotIndex = firstSlotIndex; slotIndex <= currentSlotIndex; slotIndex++)
+            {
+                List<Script> slot = _wheelSlots[slotIndex & WheelSlotMask];
+                for (int i = slot.Count - 1; i >= 0; i--)
+                {
+                    Script script = slot[i];
+                    // Scripts that wait for more than a round of the wheel stay in the slot
+                    if (script.WakeUpTimestamp > nowTimestamp && script.IsRunning)
+                    {
+                        continue;
+                    }
+
+                    int lastIndex = slot.Count - 1;
+                    slot[i] = slot[lastIndex];
+                    slot.RemoveAt(lastIndex);
+                    script.IsSleeping = false;
+                }
+            }
+
+            _lastPassedSlotIndex = currentSlotIndex - 1;
+        }
+
+        /// <summary>
+        /// Determines whether a script should be deferred to the next frame because the frame budget is used up.
+        /// </summary>
+        /// <param name="script">The script that is about to run.</param>
+        /// <param name="frameStartTimestamp">The timestamp the tick of the script domain started at.</param>
+        internal bool ShouldDefer(Script script, long frameStartTimestamp)
+        {
+            if (_frameBudgetInTicks <= 0 || script.Priority != ScriptPriority.Low)
+            {
+                return false;
+            }
+
+            if (Stopwatch.GetTimestamp() - frameStartTimestamp < _frameBudgetInTicks
+                || script.DeferredFrameCount >= MaxDeferredFrameCount)
+            {
+                script.DeferredFrameCount = 0;
+                return false;
+            }
+
+            script.DeferredFrameCount++;
+            DeferredScriptCount++;
+            return true;
+        }
+    }
+}
@@ -0,0 +1,79 @@
+//
+// Copyright (C) 2015 crosire & kagikn & contributors
+// License: https://github.com/scripthookvdotnet/scripthookvdotnet#license
+//
+
+using System;
+using System.Collections.Concurrent;
+using System.Collections.Generic;
+using System.Threading;
+
+namespace SHVDN
+{
+    /// <summary>
+    /// A <see cref="SynchronizationContext"/> that runs continuations of a cooperative script in the main thread of
+    /// the script domain during the slice of the script, so the script doesn't need a dedicated thread.
+    /// </summary>
+    internal sealed class ScriptSynchronizationContext : SynchronizationContext
+    {
+        private readonly ConcurrentQueue<KeyValuePair<SendOrPostCallback, object>> _pendingCallbacks = new();
+        private readonly int _domainThreadId;
+        private int _outstandingOperationCount;
+
+        internal ScriptSynchronizationContext(int domainThreadId)
+        {
+            _domainThreadId = domainThreadId;
+        }
+
+        /// <summary>
+        /// Gets whether any <see langword="async"/> <see langword="void"/> method started in this context, such as an
+        /// asynchronous tick handler, has not completed yet.
+        /// </summary>
+        internal bool HasOutstandingOperations => Volatile.Read(ref _outstandingOperationCount) > 0;
+
+        public override void Post(SendOrPostCallback d, object state)
+        {
+            // Awaited tasks may complete in any thread, so the callback is always queued and run in the next slice
+            _pendingCallbacks.Enqueue(new KeyValuePair<SendOrPostCallback, object>(d, state));
+        }
+
+        public override void Send(SendOrPostCallback d, object state)
+        {
+            if (Thread.CurrentThread.ManagedThreadId != _domainThreadId)
+            {
+                throw new NotSupportedException("Synchronous calls to a cooperative script from other threads are not supported.");
+            }
+
+            d(state);
+        }
+
+        public override SynchronizationContext CreateCopy() => this;
+
+        // `AsyncVoidMethodBuilder` calls these when an `async void` method starts and completes
+        public override void OperationStarted() => Interlocked.Increment(ref _outstandingOperationCount);
+        public override void OperationCompleted() => Interlocked.Decrement(ref _outstandingOperationCount);
+
+        /// <summary>
+        /// Runs the callbacks that were posted before this call. Callbacks posted while running them are run in the
+        /// next slice, so a continuation that yields can't make the slice run forever.
+        /// </summary>
+        internal void RunPendingCallbacks()
+        {
+            int count = _pendingCallbacks.Count;
+            for (int i = 0; i < count && _pendingCallbacks.TryDequeue(out KeyValuePair<SendOrPostCallback, object> callback); i++)
+            {
+                callback.Key(callback.Value);
+            }
+        }
+
+        /// <summary>
+        /// Discards all pending callbacks, so no continuation of an aborted script will run.
+        /// </summary>
+        internal void Clear()
+        {
+            while (_pendingCallbacks.TryDequeue(out _))
+            {
+            }
+        }
+    }
+}
@@ -0,0 +1,129 @@
+//
+// Copyright (C) 2015 crosire & kagikn & contributors
+// License: https://github.com/scripthookvdotnet/scripthookvdotnet#license
+//
+
+using System;
+using System.Diagnostics;
+using System.Globalization;
+
+namespace SHVDN
+{
+    /// <summary>
+    /// Keeps rolling statistics of how long the ticks of a script take.
+    /// </summary>
+    /// <remarks>
+    /// Only accessed in the main thread of the script domain, so no lock is used.
+    /// </remarks>
+    internal sealed class ScriptTickStats
+    {
+        /// <summary>
+        /// The number of the most recent ticks percentiles are calculated from, which is about 5 seconds at 60 FPS.
+        /// </summary>
+        internal const int SampleCapacity = 300;
+
+        private readonly long[] _samples = new long[SampleCapacity];
+        private int _nextSampleIndex;
+        private int _sampleCount;
+
+        /// <summary>
+        /// Gets the number of ticks the script has run.
+        /// </summary>
+        public long TickCount { get; private set; }
+        /// <summary>
+        /// Gets the number of native calls the script has made in its ticks.
+        /// </summary>
+        public long NativeCallCount { get; private set; }
+        /// <summary>
+        /// Gets the longest tick time in <see cref="Stopwatch"/> ticks.
+        /// </summary>
+        public long MaxElapsedTicks { get; private set; }
+
+        /// <summary>
+        /// Records a tick of the script.
+        /// </summary>
+        /// <param name="elapsedTicks">How long the tick took in <see cref="Stopwatch"/> ticks.</param>
+        /// <param name="nativeCallCount">How many native calls the script made in the tick.</param>
+        public void Record(long elapsedTicks, long nativeCallCount)
+        {
+            _samples[_nextSampleIndex] = elapsedTicks;
+            _nextSampleIndex = (_nextSampleIndex + 1) % SampleCapacity;
+            if (_sampleCount < SampleCapacity)
+            {
+                _sampleCount++;
+            }
+
+            TickCount++;
+            NativeCallCount += nativeCallCount;
+            if (elapsedTicks > MaxElapsedTicks)
+            {
+                MaxElapsedTicks = elapsedTicks;
+            }
+        }
+
+        /// <summary>
+        /// Calculates the percentiles of the recent tick times.
+        /// </summary>
+        public ScriptTickStatsSnapshot GetSnapshot()
+        {
+            if (_sampleCount == 0)
+            {
+                return new ScriptTickStatsSnapshot(0, 0, 0, ToMilliseconds(MaxElapsedTicks), TickCount, NativeCallCount);
+            }
+
+            long[] sorted = new long[_sampleCount];
+            Array.Copy(_samples, sorted, _sampleCount);
+            Array.Sort(sorted);
+
+            return new ScriptTickStatsSnapshot(
+                ToMilliseconds(GetPercentile(sorted, 50)),
+                ToMilliseconds(GetPercentile(sorted, 95)),
+                ToMilliseconds(GetPercentile(sorted, 99)),
+                ToMilliseconds(MaxElapsedTicks),
+                TickCount,
+                NativeCallCount);
+        }
+
+        private static long GetPercentile(long[] sorted, int percentile)
+        {
+            // Nearest-rank method
+            int rank = (percentile * sorted.Length + 99) / 100;
+            return sorted[Math.Max(rank - 1, 0)];
+        }
+
+        private static double ToMilliseconds(long elapsedTicks) => elapsedTicks * 1000.0 / Stopwatch.Frequency;
+    }
+
+    /// <summary>
+    /// Tick time statistics of a script at a point in time. All the times are in milliseconds.
+    /// </summary>
+    internal readonly struct ScriptTickStatsSnapshot
+    {
+        public ScriptTickStatsSnapshot(double p50, double p95, double p99, double max, long tickCount,
+            long nativeCallCount)
+        {
+            P50 = p50;
+            P95 = p95;
+            P99 = p99;
+            Max = max;
+            TickCount = tickCount;
+            NativeCallCount = nativeCallCount;
+        }
+
+        public double P50 { get; }
+        public double P95 { get; }
+        public double P99 { get; }
+        public double Max { get; }
+        public long TickCount { get; }
+        public long NativeCallCount { get; }
+
+        public double NativeCallsPerTick => TickCount != 0 ? (double)NativeCallCount / TickCount : 0.0;
+
+        public override string ToString()
+        {
+            return string.Format(CultureInfo.InvariantCulture,
+                "p50 {0:F2} ms, p95 {1:F2} ms, p99 {2:F2} ms, max {3:F2} ms, {4} ticks, {5:F1} natives/tick",
+                P50, P95, P99, Max, TickCount, NativeCallsPerTick);
+        }
+    }
+}
@@ -104,6 +104,18 @@ namespace SHVDN
             return (int)((indexOfPool << 8) + GetCounter(indexOfPool));
         }
 
+        /// <summary>
+        /// Gets an enumerator over the indices of the occupied slots, which tests the flags of 8 slots at once and
+        /// skips runs of empty slots without looking at them one by one.
+        /// </summary>
+        public OccupiedSlotEnumerator GetOccupiedSlots()
+        {
+            unsafe
+            {
+                return new OccupiedSlotEnumerator((byte*)Flags.ToPointer(), Capacity);
+            }
+        }
+
         [MethodImpl(MethodImplOptions.AggressiveInlining)]
         private byte GetCounter(uint index)
         {
@@ -125,5 +137,91 @@ namespace SHVDN
                 return (ulong)(~((num1 | -num1) >> 63));
             }
         }
+
+        /// <summary>
+        /// Enumerates the occupied slots of a <see cref="FwBasePool"/> by reading its flag bytes 8 at a time as a
+        /// <see cref="ulong"/> and testing their high bits together.
+        /// </summary>
+        /// <remarks>
+        /// The core assembly targets .NET Framework, which has no hardware intrinsics, so this uses 64-bit SWAR
+        /// instead of SIMD registers.
+        /// </remarks>
+        internal unsafe struct OccupiedSlotEnumerator
+        {
+            // The high bit of each flag byte is set when the slot is free
+            private const ulong HighBits = 0x8080808080808080;
+
+            private readonly byte* _flags;
+            private readonly uint _capacity;
+            private uint _nextWordStart;
+            private uint _wordStart;
+            // The occupied bits of the current word that have not been returned yet
+            private ulong _pendingBits;
+
+            internal OccupiedSlotEnumerator(byte* flags, uint capacity)
+            {
+                _flags = flags;
+                _capacity = capacity;
+                _nextWordStart = 0;
+                _wordStart = 0;
+                _pendingBits = 0;
+                Current = 0;
+            }
+
+            /// <summary>
+            /// Gets the index of the current occupied slot.
+            /// </summary>
+            public uint Current { get; private set; }
+
+            /// <summary>
+            /// Gets the reuse counter of the current slot, which is the low byte of its handle.
+            /// </summary>
+            public byte CurrentCounter => (byte)(_flags[Current] & 0x7F);
+
+            /// <summary>
+            /// Gets the pool handle of the current slot, the same value as <see cref="GetGuidHandleByIndex(uint)"/>.
+            /// </summary>
+            public int CurrentHandle => (int)((Current << 8) + CurrentCounter);
+
+            [MethodImpl(MethodImplOptions.AggressiveInlining)]
+            public bool MoveNext()
+            {
+                while (_pendingBits == 0)
+                {
+                    uint wordStart = _nextWordStart;
+                    if (wordStart >= _capacity)
+                    {
+                        return false;
+                    }
+
+                    uint remaining = _capacity - wordStart;
+                    if (remaining >= 8)
+                    {
+                        _pendingBits = ~*(ulong*)(_flags + wordStart) & HighBits;
+                    }
+                    else
+                    {
+                        // Don't read past the end of the flag array
+                        _pendingBits = 0;
+                        for (int i = 0; i < remaining; i++)
+                        {
+                            _pendingBits |= (ulong)(~_flags[wordStart + i] & 0x80) << (i * 8);
+                        }
+                    }
+
+                    _wordStart = wordStart;
+                    _nextWordStart = wordStart + 8;
+                }
+
+                // The lowest set bit is bit 8k+7 for the k-th byte. Shifted down to bit 8k, multiplying it moves
+                // the constant up by k bytes, which leaves k in the top byte.
+                ulong lowestBit = _pendingBits & (ulong)-(long)_pendingBits;
+                uint byteIndex = (uint)(((lowestBit >> 7) * 0x0001020304050607UL) >> 56);
+                _pendingBits &= _pendingBits - 1;
+
+                Current = _wordStart + byteIndex;
+                return true;
+            }
+        }
     }
 }
@@ -0,0 +1,371 @@
+//
+// Copyright (C) 2015 crosire & kagikn & contributors
+// License: https://github.com/scripthookvdotnet/scripthookvdotnet#license
+//
+
+using System;
+using System.Collections.Concurrent;
+using System.Diagnostics;
+using System.Globalization;
+using System.IO;
+using System.Text;
+using System.Threading;
+
+namespace SHVDN
+{
+    /// <summary>
+    /// Records a timeline of ticks, script slices and native calls, and writes it to a file in the Chrome trace event
+    /// format, which can be opened in <c>chrome://tracing</c> or Perfetto.
+    /// </summary>
+    /// <remarks>
+    /// Events are appended to a fixed-size chunk, and full chunks are handed over to a background thread that
+    /// formats and writes them, so recording costs a few stores per event on the game threads.
+    /// While the tracer is not recording, the only overhead on a native call is a read of a volatile field.
+    /// </remarks>
+    internal static unsafe class TimelineTracer
+    {
+        private const int ChunkCapacity = 4096;
+        private const int WriterCompletionTimeoutInMilliseconds = 5000;
+
+        internal const string CategoryTick = "tick";
+        internal const string CategoryScript = "script";
+        internal const string CategoryTask = "task";
+        internal const string CategoryNative = "native";
+
+        private static volatile bool s_isRecording;
+        private static long s_recordStartTimestamp;
+        private static long s_recordEndTimestamp;
+
+        // Only one script runs at a time, but a lock is still used to append events since scripts may call natives
+        // from other threads than their script thread. The lock is almost never contended.
+        private static readonly object s_chunkLock = new();
+        private static TraceChunk s_currentChunk;
+
+        private static TraceWriter s_writer;
+
+        // Tells the main domain whether to trace the ticks of the CLR thread, which are driven from there
+        private static delegate* unmanaged[Cdecl]<int, void> s_setClrThreadTickTracingEnabled;
+
+        private struct TraceEvent
+        {
+            internal string Name;
+            internal string Category;
+            internal ulong NativeHash;
+            internal long StartTimestamp;
+            internal long ElapsedTicks;
+            internal int ThreadId;
+        }
+
+        private sealed class TraceChunk
+        {
+            internal readonly TraceEvent[] Events = new TraceEvent[ChunkCapacity];
+            internal int Count;
+            internal bool IsLast;
+        }
+
+        /// <summary>
+        /// Gets whether the tracer is recording events.
+        /// </summary>
+        internal static bool IsRecording => s_isRecording;
+
+        internal static void Init(IntPtr setClrThreadTickTracingEnabledFunc)
+        {
+            s_setClrThreadTickTracingEnabled = (delegate* unmanaged[Cdecl]<int, void>)setClrThreadTickTracingEnabledFunc;
+        }
+
+        /// <summary>
+        /// Starts recording a timeline to the specified file.
+        /// This must be called in the main thread of the script domain.
+        /// </summary>
+        /// <param name="path">The path of the file to write to.</param>
+        /// <param name="durationInMilliseconds">How long to record for.</param>
+        internal static void Start(string path, int durationInMilliseconds)
+        {
+            if (s_isRecording)
+            {
+                throw new InvalidOperationException("A timeline is already being recorded.");
+            }
+
+            // Opens the file right away so the caller gets an exception for an invalid path
+            var writer = new TraceWriter(path);
+
+            // Build the dictionary of native names in this thread rather than in the writer thread
+            NativeProfiler.GetHashName(0);
+
+            s_writer = writer;
+            s_currentChunk = new TraceChunk();
+            s_recordStartTimestamp = Stopwatch.GetTimestamp();
+            s_recordEndTimestamp = s_recordStartTimestamp + durationInMilliseconds * Stopwatch.Frequency / 1000;
+            s_isRecording = true;
+
+            SetClrThreadTickTracingEnabled(true);
+        }
+
+        /// <summary>
+        /// Records an event that started at the specified timestamp and ends now.
+        /// </summary>
+        internal static void AddCompleteEvent(string name, string category, long startTimestamp)
+        {
+            Add(name, category, 0, startTimestamp, Stopwatch.GetTimestamp() - startTimestamp);
+        }
+        /// <summary>
+        /// Records an event with the specified start and end timestamps.
+        /// </summary>
+        internal static void AddCompleteEvent(string name, string category, long startTimestamp, long endTimestamp)
+        {
+            Add(name, category, 0, startTimestamp, endTimestamp - startTimestamp);
+        }
+        /// <summary>
+        /// Records a native call. The name is resolved in the writer thread.
+        /// </summary>
+        internal static void AddNativeCallEvent(ulong hash, long startTimestamp, long elapsedTicks)
+        {
+            Add(null, CategoryNative, hash, startTimestamp, elapsedTicks);
+        }
+
+        /// <summary>
+        /// Hands over the events recorded in this tick to the writer thread, and stops recording if the duration
+        /// passed to <see cref="Start(string, int)"/> has elapsed.
+        /// This must be called in the main thread of the script domain.
+        /// </summary>
+        internal static void OnTickEnd()
+        {
+            if (!s_isRecording)
+            {
+                return;
+            }
+
+            bool isFinished = Stopwatch.GetTimestamp() >= s_recordEndTimestamp;
+            if (isFinished)
+            {
+                s_isRecording = false;
+                SetClrThreadTickTracingEnabled(false);
+            }
+
+            TraceChunk chunk;
+            lock (s_chunkLock)
+            {
+                chunk = s_currentChunk;
+                s_currentChunk = isFinished ? null : new TraceChunk();
+            }
+
+            chunk.IsLast = isFinished;
+            s_writer.Enqueue(chunk);
+
+            if (isFinished)
+            {
+                Log.Message(Log.Level.Info, "Finished recording the timeline to \"", s_writer.Path, "\".");
+                s_writer = null;
+            }
+        }
+
+        /// <summary>
+        /// Stops recording before the duration passed to <see cref="Start(string, int)"/> has elapsed, and waits until
+        /// the writer thread has finished the file. Called when the script domain is disposed, since the writer thread
+        /// would otherwise be aborted by the unload of the domain and leave an unterminated file behind.
+        /// </summary>
+        internal static void Stop()
+        {
+            if (!s_isRecording)
+            {
+                return;
+            }
+
+            s_isRecording = false;
+            SetClrThreadTickTracingEnabled(false);
+
+            TraceChunk chunk;
+            TraceWriter writer;
+            lock (s_chunkLock)
+            {
+                chunk = s_currentChunk;
+                writer = s_writer;
+                s_currentChunk = null;
+                s_writer = null;
+            }
+
+            if (chunk == null || writer == null)
+            {
+                return;
+            }
+
+            chunk.IsLast = true;
+            writer.Enqueue(chunk);
+
+            if (writer.WaitForCompletion(WriterCompletionTimeoutInMilliseconds))
+            {
+                Log.Message(Log.Level.Info, "Stopped recording the timeline to \"", writer.Path, "\".");
+            }
+            else
+            {
+                Log.Message(Log.Level.Warning, "Timed out waiting for the timeline to be written to \"", writer.Path,
+                    "\". The file may be incomplete.");
+            }
+        }
+
+        private static void Add(string name, string category, ulong nativeHash, long startTimestamp,
+            long elapsedTicks)
+        {
+            lock (s_chunkLock)
+            {
+                TraceChunk chunk = s_currentChunk;
+                if (chunk == null)
+                {
+                    // Recording has just been stopped
+                    return;
+                }
+
+                if (chunk.Count == ChunkCapacity)
+                {
+                    s_writer.Enqueue(chunk);
+                    chunk = new TraceChunk();
+                    s_currentChunk = chunk;
+                }
+
+                ref TraceEvent e = ref chunk.Events[chunk.Count++];
+                e.Name = name;
+                e.Category = category;
+                e.NativeHash = nativeHash;
+                e.StartTimestamp = startTimestamp;
+                e.ElapsedTicks = elapsedTicks;
+                e.ThreadId = Environment.CurrentManagedThreadId;
+            }
+        }
+
+        private static void SetClrThreadTickTracingEnabled(bool enabled)
+        {
+            if (s_setClrThreadTickTracingEnabled != null)
+            {
+                s_setClrThreadTickTracingEnabled(enabled ? 1 : 0);
+            }
+        }
+
+        /// <summary>
+        /// Formats and writes chunks of events in a background thread.
+        /// </summary>
+        private sealed class TraceWriter
+        {
+            private readonly ConcurrentQueue<TraceChunk> _pendingChunks = new();
+            private readonly SemaphoreSlim _chunkAvailable = new(0);
+            private readonly StreamWriter _streamWriter;
+            private readonly Thread _thread;
+            private readonly long _originTimestamp;
+            private bool _hasWrittenEvent;
+
+            internal TraceWriter(string path)
+            {
+                Path = path;
+                _streamWriter = new StreamWriter(path, false, new UTF8Encoding(false));
+                _originTimestamp = Stopwatch.GetTimestamp();
+
+                _thread = new Thread(Run)
+                {
+                    Name = "SHVDN Timeline Writer",
+                    IsBackground = true,
+                    Priority = ThreadPriority.BelowNormal,
+                };
+                _thread.Start();
+            }
+
+            internal string Path { get; }
+
+            internal void Enqueue(TraceChunk chunk)
+            {
+                _pendingChunks.Enqueue(chunk);
+                _chunkAvailable.Release();
+            }
+
+            /// <summary>
+            /// Waits until the last chunk has been written and the file has been closed.
+            /// </summary>
+            internal bool WaitForCompletion(int timeoutInMilliseconds)
+            {
+                return _thread.Join(timeoutInMilliseconds);
+            }
+
+            private void Run()
+            {
+                try
+                {
+                    _streamWriter.Write("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+
+                    while (true)
+                    {
+                        _chunkAvailable.Wait();
+                        if (!_pendingChunks.TryDequeue(out TraceChunk chunk))
+                        {
+                            continue;
+                        }
+
+                        WriteChunk(chunk);
+                        if (chunk.IsLast)
+                        {
+                            break;
+                        }
+                    }
+
+                    _streamWriter.Write("]}");
+                }
+                catch (Exception ex)
+                {
+                    Log.Message(Log.Level.Error, "Failed to write the timeline: ", ex.ToString());
+                }
+                finally
+                {
+                    _streamWriter.Dispose();
+                    _chunkAvailable.Dispose();
+                }
+            }
+
+            private void WriteChunk(TraceChunk chunk)
+            {
+                var sb = new StringBuilder(chunk.Count * 100);
+                for (int i = 0; i < chunk.Count; i++)
+                {
+                    ref TraceEvent e = ref chunk.Events[i];
+                    string name = e.Name ?? NativeProfiler.GetHashName(e.NativeHash);
+
+                    sb.Append(_hasWrittenEvent ? ",\n" : "\n");
+                    sb.Append("{\"name\":\"");
+                    AppendEscaped(sb, name);
+                    sb.Append("\",\"cat\":\"").Append(e.Category);
+                    sb.Append("\",\"ph\":\"X\",\"pid\":1,\"tid\":").Append(e.ThreadId.ToString(CultureInfo.InvariantCulture));
+                    sb.Append(",\"ts\":").Append(ToMicroseconds(e.StartTimestamp - _originTimestamp).ToString("F3", CultureInfo.InvariantCulture));
+                    sb.Append(",\"dur\":").Append(ToMicroseconds(e.ElapsedTicks).ToString("F3", CultureInfo.InvariantCulture));
+                    sb.Append('}');
+                    _hasWrittenEvent = true;
+                }
+
+                _streamWriter.Write(sb.ToString());
+            }
+
+            private static double ToMicroseconds(long ticks) => ticks * 1000000.0 / Stopwatch.Frequency;
+
+            private static void AppendEscaped(StringBuilder sb, string value)
+            {
+                foreach (char c in value)
+                {
+                    switch (c)
+                    {
+                        case '"':
+                            sb.Append("\\\"");
+                            break;
+                        case '\\':
+                            sb.Append("\\\\");
+                            break;
+                        default:
+                            if (c < 0x20)
+                            {
+                                sb.Append("\\u").Append(((int)c).ToString("X4", CultureInfo.InvariantCulture));
+                            }
+                            else
+                            {
+                                sb.Append(c);
+                            }
+                            break;
+                    }
+                }
+            }
+        }
+    }
+}
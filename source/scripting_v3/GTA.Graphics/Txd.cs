@@ -133,6 +133,10 @@ namespace GTA.Graphics
         {
             return new InputArgument(value.Name);
         }
+        public static implicit operator NativeArgument(Txd value)
+        {
+            return value.Name;
+        }
         public static explicit operator Txd(string value)
         {
             return new Txd(value);
@@ -0,0 +1,1072 @@
+//
+// Copyright (C) 2015 crosire & kagikn & contributors
+// License: https://github.com/scripthookvdotnet/scripthookvdotnet#license
+//
+
+namespace GTA.Native
+{
+    public static partial class Function
+    {
+        #region Call with Return Value Overloads with `NativeArgument` Parameters
+        /// <summary>
+        /// Calls the specified native script function and returns its return value.
+        /// </summary>
+        /// <param name="hash">The hashed name of the script function.</param>
+        /// <param name="argument0">The input or output argument to pass to the native script function.</param>
+        /// <returns>The return value of the native.</returns>
+        public static T Call<T>(Hash hash, NativeArgument? argument0)
+        {
+            unsafe
+            {
+                const int ArgCount = 1;
+                ulong* argPtr = stackalloc ulong[ArgCount];
+
+                argPtr[0] = argument0.GetValueOrDefault()._data;
+
+                ulong* res = SHVDN.NativeFunc.Invoke((ulong)hash, argPtr, ArgCount);
+                return ReturnValueFromNativeIfNotNull<T>(res);
+            }
+        }
+        /// <summary>
+        /// Calls the specified native script function and returns its return value.
+        /// </summary>
+        /// <param name="hash">The hashed name of the script function.</param>
+        /// <param name="argument0">The 1st input or output argument to pass to the native script function.</param>
+        /// <param name="argument1">The 2nd input or output argument to pass to the native script function.</param>
+        /// <returns>The return value of the native.</returns>
+        public static T Call<T>(Hash hash, NativeArgument? argument0, NativeArgument? argument1)
+        {
+            unsafe
+            {
+                const int ArgCount = 2;
+                ulong* argPtr = stackalloc ulong[ArgCount];
+
+                argPtr[0] = argument0.GetValueOrDefault()._data;
+                argPtr[1] = argument1.GetValueOrDefault()._data;
+
+                ulong* res = SHVDN.NativeFunc.Invoke((ulong)hash, argPtr, ArgCount);
+                return ReturnValueFromNativeIfNotNull<T>(res);
+            }
+        }
+        /// <summary>
+        /// Calls the specified native script function and returns its return value.
+        /// </summary>
+        /// <param name="hash">The hashed name of the script function.</param>
+        /// <param name="argument0">The 1st input or output argument to pass to the native script function.</param>
+        /// <param name="argument1">The 2nd input or output argument to pass to the native script function.</param>
+        /// <param name="argument2">The 3rd input or output argument to pass to the native script function.</param>
+        /// <returns>The return value of the native.</returns>
+        public static T Call<T>(Hash hash, NativeArgument? argument0, NativeArgument? argument1, NativeArgument? argument2)
+        {
+            unsafe
+            {
+                const int ArgCount = 3;
+                ulong* argPtr = stackalloc ulong[ArgCount];
+
+                argPtr[0] = argument0.GetValueOrDefault()._data;
+                argPtr[1] = argument1.GetValueOrDefault()._data;
+                argPtr[2] = argument2.GetValueOrDefault()._data;
+
+                ulong* res = SHVDN.NativeFunc.Invoke((ulong)hash, argPtr, ArgCount);
+                return ReturnValueFromNativeIfNotNull<T>(res);
+            }
+        }
+        /// <summary>
+        /// Calls the specified native script function and returns its return value.
+        /// </summary>
+        /// <param name="hash">The hashed name of the script function.</param>
+        /// <param name="argument0">The 1st input or output argument to pass to the native script function.</param>
+        /// <param name="argument1">The 2nd input or output argument to pass to the native script function.</param>
+        /// <param name="argument2">The 3rd input or output argument to pass to the native script function.</param>
+        /// <param name="argument3">The 4th input or output argument to pass to the native script function.</param>
+        /// <returns>The return value of the native.</returns>
+        public static T Call<T>(Hash hash, NativeArgument? argument0, NativeArgument? argument1, NativeArgument? argument2, NativeArgument? argument3)
+        {
+            unsafe
+            {
+                const int ArgCount = 4;
+                ulong* argPtr = stackalloc ulong[ArgCount];
+
+                argPtr[0] = argument0.GetValueOrDefault()._data;
+                argPtr[1] = argument1.GetValueOrDefault()._data;
+                argPtr[2] = argument2.GetValueOrDefault()._data;
+                argPtr[3] = argument3.GetValueOrDefault()._data;
+
+                ulong* res = SHVDN.NativeFunc.Invoke((ulong)hash, argPtr, ArgCount);
+                return ReturnValueFromNativeIfNotNull<T>(res);
+            }
+        }
+        /// <summary>
+        /// Calls the specified native script function and returns its return value.
+        /// </summary>
+        /// <param name="hash">The hashed name of the script function.</param>
+        /// <param name="argument0">The 1st input or output argument to pass to the native script function.</param>
+        /// <param name="argument1">The 2nd input or output argument to pass to the native script function.</param>
+        /// <param name="argument2">The 3rd input or output argument to pass to the native script function.</param>
+        /// <param name="argument3">The 4th input or output argument to pass to the native script function.</param>
+        /// <param name="argument4">The 5th input or output argument to pass to the native script function.</param>
+        /// <returns>The return value of the native.</returns>
+        public static T Call<T>(Hash hash, NativeArgument? argument0, NativeArgument? argument1, NativeArgument? argument2, NativeArgument? argument3, NativeArgument? argument4)
+        {
+            unsafe
+            {
+                const int ArgCount = 5;
+                ulong* argPtr = stackalloc ulong[ArgCount];
+
+                argPtr[0] = argument0.GetValueOrDefault()._data;
+                argPtr[1] = argument1.GetValueOrDefault()._data;
+                argPtr[2] = argument2.GetValueOrDefault()._data;
+                argPtr[3] = argument3.GetValueOrDefault()._data;
+                argPtr[4] = argument4.GetValueOrDefault()._data;
+
+                ulong* res = SHVDN.NativeFunc.Invoke((ulong)hash, argPtr, ArgCount);
+                return ReturnValueFromNativeIfNotNull<T>(res);
+            }
+        }
+        /// <summary>
+        /// Calls the specified native script function and returns its return value.
+        /// </summary>
+        /// <param name="hash">The hashed name of the script function.</param>
+        /// <param name="argument0">The 1st input or output argument to pass to the native script function.</param>
+        /// <param name="argument1">The 2nd input or output argument to pass to the native script function.</param>
+        /// <param name="argument2">The 3rd input or output argument to pass to the native script function.</param>
+        /// <param name="argument3">The 4th input or output argument to pass to the native script function.</param>
+        /// <param name="argument4">The 5th input or output argument to pass to the native script function.</param>
+        /// <param name="argument5">The 6th input or output argument to pass to the native script function.</param>
+        /// <returns>The return value of the native.</returns>
+        public static T Call<T>(Hash hash, NativeArgument? argument0, NativeArgument? argument1, NativeArgument? argument2, NativeArgument? argument3, NativeArgument? argument4, NativeArgument? argument5)
+        {
+            unsafe
+            {
+                const int ArgCount = 6;
+                ulong* argPtr = stackalloc ulong[ArgCount];
+
+                argPtr[0] = argument0.GetValueOrDefault()._data;
+                argPtr[1] = argument1.GetValueOrDefault()._data;
+                argPtr[2] = argument2.GetValueOrDefault()._data;
+                argPtr[3] = argument3.GetValueOrDefault()._data;
+                argPtr[4] = argument4.GetValueOrDefault()._data;
+                argPtr[5] = argument5.GetValueOrDefault()._data;
+
+                ulong* res = SHVDN.NativeFunc.Invoke((ulong)hash, argPtr, ArgCount);
+                return ReturnValueFromNativeIfNotNull<T>(res);
+            }
+        }
+        /// <summary>
+        /// Calls the specified native script function and returns its return value.
+        /// </summary>
+        /// <param name="hash">The hashed name of the script function.</param>
+        /// <param name="argument0">The 1st input or output argument to pass to the native script function.</param>
+        /// <param name="argument1">The 2nd input or output argument to pass to the native script function.</param>
+        /// <param name="argument2">The 3rd input or output argument to pass to the native script function.</param>
+        /// <param name="argument3">The 4th input or output argument to pass to the native script function.</param>
+        /// <param name="argument4">The 5th input or output argument to pass to the native script function.</param>
+        /// <param name="argument5">The 6th input or output argument to pass to the native script function.</param>
+        /// <param name="argument6">The 7th input or output argument to pass to the native script function.</param>
+        /// <returns>The return value of the native.</returns>
+        public static T Call<T>(Hash hash, NativeArgument? argument0, NativeArgument? argument1, NativeArgument? argument2, NativeArgument? argument3, NativeArgument? argument4, NativeArgument? argument5, NativeArgument? argument6)
+        {
+            unsafe
+            {
+                const int ArgCount = 7;
+                ulong* argPtr = stackalloc ulong[ArgCount];
+
+                argPtr[0] = argument0.GetValueOrDefault()._data;
+                argPtr[1] = argument1.GetValueOrDefault()._data;
+                argPtr[2] = argument2.GetValueOrDefault()._data;
+                argPtr[3] = argument3.GetValueOrDefault()._data;
+                argPtr[4] = argument4.GetValueOrDefault()._data;
+                argPtr[5] = argument5.GetValueOrDefault()._data;
+                argPtr[6] = argument6.GetValueOrDefault()._data;
+
+                ulong* res = SHVDN.NativeFunc.Invoke((ulong)hash, argPtr, ArgCount);
+                return ReturnValueFromNativeIfNotNull<T>(res);
+            }
+        }
+        /// <summary>
+        /// Calls the specified native script function and returns its return value.
+        /// </summary>
+        /// <param name="hash">The hashed name of the script function.</param>
+        /// <param name="argument0">The 1st input or output argument to pass to the native script function.</param>
+        /// <param name="argument1">The 2nd input or output argument to pass to the native script function.</param>
+        /// <param name="argument2">The 3rd input or output argument to pass to the native script function.</param>
+        /// <param name="argument3">The 4th input or output argument to pass to the native script function.</param>
+        /// <param name="argument4">The 5th input or output argument to pass to the native script function.</param>
+        /// <param name="argument5">The 6th input or output argument to pass to the native script function.</param>
+        /// <param name="argument6">The 7th input or output argument to pass to the native script function.</param>
+        /// <param name="argument7">The 8th input or output argument to pass to the native script function.</param>
+        /// <returns>The return value of the native.</returns>
+        public static T Call<T>(Hash hash, NativeArgument? argument0, NativeArgument? argument1, NativeArgument? argument2, NativeArgument? argument3, NativeArgument? argument4, NativeArgument? argument5, NativeArgument? argument6, NativeArgument? argument7)
+        {
+            unsafe
+            {
+                const int ArgCount = 8;
+                ulong* argPtr = stackalloc ulong[ArgCount];
+
+                argPtr[0] = argument0.GetValueOrDefault()._data;
+                argPtr[1] = argument1.GetValueOrDefault()._data;
+                argPtr[2] = argument2.GetValueOrDefault()._data;
+                argPtr[3] = argument3.GetValueOrDefault()._data;
+                argPtr[4] = argument4.GetValueOrDefault()._data;
+                argPtr[5] = argument5.GetValueOrDefault()._data;
+                argPtr[6] = argument6.GetValueOrDefault()._data;
+                argPtr[7] = argument7.GetValueOrDefault()._data;
+
+                ulong* res = SHVDN.NativeFunc.Invoke((ulong)hash, argPtr, ArgCount);
+                return ReturnValueFromNativeIfNotNull<T>(res);
+            }
+        }
+        /// <summary>
+        /// Calls the specified native script function and returns its return value.
+        /// </summary>
+        /// <param name="hash">The hashed name of the script function.</param>
+        /// <param name="argument0">The 1st input or output argument to pass to the native script function.</param>
+        /// <param name="argument1">The 2nd input or output argument to pass to the native script function.</param>
+        /// <param name="argument2">The 3rd input or output argument to pass to the native script function.</param>
+        /// <param name="argument3">The 4th input or output argument to pass to the native script function.</param>
+        /// <param name="argument4">The 5th input or output argument to pass to the native script function.</param>
+        /// <param name="argument5">The 6th input or output argument to pass to the native script function.</param>
+        /// <param name="argument6">The 7th input or output argument to pass to the native script function.</param>
+        /// <param name="argument7">The 8th input or output argument to pass to the native script function.</param>
+        /// <param name="argument8">The 9th input or output argument to pass to the native script function.</param>
+        /// <returns>The return value of the native.</returns>
+        public static T Call<T>(Hash hash, NativeArgument? argument0, NativeArgument? argument1, NativeArgument? argument2, NativeArgument? argument3, NativeArgument? argument4, NativeArgument? argument5, NativeArgument? argument6, NativeArgument? argument7, NativeArgument? argument8)
+        {
+            unsafe
+            {
+                const int ArgCount = 9;
+                ulong* argPtr = stackalloc ulong[ArgCount];
+
+                argPtr[0] = argument0.GetValueOrDefault()._data;
+                argPtr[1] = argument1.GetValueOrDefault()._data;
+                argPtr[2] = argument2.GetValueOrDefault()._data;
+                argPtr[3] = argument3.GetValueOrDefault()._data;
+                argPtr[4] = argument4.GetValueOrDefault()._data;
+                argPtr[5] = argument5.GetValueOrDefault()._data;
+                argPtr[6] = argument6.GetValueOrDefault()._data;
+                argPtr[7] = argument7.GetValueOrDefault()._data;
+                argPtr[8] = argument8.GetValueOrDefault()._data;
+
+                ulong* res = SHVDN.NativeFunc.Invoke((ulong)hash, argPtr, ArgCount);
+                return ReturnValueFromNativeIfNotNull<T>(res);
+            }
+        }
+        /// <summary>
+        /// Calls the specified native script function and returns its return value.
+        /// </summary>
+        /// <param name="hash">The hashed name of the script function.</param>
+        /// <param name="argument0">The 1st input or output argument to pass to the native script function.</param>
+        /// <param name="argument1">The 2nd input or output argument to pass to the native script function.</param>
+        /// <param name="argument2">The 3rd input or output argument to pass to the native script function.</param>
+        /// <param name="argument3">The 4th input or output argument to pass to the native script function.</param>
+        /// <param name="argument4">The 5th input or output argument to pass to the native script function.</param>
+        /// <param name="argument5">The 6th input or output argument to pass to the native script function.</param>
+        /// <param name="argument6">The 7th input or output argument to pass to the native script function.</param>
+        /// <param name="argument7">The 8th input or output argument to pass to the native script function.</param>
+        /// <param name="argument8">The 9th input or output argument to pass to the native script function.</param>
+        /// <param name="argument9">The 10th input or output argument to pass to the native script function.</param>
+        /// <returns>The return value of the native.</returns>
+        public static T Call<T>(Hash hash, NativeArgument? argument0, NativeArgument? argument1, NativeArgument? argument2, NativeArgument? argument3, NativeArgument? argument4, NativeArgument? argument5, NativeArgument? argument6, NativeArgument? argument7, NativeArgument? argument8, NativeArgument? argument9)
+        {
+            unsafe
+            {
+                const int ArgCount = 10;
+                ulong* argPtr = stackalloc ulong[ArgCount];
+
+                argPtr[0] = argument0.GetValueOrDefault()._data;
+                argPtr[1] = argument1.GetValueOrDefault()._data;
+                argPtr[2] = argument2.GetValueOrDefault()._data;
+                argPtr[3] = argument3.GetValueOrDefault()._data;
+                argPtr[4] = argument4.GetValueOrDefault()._data;
+                argPtr[5] = argument5.GetValueOrDefault()._data;
+                argPtr[6] = argument6.GetValueOrDefault()._data;
+                argPtr[7] = argument7.GetValueOrDefault()._data;
+                argPtr[8] = argument8.GetValueOrDefault()._data;
+                argPtr[9] = argument9.GetValueOrDefault()._data;
+
+                ulong* res = SHVDN.NativeFunc.Invoke((ulong)hash, argPtr, ArgCount);
+                return ReturnValueFromNativeIfNotNull<T>(res);
+            }
+        }
+        /// <summary>
+        /// Calls the specified native script function and returns its return value.
+        /// </summary>
+        /// <param name="hash">The hashed name of the script function.</param>
+        /// <param name="argument0">The 1st input or output argument to pass to the native script function.</param>
+        /// <param name="argument1">The 2nd input or output argument to pass to the native script function.</param>
+        /// <param name="argument2">The 3rd input or output argument to pass to the native script function.</param>
+        /// <param name="argument3">The 4th input or output argument to pass to the native script function.</param>
+        /// <param name="argument4">The 5th input or output argument to pass to the native script function.</param>
+        /// <param name="argument5">The 6th input or output argument to pass to the native script function.</param>
+        /// <param name="argument6">The 7th input or output argument to pass to the native script function.</param>
+        /// <param name="argument7">The 8th input or output argument to pass to the native script function.</param>
+        /// <param name="argument8">The 9th input or output argument to pass to the native script function.</param>
+        /// <param name="argument9">The 10th input or output argument to pass to the native script function.</param>
+        /// <param name="argument10">The 11th input or output argument to pass to the native script function.</param>
+        /// <returns>The return value of the native.</returns>
+        public static T Call<T>(Hash hash, NativeArgument? argument0, NativeArgument? argument1, NativeArgument? argument2, NativeArgument? argument3, NativeArgument? argument4, NativeArgument? argument5, NativeArgument? argument6, NativeArgument? argument7, NativeArgument? argument8, NativeArgument? argument9, NativeArgument? argument10)
+        {
+            unsafe
+            {
+                const int ArgCount = 11;
+                ulong* argPtr = stackalloc ulong[ArgCount];
+
+                argPtr[0] = argument0.GetValueOrDefault()._data;
+                argPtr[1] = argument1.GetValueOrDefault()._data;
+                argPtr[2] = argument2.GetValueOrDefault()._data;
+                argPtr[3] = argument3.GetValueOrDefault()._data;
+                argPtr[4] = argument4.GetValueOrDefault()._data;
+                argPtr[5] = argument5.GetValueOrDefault()._data;
+                argPtr[6] = argument6.GetValueOrDefault()._data;
+                argPtr[7] = argument7.GetValueOrDefault()._data;
+                argPtr[8] = argument8.GetValueOrDefault()._data;
+                argPtr[9] = argument9.GetValueOrDefault()._data;
+                argPtr[10] = argument10.GetValueOrDefault()._data;
+
+                ulong* res = SHVDN.NativeFunc.Invoke((ulong)hash, argPtr, ArgCount);
+                return ReturnValueFromNativeIfNotNull<T>(res);
+            }
+        }
+        /// <summary>
+        /// Calls the specified native script function and returns its return value.
+        /// </summary>
+        /// <param name="hash">The hashed name of the script function.</param>
+        /// <param name="argument0">The 1st input or output argument to pass to the native script function.</param>
+        /// <param name="argument1">The 2nd input or output argument to pass to the native script function.</param>
+        /// <param name="argument2">The 3rd input or output argument to pass to the native script function.</param>
+        /// <param name="argument3">The 4th input or output argument to pass to the native script function.</param>
+        /// <param name="argument4">The 5th input or output argument to pass to the native script function.</param>
+        /// <param name="argument5">The 6th input or output argument to pass to the native script function.</param>
+        /// <param name="argument6">The 7th input or output argument to pass to the native script function.</param>
+        /// <param name="argument7">The 8th input or output argument to pass to the native script function.</param>
+        /// <param name="argument8">The 9th input or output argument to pass to the native script function.</param>
+        /// <param name="argument9">The 10th input or output argument to pass to the native script function.</param>
+        /// <param name="argument10">The 11th input or output argument to pass to the native script function.</param>
+        /// <param name="argument11">The 12th input or output argument to pass to the native script function.</param>
+        /// <returns>The return value of the native.</returns>
+        public static T Call<T>(Hash hash, NativeArgument? argument0, NativeArgument? argument1, NativeArgument? argument2, NativeArgument? argument3, NativeArgument? argument4, NativeArgument? argument5, NativeArgument? argument6, NativeArgument? argument7, NativeArgument? argument8, NativeArgument? argument9, NativeArgument? argument10, NativeArgument? argument11)
+        {
+            unsafe
+            {
+                const int ArgCount = 12;
+                ulong* argPtr = stackalloc ulong[ArgCount];
+
+                argPtr[0] = argument0.GetValueOrDefault()._data;
+                argPtr[1] = argument1.GetValueOrDefault()._data;
+                argPtr[2] = argument2.GetValueOrDefault()._data;
+                argPtr[3] = argument3.GetValueOrDefault()._data;
+                argPtr[4] = argument4.GetValueOrDefault()._data;
+                argPtr[5] = argument5.GetValueOrDefault()._data;
+                argPtr[6] = argument6.GetValueOrDefault()._data;
+                argPtr[7] = argument7.GetValueOrDefault()._data;
+                argPtr[8] = argument8.GetValueOrDefault()._data;
+                argPtr[9] = argument9.GetValueOrDefault()._data;
+                argPtr[10] = argument10.GetValueOrDefault()._data;
+                argPtr[11] = argument11.GetValueOrDefault()._data;
+
+                ulong* res = SHVDN.NativeFunc.Invoke((ulong)hash, argPtr, ArgCount);
+                return ReturnValueFromNativeIfNotNull<T>(res);
+            }
+        }
+        /// <summary>
+        /// Calls the specified native script function and returns its return value.
+        /// </summary>
+        /// <param name="hash">The hashed name of the script function.</param>
+        /// <param name="argument0">The 1st input or output argument to pass to the native script function.</param>
+        /// <param name="argument1">The 2nd input or output argument to pass to the native script function.</param>
+        /// <param name="argument2">The 3rd input or output argument to pass to the native script function.</param>
+        /// <param name="argument3">The 4th input or output argument to pass to the native script function.</param>
+        /// <param name="argument4">The 5th input or output argument to pass to the native script function.</param>
+        /// <param name="argument5">The 6th input or output argument to pass to the native script function.</param>
+        /// <param name="argument6">The 7th input or output argument to pass to the native script function.</param>
+        /// <param name="argument7">The 8th input or output argument to pass to the native script function.</param>
+        /// <param name="argument8">The 9th input or output argument to pass to the native script function.</param>
+        /// <param name="argument9">The 10th input or output argument to pass to the native script function.</param>
+        /// <param name="argument10">The 11th input or output argument to pass to the native script function.</param>
+        /// <param name="argument11">The 12th input or output argument to pass to the native script function.</param>
+        /// <param name="argument12">The 13th input or output argument to pass to the native script function.</param>
+        /// <returns>The return value of the native.</returns>
+        public static T Call<T>(Hash hash, NativeArgument? argument0, NativeArgument? argument1, NativeArgument? argument2, NativeArgument? argument3, NativeArgument? argument4, NativeArgument? argument5, NativeArgument? argument6, NativeArgument? argument7, NativeArgument? argument8, NativeArgument? argument9, NativeArgument? argument10, NativeArgument? argument11, NativeArgument? argument12)
+        {
+            unsafe
+            {
+                const int ArgCount = 13;
+                ulong* argPtr = stackalloc ulong[ArgCount];
+
+                argPtr[0] = argument0.GetValueOrDefault()._data;
+                argPtr[1] = argument1.GetValueOrDefault()._data;
+                argPtr[2] = argument2.GetValueOrDefault()._data;
+                argPtr[3] = argument3.GetValueOrDefault()._data;
+                argPtr[4] = argument4.GetValueOrDefault()._data;
+                argPtr[5] = argument5.GetValueOrDefault()._data;
+                argPtr[6] = argument6.GetValueOrDefault()._data;
+                argPtr[7] = argument7.GetValueOrDefault()._data;
+                argPtr[8] = argument8.GetValueOrDefault()._data;
+                argPtr[9] = argument9.GetValueOrDefault()._data;
+                argPtr[10] = argument10.GetValueOrDefault()._data;
+                argPtr[11] = argument11.GetValueOrDefault()._data;
+                argPtr[12] = argument12.GetValueOrDefault()._data;
+
+                ulong* res = SHVDN.NativeFunc.Invoke((ulong)hash, argPtr, ArgCount);
+                return ReturnValueFromNativeIfNotNull<T>(res);
+            }
+        }
+        /// <summary>
+        /// Calls the specified native script function and returns its return value.
+        /// </summary>
+        /// <param name="hash">The hashed name of the script function.</param>
+        /// <param name="argument0">The 1st input or output argument to pass to the native script function.</param>
+        /// <param name="argument1">The 2nd input or output argument to pass to the native script function.</param>
+        /// <param name="argument2">The 3rd input or output argument to pass to the native script function.</param>
+        /// <param name="argument3">The 4th input or output argument to pass to the native script function.</param>
+        /// <param name="argument4">The 5th input or output argument to pass to the native script function.</param>
+        /// <param name="argument5">The 6th input or output argument to pass to the native script function.</param>
+        /// <param name="argument6">The 7th input or output argument to pass to the native script function.</param>
+        /// <param name="argument7">The 8th input or output argument to pass to the native script function.</param>
+        /// <param name="argument8">The 9th input or output argument to pass to the native script function.</param>
+        /// <param name="argument9">The 10th input or output argument to pass to the native script function.</param>
+        /// <param name="argument10">The 11th input or output argument to pass to the native script function.</param>
+        /// <param name="argument11">The 12th input or output argument to pass to the native script function.</param>
+        /// <param name="argument12">The 13th input or output argument to pass to the native script function.</param>
+        /// <param name="argument13">The 14th input or output argument to pass to the native script function.</param>
+        /// <returns>The return value of the native.</returns>
+        public static T Call<T>(Hash hash, NativeArgument? argument0, NativeArgument? argument1, NativeArgument? argument2, NativeArgument? argument3, NativeArgument? argument4, NativeArgument? argument5, NativeArgument? argument6, NativeArgument? argument7, NativeArgument? argument8, NativeArgument? argument9, NativeArgument? argument10, NativeArgument? argument11, NativeArgument? argument12, NativeArgument? argument13)
+        {
+            unsafe
+            {
+                const int ArgCount = 14;
+                ulong* argPtr = stackalloc ulong[ArgCount];
+
+                argPtr[0] = argument0.GetValueOrDefault()._data;
+                argPtr[1] = argument1.GetValueOrDefault()._data;
+                argPtr[2] = argument2.GetValueOrDefault()._data;
+                argPtr[3] = argument3.GetValueOrDefault()._data;
+                argPtr[4] = argument4.GetValueOrDefault()._data;
+                argPtr[5] = argument5.GetValueOrDefault()._data;
+                argPtr[6] = argument6.GetValueOrDefault()._data;
+                argPtr[7] = argument7.GetValueOrDefault()._data;
+                argPtr[8] = argument8.GetValueOrDefault()._data;
+                argPtr[9] = argument9.GetValueOrDefault()._data;
+                argPtr[10] = argument10.GetValueOrDefault()._data;
+                argPtr[11] = argument11.GetValueOrDefault()._data;
+                argPtr[12] = argument12.GetValueOrDefault()._data;
+                argPtr[13] = argument13.GetValueOrDefault()._data;
+
+                ulong* res = SHVDN.NativeFunc.Invoke((ulong)hash, argPtr, ArgCount);
+                return ReturnValueFromNativeIfNotNull<T>(res);
+            }
+        }
+        /// <summary>
+        /// Calls the specified native script function and returns its return value.
+        /// </summary>
+        /// <param name="hash">The hashed name of the script function.</param>
+        /// <param name="argument0">The 1st input or output argument to pass to the native script function.</param>
+        /// <param name="argument1">The 2nd input or output argument to pass to the native script function.</param>
+        /// <param name="argument2">The 3rd input or output argument to pass to the native script function.</param>
+        /// <param name="argument3">The 4th input or output argument to pass to the native script function.</param>
+        /// <param name="argument4">The 5th input or output argument to pass to the native script function.</param>
+        /// <param name="argument5">The 6th input or output argument to pass to the native script function.</param>
+        /// <param name="argument6">The 7th input or output argument to pass to the native script function.</param>
+        /// <param name="argument7">The 8th input or output argument to pass to the native script function.</param>
+        /// <param name="argument8">The 9th input or output argument to pass to the native script function.</param>
+        /// <param name="argument9">The 10th input or output argument to pass to the native script function.</param>
+        /// <param name="argument10">The 11th input or output argument to pass to the native script function.</param>
+        /// <param name="argument11">The 12th input or output argument to pass to the native script function.</param>
+        /// <param name="argument12">The 13th input or output argument to pass to the native script function.</param>
+        /// <param name="argument13">The 14th input or output argument to pass to the native script function.</param>
+        /// <param name="argument14">The 15th input or output argument to pass to the native script function.</param>
+        /// <returns>The return value of the native.</returns>
+        public static T Call<T>(Hash hash, NativeArgument? argument0, NativeArgument? argument1, NativeArgument? argument2, NativeArgument? argument3, NativeArgument? argument4, NativeArgument? argument5, NativeArgument? argument6, NativeArgument? argument7, NativeArgument? argument8, NativeArgument? argument9, NativeArgument? argument10, NativeArgument? argument11, NativeArgument? argument12, NativeArgument? argument13, NativeArgument? argument14)
+        {
+            unsafe
+            {
+                const int ArgCount = 15;
+                ulong* argPtr = stackalloc ulong[ArgCount];
+
+                argPtr[0] = argument0.GetValueOrDefault()._data;
+                argPtr[1] = argument1.GetValueOrDefault()._data;
+                argPtr[2] = argument2.GetValueOrDefault()._data;
+                argPtr[3] = argument3.GetValueOrDefault()._data;
+                argPtr[4] = argument4.GetValueOrDefault()._data;
+                argPtr[5] = argument5.GetValueOrDefault()._data;
+                argPtr[6] = argument6.GetValueOrDefault()._data;
+                argPtr[7] = argument7.GetValueOrDefault()._data;
+                argPtr[8] = argument8.GetValueOrDefault()._data;
+                argPtr[9] = argument9.GetValueOrDefault()._data;
+                argPtr[10] = argument10.GetValueOrDefault()._data;
+                argPtr[11] = argument11.GetValueOrDefault()._data;
+                argPtr[12] = argument12.GetValueOrDefault()._data;
+                argPtr[13] = argument13.GetValueOrDefault()._data;
+                argPtr[14] = argument14.GetValueOrDefault()._data;
+
+                ulong* res = SHVDN.NativeFunc.Invoke((ulong)hash, argPtr, ArgCount);
+                return ReturnValueFromNativeIfNotNull<T>(res);
+            }
+        }
+        /// <summary>
+        /// Calls the specified native script function and returns its return value.
+        /// </summary>
+        /// <param name="hash">The hashed name of the script function.</param>
+        /// <param name="argument0">The 1st input or output argument to pass to the native script function.</param>
+        /// <param name="argument1">The 2nd input or output argument to pass to the native script function.</param>
+        /// <param name="argument2">The 3rd input or output argument to pass to the native script function.</param>
+        /// <param name="argument3">The 4th input or output argument to pass to the native script function.</param>
+        /// <param name="argument4">The 5th input or output argument to pass to the native script function.</param>
+        /// <param name="argument5">The 6th input or output argument to pass to the native script function.</param>
+        /// <param name="argument6">The 7th input or output argument to pass to the native script function.</param>
+        /// <param name="argument7">The 8th input or output argument to pass to the native script function.</param>
+        /// <param name="argument8">The 9th input or output argument to pass to the native script function.</param>
+        /// <param name="argument9">The 10th input or output argument to pass to the native script function.</param>
+        /// <param name="argument10">The 11th input or output argument to pass to the native script function.</param>
+        /// <param name="argument11">The 12th input or output argument to pass to the native script function.</param>
+        /// <param name="argument12">The 13th input or output argument to pass to the native script function.</param>
+        /// <param name="argument13">The 14th input or output argument to pass to the native script function.</param>
+        /// <param name="argument14">The 15th input or output argument to pass to the native script function.</param>
+        /// <param name="argument15">The 16th input or output argument to pass to the native script function.</param>
+        /// <returns>The return value of the native.</returns>
+        public static T Call<T>(Hash hash, NativeArgument? argument0, NativeArgument? argument1, NativeArgument? argument2, NativeArgument? argument3, NativeArgument? argument4, NativeArgument? argument5, NativeArgument? argument6, NativeArgument? argument7, NativeArgument? argument8, NativeArgument? argument9, NativeArgument? argument10, NativeArgument? argument11, NativeArgument? argument12, NativeArgument? argument13, NativeArgument? argument14, NativeArgument? argument15)
+        {
+            unsafe
+            {
+                const int ArgCount = 16;
+                ulong* argPtr = stackalloc ulong[ArgCount];
+
+                argPtr[0] = argument0.GetValueOrDefault()._data;
+                argPtr[1] = argument1.GetValueOrDefault()._data;
+                argPtr[2] = argument2.GetValueOrDefault()._data;
+                argPtr[3] = argument3.GetValueOrDefault()._data;
+                argPtr[4] = argument4.GetValueOrDefault()._data;
+                argPtr[5] = argument5.GetValueOrDefault()._data;
+                argPtr[6] = argument6.GetValueOrDefault()._data;
+                argPtr[7] = argument7.GetValueOrDefault()._data;
+                argPtr[8] = argument8.GetValueOrDefault()._data;
+                argPtr[9] = argument9.GetValueOrDefault()._data;
+                argPtr[10] = argument10.GetValueOrDefault()._data;
+                argPtr[11] = argument11.GetValueOrDefault()._data;
+                argPtr[12] = argument12.GetValueOrDefault()._data;
+                argPtr[13] = argument13.GetValueOrDefault()._data;
+                argPtr[14] = argument14.GetValueOrDefault()._data;
+                argPtr[15] = argument15.GetValueOrDefault()._data;
+
+                ulong* res = SHVDN.NativeFunc.Invoke((ulong)hash, argPtr, ArgCount);
+                return ReturnValueFromNativeIfNotNull<T>(res);
+            }
+        }
+        #endregion
+
+        #region void `Call` Overloads with `NativeArgument` Parameters
+        /// <summary>
+        /// Calls the specified native script function and ignores its return value.
+        /// </summary>
+        /// <param name="hash">The hashed name of the script function.</param>
+        /// <param name="argument0">The input or output argument to pass to the native script function.</param>
+        public static void Call(Hash hash, NativeArgument? argument0)
+        {
+            unsafe
+            {
+                const int ArgCount = 1;
+                ulong* argPtr = stackalloc ulong[ArgCount];
+
+                argPtr[0] = argument0.GetValueOrDefault()._data;
+
+                SHVDN.NativeFunc.Invoke((ulong)hash, argPtr, ArgCount);
+            }
+        }
+        /// <summary>
+        /// Calls the specified native script function and ignores its return value.
+        /// </summary>
+        /// <param name="hash">The hashed name of the script function.</param>
+        /// <param name="argument0">The 1st input or output argument to pass to the native script function.</param>
+        /// <param name="argument1">The 2nd input or output argument to pass to the native script function.</param>
+        public static void Call(Hash hash, NativeArgument? argument0, NativeArgument? argument1)
+        {
+            unsafe
+            {
+                const int ArgCount = 2;
+                ulong* argPtr = stackalloc ulong[ArgCount];
+
+                argPtr[0] = argument0.GetValueOrDefault()._data;
+                argPtr[1] = argument1.GetValueOrDefault()._data;
+
+                SHVDN.NativeFunc.Invoke((ulong)hash, argPtr, ArgCount);
+            }
+        }
+        /// <summary>
+        /// Calls the specified native script function and ignores its return value.
+        /// </summary>
+        /// <param name="hash">The hashed name of the script function.</param>
+        /// <param name="argument0">The 1st input or output argument to pass to the native script function.</param>
+        /// <param name="argument1">The 2nd input or output argument to pass to the native script function.</param>
+        /// <param name="argument2">The 3rd input or output argument to pass to the native script function.</param>
+        public static void Call(Hash hash, NativeArgument? argument0, NativeArgument? argument1, NativeArgument? argument2)
+        {
+            unsafe
+            {
+                const int ArgCount = 3;
+                ulong* argPtr = stackalloc ulong[ArgCount];
+
+                argPtr[0] = argument0.GetValueOrDefault()._data;
+                argPtr[1] = argument1.GetValueOrDefault()._data;
+                argPtr[2] = argument2.GetValueOrDefault()._data;
+
+                SHVDN.NativeFunc.Invoke((ulong)hash, argPtr, ArgCount);
+            }
+        }
+        /// <summary>
+        /// Calls the specified native script function and ignores its return value.
+        /// </summary>
+        /// <param name="hash">The hashed name of the script function.</param>
+        /// <param name="argument0">The 1st input or output argument to pass to the native script function.</param>
+        /// <param name="argument1">The 2nd input or output argument to pass to the native script function.</param>
+        /// <param name="argument2">The 3rd input or output argument to pass to the native script function.</param>
+        /// <param name="argument3">The 4th input or output argument to pass to the native script function.</param>
+        public static void Call(Hash hash, NativeArgument? argument0, NativeArgument? argument1, NativeArgument? argument2, NativeArgument? argument3)
+        {
+            unsafe
+            {
+                const int ArgCount = 4;
+                ulong* argPtr = stackalloc ulong[ArgCount];
+
+                argPtr[0] = argument0.GetValueOrDefault()._data;
+                argPtr[1] = argument1.GetValueOrDefault()._data;
+                argPtr[2] = argument2.GetValueOrDefault()._data;
+                argPtr[3] = argument3.GetValueOrDefault()._data;
+
+                SHVDN.NativeFunc.Invoke((ulong)hash, argPtr, ArgCount);
+            }
+        }
+        /// <summary>
+        /// Calls the specified native script function and ignores its return value.
+        /// </summary>
+        /// <param name="hash">The hashed name of the script function.</param>
+        /// <param name="argument0">The 1st input or output argument to pass to the native script function.</param>
+        /// <param name="argument1">The 2nd input or output argument to pass to the native script function.</param>
+        /// <param name="argument2">The 3rd input or output argument to pass to the native script function.</param>
+        /// <param name="argument3">The 4th input or output argument to pass to the native script function.</param>
+        /// <param name="argument4">The 5th input or output argument to pass to the native script function.</param>
+        public static void Call(Hash hash, NativeArgument? argument0, NativeArgument? argument1, NativeArgument? argument2, NativeArgument? argument3, NativeArgument? argument4)
+        {
+            unsafe
+            {
+                const int ArgCount = 5;
+                ulong* argPtr = stackalloc ulong[ArgCount];
+
+                argPtr[0] = argument0.GetValueOrDefault()._data;
+                argPtr[1] = argument1.GetValueOrDefault()._data;
+                argPtr[2] = argument2.GetValueOrDefault()._data;
+                argPtr[3] = argument3.GetValueOrDefault()._data;
+                argPtr[4] = argument4.GetValueOrDefault()._data;
+
+                SHVDN.NativeFunc.Invoke((ulong)hash, argPtr, ArgCount);
+            }
+        }
+        /// <summary>
+        /// Calls the specified native script function and ignores its return value.
+        /// </summary>
+        /// <param name="hash">The hashed name of the script function.</param>
+        /// <param name="argument0">The 1st input or output argument to pass to the native script function.</param>
+        /// <param name="argument1">The 2nd input or output argument to pass to the native script function.</param>
+        /// <param name="argument2">The 3rd input or output argument to pass to the native script function.</param>
+        /// <param name="argument3">The 4th input or output argument to pass to the native script function.</param>
+        /// <param name="argument4">The 5th input or output argument to pass to the native script function.</param>
+        /// <param name="argument5">The 6th input or output argument to pass to the native script function.</param>
+        public static void Call(Hash hash, NativeArgument? argument0, NativeArgument? argument1, NativeArgument? argument2, NativeArgument? argument3, NativeArgument? argument4, NativeArgument? argument5)
+        {
+            unsafe
+            {
+                const int ArgCount = 6;
+                ulong* argPtr = stackalloc ulong[ArgCount];
+
+                argPtr[0] = argument0.GetValueOrDefault()._data;
+                argPtr[1] = argument1.GetValueOrDefault()._data;
+                argPtr[2] = argument2.GetValueOrDefault()._data;
+                argPtr[3] = argument3.GetValueOrDefault()._data;
+                argPtr[4] = argument4.GetValueOrDefault()._data;
+                argPtr[5] = argument5.GetValueOrDefault()._data;
+
+                SHVDN.NativeFunc.Invoke((ulong)hash, argPtr, ArgCount);
+            }
+        }
+        /// <summary>
+        /// Calls the specified native script function and ignores its return value.
+        /// </summary>
+        /// <param name="hash">The hashed name of the script function.</param>
+        /// <param name="argument0">The 1st input or output argument to pass to the native script function.</param>
+        /// <param name="argument1">The 2nd input or output argument to pass to the native script function.</param>
+        /// <param name="argument2">The 3rd input or output argument to pass to the native script function.</param>
+        /// <param name="argument3">The 4th input or output argument to pass to the native script function.</param>
+        /// <param name="argument4">The 5th input or output argument to pass to the native script function.</param>
+        /// <param name="argument5">The 6th input or output argument to pass to the native script function.</param>
+        /// <param name="argument6">The 7th input or output argument to pass to the native script function.</param>
+        public static void Call(Hash hash, NativeArgument? argument0, NativeArgument? argument1, NativeArgument? argument2, NativeArgument? argument3, NativeArgument? argument4, NativeArgument? argument5, NativeArgument? argument6)
+        {
+            unsafe
+            {
+                const int ArgCount = 7;
+                ulong* argPtr = stackalloc ulong[ArgCount];
+
+                argPtr[0] = argument0.GetValueOrDefault()._data;
+                argPtr[1] = argument1.GetValueOrDefault()._data;
+                argPtr[2] = argument2.GetValueOrDefault()._data;
+                argPtr[3] = argument3.GetValueOrDefault()._data;
+                argPtr[4] = argument4.GetValueOrDefault()._data;
+                argPtr[5] = argument5.GetValueOrDefault()._data;
+                argPtr[6] = argument6.GetValueOrDefault()._data;
+
+                SHVDN.NativeFunc.Invoke((ulong)hash, argPtr, ArgCount);
+            }
+        }
+        /// <summary>
+        /// Calls the specified native script function and ignores its return value.
+        /// </summary>
+        /// <param name="hash">The hashed name of the script function.</param>
+        /// <param name="argument0">The 1st input or output argument to pass to the native script function.</param>
+        /// <param name="argument1">The 2nd input or output argument to pass to the native script function.</param>
+        /// <param name="argument2">The 3rd input or output argument to pass to the native script function.</param>
+        /// <param name="argument3">The 4th input or output argument to pass to the native script function.</param>
+        /// <param name="argument4">The 5th input or output argument to pass to the native script function.</param>
+        /// <param name="argument5">The 6th input or output argument to pass to the native script function.</param>
+        /// <param name="argument6">The 7th input or output argument to pass to the native script function.</param>
+        /// <param name="argument7">The 8th input or output argument to pass to the native script function.</param>
+        public static void Call(Hash hash, NativeArgument? argument0, NativeArgument? argument1, NativeArgument? argument2, NativeArgument? argument3, NativeArgument? argument4, NativeArgument? argument5, NativeArgument? argument6, NativeArgument? argument7)
+        {
+            unsafe
+            {
+                const int ArgCount = 8;
+                ulong* argPtr = stackalloc ulong[ArgCount];
+
+                argPtr[0] = argument0.GetValueOrDefault()._data;
+                argPtr[1] = argument1.GetValueOrDefault()._data;
+                argPtr[2] = argument2.GetValueOrDefault()._data;
+                argPtr[3] = argument3.GetValueOrDefault()._data;
+                argPtr[4] = argument4.GetValueOrDefault()._data;
+                argPtr[5] = argument5.GetValueOrDefault()._data;
+                argPtr[6] = argument6.GetValueOrDefault()._data;
+                argPtr[7] = argument7.GetValueOrDefault()._data;
+
+                SHVDN.NativeFunc.Invoke((ulong)hash, argPtr, ArgCount);
+            }
+        }
+        /// <summary>
+        /// Calls the specified native script function and ignores its return value.
+        /// </summary>
+        /// <param name="hash">The hashed name of the script function.</param>
+        /// <param name="argument0">The 1st input or output argument to pass to the native script function.</param>
+        /// <param name="argument1">The 2nd input or output argument to pass to the native script function.</param>
+        /// <param name="argument2">The 3rd input or output argument to pass to the native script function.</param>
+        /// <param name="argument3">The 4th input or output argument to pass to the native script function.</param>
+        /// <param name="argument4">The 5th input or output argument to pass to the native script function.</param>
+        /// <param name="argument5">The 6th input or output argument to pass to the native script function.</param>
+        /// <param name="argument6">The 7th input or output argument to pass to the native script function.</param>
+        /// <param name="argument7">The 8th input or output argument to pass to the native script function.</param>
+        /// <param name="argument8">The 9th input or output argument to pass to the native script function.</param>
+        public static void Call(Hash hash, NativeArgument? argument0, NativeArgument? argument1, NativeArgument? argument2, NativeArgument? argument3, NativeArgument? argument4, NativeArgument? argument5, NativeArgument? argument6, NativeArgument? argument7, NativeArgument? argument8)
+        {
+            unsafe
+            {
+                const int ArgCount = 9;
+                ulong* argPtr = stackalloc ulong[ArgCount];
+
+                argPtr[0] = argument0.GetValueOrDefault()._data;
+                argPtr[1] = argument1.GetValueOrDefault()._data;
+                argPtr[2] = argument2.GetValueOrDefault()._data;
+                argPtr[3] = argument3.GetValueOrDefault()._data;
+                argPtr[4] = argument4.GetValueOrDefault()._data;
+                argPtr[5] = argument5.GetValueOrDefault()._data;
+                argPtr[6] = argument6.GetValueOrDefault()._data;
+                argPtr[7] = argument7.GetValueOrDefault()._data;
+                argPtr[8] = argument8.GetValueOrDefault()._data;
+
+                SHVDN.NativeFunc.Invoke((ulong)hash, argPtr, ArgCount);
+            }
+        }
+        /// <summary>
+        /// Calls the specified native script function and ignores its return value.
+        /// </summary>
+        /// <param name="hash">The hashed name of the script function.</param>
+        /// <param name="argument0">The 1st input or output argument to pass to the native script function.</param>
+        /// <param name="argument1">The 2nd input or output argument to pass to the native script function.</param>
+        /// <param name="argument2">The 3rd input or output argument to pass to the native script function.</param>
+        /// <param name="argument3">The 4th input or output argument to pass to the native script function.</param>
+        /// <param name="argument4">The 5th input or output argument to pass to the native script function.</param>
+        /// <param name="argument5">The 6th input or output argument to pass to the native script function.</param>
+        /// <param name="argument6">The 7th input or output argument to pass to the native script function.</param>
+        /// <param name="argument7">The 8th input or output argument to pass to the native script function.</param>
+        /// <param name="argument8">The 9th input or output argument to pass to the native script function.</param>
+        /// <param name="argument9">The 10th input or output argument to pass to the native script function.</param>
+        public static void Call(Hash hash, NativeArgument? argument0, NativeArgument? argument1, NativeArgument? argument2, NativeArgument? argument3, NativeArgument? argument4, NativeArgument? argument5, NativeArgument? argument6, NativeArgument? argument7, NativeArgument? argument8, NativeArgument? argument9)
+        {
+            unsafe
+            {
+                const int ArgCount = 10;
+                ulong* argPtr = stackalloc ulong[ArgCount];
+
+                argPtr[0] = argument0.GetValueOrDefault()._data;
+                argPtr[1] = argument1.GetValueOrDefault()._data;
+                argPtr[2] = argument2.GetValueOrDefault()._data;
+                argPtr[3] = argument3.GetValueOrDefault()._data;
+                argPtr[4] = argument4.GetValueOrDefault()._data;
+                argPtr[5] = argument5.GetValueOrDefault()._data;
+                argPtr[6] = argument6.GetValueOrDefault()._data;
+                argPtr[7] = argument7.GetValueOrDefault()._data;
+                argPtr[8] = argument8.GetValueOrDefault()._data;
+                argPtr[9] = argument9.GetValueOrDefault()._data;
+
+                SHVDN.NativeFunc.Invoke((ulong)hash, argPtr, ArgCount);
+            }
+        }
+        /// <summary>
+        /// Calls the specified native script function and ignores its return value.
+        /// </summary>
+        /// <param name="hash">The hashed name of the script function.</param>
+        /// <param name="argument0">The 1st input or output argument to pass to the native script function.</param>
+        /// <param name="argument1">The 2nd input or output argument to pass to the native script function.</param>
+        /// <param name="argument2">The 3rd input or output argument to pass to the native script function.</param>
+        /// <param name="argument3">The 4th input or output argument to pass to the native script function.</param>
+        /// <param name="argument4">The 5th input or output argument to pass to the native script function.</param>
+        /// <param name="argument5">The 6th input or output argument to pass to the native script function.</param>
+        /// <param name="argument6">The 7th input or output argument to pass to the native script function.</param>
+        /// <param name="argument7">The 8th input or output argument to pass to the native script function.</param>
+        /// <param name="argument8">The 9th input or output argument to pass to the native script function.</param>
+        /// <param name="argument9">The 10th input or output argument to pass to the native script function.</param>
+        /// <param name="argument10">The 11th input or output argument to pass to the native script function.</param>
+        public static void Call(Hash hash, NativeArgument? argument0, NativeArgument? argument1, NativeArgument? argument2, NativeArgument? argument3, NativeArgument? argument4, NativeArgument? argument5, NativeArgument? argument6, NativeArgument? argument7, NativeArgument? argument8, NativeArgument? argument9, NativeArgument? argument10)
+        {
+            unsafe
+            {
+                const int ArgCount = 11;
+                ulong* argPtr = stackalloc ulong[ArgCount];
+
+                argPtr[0] = argument0.GetValueOrDefault()._data;
+                argPtr[1] = argument1.GetValueOrDefault()._data;
+                argPtr[2] = argument2.GetValueOrDefault()._data;
+                argPtr[3] = argument3.GetValueOrDefault()._data;
+                argPtr[4] = argument4.GetValueOrDefault()._data;
+                argPtr[5] = argument5.GetValueOrDefault()._data;
+                argPtr[6] = argument6.GetValueOrDefault()._data;
+                argPtr[7] = argument7.GetValueOrDefault()._data;
+                argPtr[8] = argument8.GetValueOrDefault()._data;
+                argPtr[9] = argument9.GetValueOrDefault()._data;
+                argPtr[10] = argument10.GetValueOrDefault()._data;
+
+                SHVDN.NativeFunc.Invoke((ulong)hash, argPtr, ArgCount);
+            }
+        }
+        /// <summary>
+        /// Calls the specified native script function and ignores its return value.
+        /// </summary>
+        /// <param name="hash">The hashed name of the script function.</param>
+        /// <param name="argument0">The 1st input or output argument to pass to the native script function.</param>
+        /// <param name="argument1">The 2nd input or output argument to pass to the native script function.</param>
+        /// <param name="argument2">The 3rd input or output argument to pass to the native script function.</param>
+        /// <param name="argument3">The 4th input or output argument to pass to the native script function.</param>
+        /// <param name="argument4">The 5th input or output argument to pass to the native script function.</param>
+        /// <param name="argument5">The 6th input or output argument to pass to the native script function.</param>
+        /// <param name="argument6">The 7th input or output argument to pass to the native script function.</param>
+        /// <param name="argument7">The 8th input or output argument to pass to the native script function.</param>
+        /// <param name="argument8">The 9th input or output argument to pass to the native script function.</param>
+        /// <param name="argument9">The 10th input or output argument to pass to the native script function.</param>
+        /// <param name="argument10">The 11th input or output argument to pass to the native script function.</param>
+        /// <param name="argument11">The 12th input or output argument to pass to the native script function.</param>
+        public static void Call(Hash hash, NativeArgument? argument0, NativeArgument? argument1, NativeArgument? argument2, NativeArgument? argument3, NativeArgument? argument4, NativeArgument? argument5, NativeArgument? argument6, NativeArgument? argument7, NativeArgument? argument8, NativeArgument? argument9, NativeArgument? argument10, NativeArgument? argument11)
+        {
+            unsafe
+            {
+                const int ArgCount = 12;
+                ulong* argPtr = stackalloc ulong[ArgCount];
+
+                argPtr[0] = argument0.GetValueOrDefault()._data;
+                argPtr[1] = argument1.GetValueOrDefault()._data;
+                argPtr[2] = argument2.GetValueOrDefault()._data;
+                argPtr[3] = argument3.GetValueOrDefault()._data;
+                argPtr[4] = argument4.GetValueOrDefault()._data;
+                argPtr[5] = argument5.GetValueOrDefault()._data;
+                argPtr[6] = argument6.GetValueOrDefault()._data;
+                argPtr[7] = argument7.GetValueOrDefault()._data;
+                argPtr[8] = argument8.GetValueOrDefault()._data;
+                argPtr[9] = argument9.GetValueOrDefault()._data;
+                argPtr[10] = argument10.GetValueOrDefault()._data;
+                argPtr[11] = argument11.GetValueOrDefault()._data;
+
+                SHVDN.NativeFunc.Invoke((ulong)hash, argPtr, ArgCount);
+            }
+        }
+        /// <summary>
+        /// Calls the specified native script function and ignores its return value.
+        /// </summary>
+        /// <param name="hash">The hashed name of the script function.</param>
+        /// <param name="argument0">The 1st input or output argument to pass to the native script function.</param>
+        /// <param name="argument1">The 2nd input or output argument to pass to the native script function.</param>
+        /// <param name="argument2">The 3rd input or output argument to pass to the native script function.</param>
+        /// <param name="argument3">The 4th input or output argument to pass to the native script function.</param>
+        /// <param name="argument4">The 5th input or output argument to pass to the native script function.</param>
+        /// <param name="argument5">The 6th input or output argument to pass to the native script function.</param>
+        /// <param name="argument6">The 7th input or output argument to pass to the native script function.</param>
+        /// <param name="argument7">The 8th input or output argument to pass to the native script function.</param>
+        /// <param name="argument8">The 9th input or output argument to pass to the native script function.</param>
+        /// <param name="argument9">The 10th input or output argument to pass to the native script function.</param>
+        /// <param name="argument10">The 11th input or output argument to pass to the native script function.</param>
+        /// <param name="argument11">The 12th input or output argument to pass to the native script function.</param>
+        /// <param name="argument12">The 13th input or output argument to pass to the native script function.</param>
+        public static void Call(Hash hash, NativeArgument? argument0, NativeArgument? argument1, NativeArgument? argument2, NativeArgument? argument3, NativeArgument? argument4, NativeArgument? argument5, NativeArgument? argument6, NativeArgument? argument7, NativeArgument? argument8, NativeArgument? argument9, NativeArgument? argument10, NativeArgument? argument11, NativeArgument? argument12)
+        {
+            unsafe
+            {
+                const int ArgCount = 13;
+                ulong* argPtr = stackalloc ulong[ArgCount];
+
+                argPtr[0] = argument0.GetValueOrDefault()._data;
+                argPtr[1] = argument1.GetValueOrDefault()._data;
+                argPtr[2] = argument2.GetValueOrDefault()._data;
+                argPtr[3] = argument3.GetValueOrDefault()._data;
+                argPtr[4] = argument4.GetValueOrDefault()._data;
+                argPtr[5] = argument5.GetValueOrDefault()._data;
+                argPtr[6] = argument6.GetValueOrDefault()._data;
+                argPtr[7] = argument7.GetValueOrDefault()._data;
+                argPtr[8] = argument8.GetValueOrDefault()._data;
+                argPtr[9] = argument9.GetValueOrDefault()._data;
+                argPtr[10] = argument10.GetValueOrDefault()._data;
+                argPtr[11] = argument11.GetValueOrDefault()._data;
+                argPtr[12] = argument12.GetValueOrDefault()._data;
+
+                SHVDN.NativeFunc.Invoke((ulong)hash, argPtr, ArgCount);
+            }
+        }
+        /// <summary>
+        /// Calls the specified native script function and ignores its return value.
+        /// </summary>
+        /// <param name="hash">The hashed name of the script function.</param>
+        /// <param name="argument0">The 1st input or output argument to pass to the native script function.</param>
+        /// <param name="argument1">The 2nd input or output argument to pass to the native script function.</param>
+        /// <param name="argument2">The 3rd input or output argument to pass to the native script function.</param>
+        /// <param name="argument3">The 4th input or output argument to pass to the native script function.</param>
+        /// <param name="argument4">The 5th input or output argument to pass to the native script function.</param>
+        /// <param name="argument5">The 6th input or output argument to pass to the native script function.</param>
+        /// <param name="argument6">The 7th input or output argument to pass to the native script function.</param>
+        /// <param name="argument7">The 8th input or output argument to pass to the native script function.</param>
+        /// <param name="argument8">The 9th input or output argument to pass to the native script function.</param>
+        /// <param name="argument9">The 10th input or output argument to pass to the native script function.</param>
+        /// <param name="argument10">The 11th input or output argument to pass to the native script function.</param>
+        /// <param name="argument11">The 12th input or output argument to pass to the native script function.</param>
+        /// <param name="argument12">The 13th input or output argument to pass to the native script function.</param>
+        /// <param name="argument13">The 14th input or output argument to pass to the native script function.</param>
+        public static void Call(Hash hash, NativeArgument? argument0, NativeArgument? argument1, NativeArgument? argument2, NativeArgument? argument3, NativeArgument? argument4, NativeArgument? argument5, NativeArgument? argument6, NativeArgument? argument7, NativeArgument? argument8, NativeArgument? argument9, NativeArgument? argument10, NativeArgument? argument11, NativeArgument? argument12, NativeArgument? argument13)
+        {
+            unsafe
+            {
+                const int ArgCount = 14;
+                ulong* argPtr = stackalloc ulong[ArgCount];
+
+                argPtr[0] = argument0.GetValueOrDefault()._data;
+                argPtr[1] = argument1.GetValueOrDefault()._data;
+                argPtr[2] = argument2.GetValueOrDefault()._data;
+                argPtr[3] = argument3.GetValueOrDefault()._data;
+                argPtr[4] = argument4.GetValueOrDefault()._data;
+                argPtr[5] = argument5.GetValueOrDefault()._data;
+                argPtr[6] = argument6.GetValueOrDefault()._data;
+                argPtr[7] = argument7.GetValueOrDefault()._data;
+                argPtr[8] = argument8.GetValueOrDefault()._data;
+                argPtr[9] = argument9.GetValueOrDefault()._data;
+                argPtr[10] = argument10.GetValueOrDefault()._data;
+                argPtr[11] = argument11.GetValueOrDefault()._data;
+                argPtr[12] = argument12.GetValueOrDefault()._data;
+                argPtr[13] = argument13.GetValueOrDefault()._data;
+
+                SHVDN.NativeFunc.Invoke((ulong)hash, argPtr, ArgCount);
+            }
+        }
+        /// <summary>
+        /// Calls the specified native script function and ignores its return value.
+        /// </summary>
+        /// <param name="hash">The hashed name of the script function.</param>
+        /// <param name="argument0">The 1st input or output argument to pass to the native script function.</param>
+        /// <param name="argument1">The 2nd input or output argument to pass to the native script function.</param>
+        /// <param name="argument2">The 3rd input or output argument to pass to the native script function.</param>
+        /// <param name="argument3">The 4th input or output argument to pass to the native script function.</param>
+        /// <param name="argument4">The 5th input or output argument to pass to the native script function.</param>
+        /// <param name="argument5">The 6th input or output argument to pass to the native script function.</param>
+        /// <param name="argument6">The 7th input or output argument to pass to the native script function.</param>
+        /// <param name="argument7">The 8th input or output argument to pass to the native script function.</param>
+        /// <param name="argument8">The 9th input or output argument to pass to the native script function.</param>
+        /// <param name="argument9">The 10th input or output argument to pass to the native script function.</param>
+        /// <param name="argument10">The 11th input or output argument to pass to the native script function.</param>
+        /// <param name="argument11">The 12th input or output argument to pass to the native script function.</param>
+        /// <param name="argument12">The 13th input or output argument to pass to the native script function.</param>
+        /// <param name="argument13">The 14th input or output argument to pass to the native script function.</param>
+        /// <param name="argument14">The 15th input or output argument to pass to the native script function.</param>
+        public static void Call(Hash hash, NativeArgument? argument0, NativeArgument? argument1, NativeArgument? argument2, NativeArgument? argument3, NativeArgument? argument4, NativeArgument? argument5, NativeArgument? argument6, NativeArgument? argument7, NativeArgument? argument8, NativeArgument? argument9, NativeArgument? argument10, NativeArgument? argument11, NativeArgument? argument12, NativeArgument? argument13, NativeArgument? argument14)
+        {
+            unsafe
+            {
+                const int ArgCount = 15;
+                ulong* argPtr = stackalloc ulong[ArgCount];
+
+                argPtr[0] = argument0.GetValueOrDefault()._data;
+                argPtr[1] = argument1.GetValueOrDefault()._data;
+                argPtr[2] = argument2.GetValueOrDefault()._data;
+                argPtr[3] = argument3.GetValueOrDefault()._data;
+                argPtr[4] = argument4.GetValueOrDefault()._data;
+                argPtr[5] = argument5.GetValueOrDefault()._data;
+                argPtr[6] = argument6.GetValueOrDefault()._data;
+                argPtr[7] = argument7.GetValueOrDefault()._data;
+                argPtr[8] = argument8.GetValueOrDefault()._data;
+                argPtr[9] = argument9.GetValueOrDefault()._data;
+                argPtr[10] = argument10.GetValueOrDefault()._data;
+                argPtr[11] = argument11.GetValueOrDefault()._data;
+                argPtr[12] = argument12.GetValueOrDefault()._data;
+                argPtr[13] = argument13.GetValueOrDefault()._data;
+                argPtr[14] = argument14.GetValueOrDefault()._data;
+
+                SHVDN.NativeFunc.Invoke((ulong)hash, argPtr, ArgCount);
+            }
+        }
+        /// <summary>
+        /// Calls the specified native script function and ignores its return value.
+        /// </summary>
+        /// <param name="hash">The hashed name of the script function.</param>
+        /// <param name="argument0">The 1st input or output argument to pass to the native script function.</param>
+        /// <param name="argument1">The 2nd input or output argument to pass to the native script function.</param>
+        /// <param name="argument2">The 3rd input or output argument to pass to the native script function.</param>
+        /// <param name="argument3">The 4th input or output argument to pass to the native script function.</param>
+        /// <param name="argument4">The 5th input or output argument to pass to the native script function.</param>
+        /// <param name="argument5">The 6th input or output argument to pass to the native script function.</param>
+        /// <param name="argument6">The 7th input or output argument to pass to the native script function.</param>
+        /// <param name="argument7">The 8th input or output argument to pass to the native script function.</param>
+        /// <param name="argument8">The 9th input or output argument to pass to the native script function.</param>
+        /// <param name="argument9">The 10th input or output argument to pass to the native script function.</param>
+        /// <param name="argument10">The 11th input or output argument to pass to the native script function.</param>
+        /// <param name="argument11">The 12th input or output argument to pass to the native script function.</param>
+        /// <param name="argument12">The 13th input or output argument to pass to the native script function.</param>
+        /// <param name="argument13">The 14th input or output argument to pass to the native script function.</param>
+        /// <param name="argument14">The 15th input or output argument to pass to the native script function.</param>
+        /// <param name="argument15">The 16th input or output argument to pass to the native script function.</param>
+        public static void Call(Hash hash, NativeArgument? argument0, NativeArgument? argument1, NativeArgument? argument2, NativeArgument? argument3, NativeArgument? argument4, NativeArgument? argument5, NativeArgument? argument6, NativeArgument? argument7, NativeArgument? argument8, NativeArgument? argument9, NativeArgument? argument10, NativeArgument? argument11, NativeArgument? argument12, NativeArgument? argument13, NativeArgument? argument14, NativeArgument? argument15)
+        {
+            unsafe
+            {
+                const int ArgCount = 16;
+                ulong* argPtr = stackalloc ulong[ArgCount];
+
+                argPtr[0] = argument0.GetValueOrDefault()._data;
+                argPtr[1] = argument1.GetValueOrDefault()._data;
+                argPtr[2] = argument2.GetValueOrDefault()._data;
+                argPtr[3] = argument3.GetValueOrDefault()._data;
+                argPtr[4] = argument4.GetValueOrDefault()._data;
+                argPtr[5] = argument5.GetValueOrDefault()._data;
+                argPtr[6] = argument6.GetValueOrDefault()._data;
+                argPtr[7] = argument7.GetValueOrDefault()._data;
+                argPtr[8] = argument8.GetValueOrDefault()._data;
+                argPtr[9] = argument9.GetValueOrDefault()._data;
+                argPtr[10] = argument10.GetValueOrDefault()._data;
+                argPtr[11] = argument11.GetValueOrDefault()._data;
+                argPtr[12] = argument12.GetValueOrDefault()._data;
+                argPtr[13] = argument13.GetValueOrDefault()._data;
+                argPtr[14] = argument14.GetValueOrDefault()._data;
+                argPtr[15] = argument15.GetValueOrDefault()._data;
+
+                SHVDN.NativeFunc.Invoke((ulong)hash, argPtr, ArgCount);
+            }
+        }
+        #endregion
+    }
+}
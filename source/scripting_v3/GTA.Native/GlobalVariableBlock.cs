@@ -0,0 +1,273 @@
+//
+// Copyright (C) 2015 crosire & kagikn & contributors
+// License: https://github.com/scripthookvdotnet/scripthookvdotnet#license
+//
+
+using System;
+
+namespace GTA.Native
+{
+    /// <summary>
+    /// A view over a contiguous range of global script variables, such as a global structure or array.
+    /// </summary>
+    /// <remarks>
+    /// <para>
+    /// Unlike <see cref="GlobalVariable.Get(int)"/>, which looks up the address of the variable every time it is
+    /// called, the address of the range is looked up once per tick at most, the first time the block is used in the
+    /// tick. Reading and writing variables in the range are plain memory accesses, and bulk reads are memory copies.
+    /// </para>
+    /// <para>
+    /// Each global variable takes 8 bytes. Values smaller than 8 bytes are stored in the lower bytes of a variable,
+    /// and values larger than 8 bytes take several variables. A <see cref="GTA.Math.Vector3"/> stored as a script
+    /// vector pads each component to 8 bytes, so it should be read as three <see cref="float"/>s.
+    /// </para>
+    /// </remarks>
+    public sealed unsafe class GlobalVariableBlock
+    {
+        private const int VariableSize = 8;
+
+        private byte* _address;
+        private uint _tickStamp;
+        private ulong[] _snapshot;
+        private uint _snapshotTickStamp;
+
+        private GlobalVariableBlock(int startIndex, int count)
+        {
+            StartIndex = startIndex;
+            Count = count;
+            Resolve();
+        }
+
+        /// <summary>
+        /// Gets a view over the global variables from <paramref name="startIndex"/>.
+        /// </summary>
+        /// <param name="startIndex">The index of the first global variable.</param>
+        /// <param name="count">The number of global variables in the range.</param>
+        /// <returns>A <see cref="GlobalVariableBlock"/> representing the range of global variables.</returns>
+        /// <exception cref="ArgumentOutOfRangeException"><paramref name="count"/> is not positive.</exception>
+        /// <exception cref="IndexOutOfRangeException">
+        /// The range does not correspond to existing global variables, or it spans global variables that are not
+        /// contiguous in memory.
+        /// </exception>
+        public static GlobalVariableBlock Get(int startIndex, int count)
+        {
+            if (count <= 0)
+            {
+                throw new ArgumentOutOfRangeException(nameof(count), "The number of global variables must be positive.");
+            }
+            if (startIndex < 0 || startIndex > int.MaxValue - (count - 1))
+            {
+                throw new IndexOutOfRangeException($"The index {startIndex.ToString()} does not correspond to an existing global variable.");
+            }
+
+            return new GlobalVariableBlock(startIndex, count);
+        }
+
+        /// <summary>
+        /// Gets the index of the first global variable of this <see cref="GlobalVariableBlock"/>.
+        /// </summary>
+        public int StartIndex
+        {
+            get;
+        }
+
+        /// <summary>
+        /// Gets the number of global variables in this <see cref="GlobalVariableBlock"/>.
+        /// </summary>
+        public int Count
+        {
+            get;
+        }
+
+        /// <summary>
+        /// Gets the native memory address of the first global variable of this <see cref="GlobalVariableBlock"/>.
+        /// </summary>
+        public IntPtr MemoryAddress => new(GetAddress());
+
+        /// <summary>
+        /// Gets a reference to the value stored at the specified index, which can be read and written directly.
+        /// The reference must not be used after the current tick.
+        /// </summary>
+        /// <typeparam name="T">The type of the value. Values larger than 8 bytes take several global variables.</typeparam>
+        /// <param name="index">The index of the variable relative to <see cref="StartIndex"/>.</param>
+        /// <exception cref="ArgumentOutOfRangeException">The value does not fit in this <see cref="GlobalVariableBlock"/>.</exception>
+        public ref T GetRef<T>(int index) where T : unmanaged
+        {
+            CheckIndex(index, GetVariableCount<T>());
+            return ref *(T*)(GetAddress() + (long)index * VariableSize);
+        }
+
+        /// <summary>
+        /// Gets the value stored at the specified index.
+        /// </summary>
+        /// <typeparam name="T">The type of the value. Values larger than 8 bytes take several global variables.</typeparam>
+        /// <param name="index">The index of the variable relative to <see cref="StartIndex"/>.</param>
+        /// <exception cref="ArgumentOutOfRangeException">The value does not fit in this <see cref="GlobalVariableBlock"/>.</exception>
+        public T Read<T>(int index) where T : unmanaged
+        {
+            return GetRef<T>(index);
+        }
+
+        /// <summary>
+        /// Sets the value stored at the specified index.
+        /// </summary>
+        /// <typeparam name="T">The type of the value. Values larger than 8 bytes take several global variables.</typeparam>
+        /// <param name="index">The index of the variable relative to <see cref="StartIndex"/>.</param>
+        /// <param name="value">The new value.</param>
+        /// <exception cref="ArgumentOutOfRangeException">The value does not fit in this <see cref="GlobalVariableBlock"/>.</exception>
+        public void Write<T>(int index, T value) where T : unmanaged
+        {
+            GetRef<T>(index) = value;
+        }
+
+        /// <summary>
+        /// Copies consecutive values from the specified index into an array. Each element takes as many global
+        /// variables as it does with <see cref="Read{T}(int)"/>.
+        /// </summary>
+        /// <param name="index">The index of the first variable relative to <see cref="StartIndex"/>.</param>
+        /// <param name="destination">The array to copy the values to.</param>
+        /// <exception cref="ArgumentNullException"><paramref name="destination"/> is <see langword="null"/>.</exception>
+        /// <exception cref="ArgumentOutOfRangeException">The values do not fit in this <see cref="GlobalVariableBlock"/>.</exception>
+        public void CopyTo<T>(int index, T[] destination) where T : unmanaged
+        {
+            if (destination == null)
+            {
+                throw new ArgumentNullException(nameof(destination));
+            }
+            if (destination.Length == 0)
+            {
+                return;
+            }
+
+            int variableCount = GetVariableCount<T>();
+            CheckIndex(index, checked(destination.Length * variableCount));
+
+            byte* source = GetAddress() + (long)index * VariableSize;
+            fixed (T* destinationPtr = destination)
+            {
+                // Values that fill their variables are stored without padding, so they can be copied in one go
+                if (sizeof(T) == variableCount * VariableSize)
+                {
+                    long size = (long)destination.Length * sizeof(T);
+                    Buffer.MemoryCopy(source, destinationPtr, size, size);
+                    return;
+                }
+
+                for (int i = 0; i < destination.Length; i++)
+                {
+                    destinationPtr[i] = *(T*)(source + (long)i * variableCount * VariableSize);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Copies the values of an array to consecutive variables from the specified index. Each element takes as
+        /// many global variables as it does with <see cref="Write{T}(int, T)"/>.
+        /// </summary>
+        /// <param name="index">The index of the first variable relative to <see cref="StartIndex"/>.</param>
+        /// <param name="source">The array to copy the values from.</param>
+        /// <exception cref="ArgumentNullException"><paramref name="source"/> is <see langword="null"/>.</exception>
+        /// <exception cref="ArgumentOutOfRangeException">The values do not fit in this <see cref="GlobalVariableBlock"/>.</exception>
+        public void CopyFrom<T>(int index, T[] source) where T : unmanaged
+        {
+            if (source == null)
+            {
+                throw new ArgumentNullException(nameof(source));
+            }
+            if (source.Length == 0)
+            {
+                return;
+            }
+
+            int variableCount = GetVariableCount<T>();
+            CheckIndex(index, checked(source.Length * variableCount));
+
+            byte* destination = GetAddress() + (long)index * VariableSize;
+            fixed (T* sourcePtr = source)
+            {
+                if (sizeof(T) == variableCount * VariableSize)
+                {
+                    long size = (long)source.Length * sizeof(T);
+                    Buffer.MemoryCopy(sourcePtr, destination, size, size);
+                    return;
+                }
+
+                // Only write the bytes of the values and keep the rest of each variable as it is
+                for (int i = 0; i < source.Length; i++)
+                {
+                    *(T*)(destination + (long)i * variableCount * VariableSize) = sourcePtr[i];
+                }
+            }
+        }
+
+        /// <summary>
+        /// Gets a copy of all the variables of this <see cref="GlobalVariableBlock"/>, which is taken once per tick.
+        /// </summary>
+        /// <remarks>
+        /// Calls in the same tick return the same array without copying again, so all the reads in a tick see the same
+        /// values even if game scripts change them in between. The array is reused and refilled in later ticks.
+        /// </remarks>
+        public ulong[] GetSnapshot()
+        {
+            uint tickStamp = SHVDN.NativeMemory.TickStamp;
+            if (_snapshot != null && _snapshotTickStamp == tickStamp)
+            {
+                return _snapshot;
+            }
+
+            byte* source = GetAddress();
+            _snapshot ??= new ulong[Count];
+            fixed (ulong* destination = _snapshot)
+            {
+                long size = (long)Count * VariableSize;
+                Buffer.MemoryCopy(source, destination, size, size);
+            }
+            _snapshotTickStamp = tickStamp;
+
+            return _snapshot;
+        }
+
+        private byte* GetAddress()
+        {
+            if (_tickStamp != SHVDN.NativeMemory.TickStamp)
+            {
+                Resolve();
+            }
+
+            return _address;
+        }
+
+        private void Resolve()
+        {
+            // Global variables are stored in blocks that scripts load and unload, so the addresses can change between
+            // ticks and a range has to be looked up again at both ends to make sure it is still in one block
+            var first = (byte*)SHVDN.NativeMemory.GetGlobalPtr(StartIndex).ToPointer();
+            var last = (byte*)SHVDN.NativeMemory.GetGlobalPtr(StartIndex + Count - 1).ToPointer();
+
+            if (first == null || last == null)
+            {
+                throw new IndexOutOfRangeException($"The range of {Count.ToString()} global variables from the index {StartIndex.ToString()} does not correspond to existing global variables.");
+            }
+            if (last - first != (long)(Count - 1) * VariableSize)
+            {
+                throw new IndexOutOfRangeException($"The range of {Count.ToString()} global variables from the index {StartIndex.ToString()} is not contiguous in memory.");
+            }
+
+            _address = first;
+            _tickStamp = SHVDN.NativeMemory.TickStamp;
+        }
+
+        private void CheckIndex(int index, int variableCount)
+        {
+            if (index < 0 || index > Count - variableCount)
+            {
+                throw new ArgumentOutOfRangeException(nameof(index), $"The index {index.ToString()} with {variableCount.ToString()} variables was outside the bounds of the block.");
+            }
+        }
+
+        private static int GetVariableCount<T>() where T : unmanaged
+        {
+            return (sizeof(T) + VariableSize - 1) / VariableSize;
+        }
+    }
+}
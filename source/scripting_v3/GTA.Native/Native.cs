@@ -38,78 +38,10 @@ namespace GTA.Native
             }
         }
 
-        private static readonly Func<IntPtr, T> _ptrToStrFunc;
-
-        static NativeHelper()
-        {
-            var ptrToStrMethod = new DynamicMethod("PtrToStructure<" + typeof(T) + ">", typeof(T),
-                new[] { typeof(IntPtr) }, typeof(NativeHelper<T>), true);
-
-            ILGenerator generator = ptrToStrMethod.GetILGenerator();
-            generator.Emit(OpCodes.Ldarg_0);
-            generator.Emit(OpCodes.Ldobj, typeof(T));
-            generator.Emit(OpCodes.Ret);
-
-            _ptrToStrFunc = (Func<IntPtr, T>)ptrToStrMethod.CreateDelegate(typeof(Func<IntPtr, T>));
-        }
-
         internal static T Convert<TFrom>(TFrom from)
         {
             return CastCache<TFrom>.Cast(from);
         }
-
-        internal static T PtrToStructure(IntPtr ptr)
-        {
-            return _ptrToStrFunc(ptr);
-        }
-    }
-    internal static class InstanceCreator<T1, TInstance>
-    {
-        internal static Func<T1, TInstance> Create;
-
-        static InstanceCreator()
-        {
-            ConstructorInfo constructorInfo = typeof(TInstance).GetConstructor(BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance, Type.DefaultBinder,
-                new[] { typeof(T1) }, null);
-            ParameterExpression arg1Exp = Expression.Parameter(typeof(T1));
-
-            NewExpression newExp = Expression.New(constructorInfo, arg1Exp);
-            var lambdaExp = Expression.Lambda<Func<T1, TInstance>>(newExp, arg1Exp);
-            Create = lambdaExp.Compile();
-        }
-    }
-    internal static class InstanceCreator<T1, T2, TInstance>
-    {
-        internal static Func<T1, T2, TInstance> Create;
-
-        static InstanceCreator()
-        {
-            ConstructorInfo constructorInfo = typeof(TInstance).GetConstructor(BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance, Type.DefaultBinder,
-                new[] { typeof(T1), typeof(T2) }, null);
-            ParameterExpression arg1Exp = Expression.Parameter(typeof(T1));
-            ParameterExpression arg2Exp = Expression.Parameter(typeof(T2));
-
-            NewExpression newExp = Expression.New(constructorInfo, arg1Exp, arg2Exp);
-            var lambdaExp = Expression.Lambda<Func<T1, T2, TInstance>>(newExp, arg1Exp, arg2Exp);
-            Create = lambdaExp.Compile();
-        }
-    }
-    internal static class InstanceCreator<T1, T2, T3, TInstance>
-    {
-        internal static Func<T1, T2, T3, TInstance> Create;
-
-        static InstanceCreator()
-        {
-            ConstructorInfo constructor = typeof(TInstance).GetConstructor(BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance, Type.DefaultBinder,
-                new[] { typeof(T1), typeof(T2), typeof(T3) }, null);
-            ParameterExpression arg1 = Expression.Parameter(typeof(T1));
-            ParameterExpression arg2 = Expression.Parameter(typeof(T2));
-            ParameterExpression arg3 = Expression.Parameter(typeof(T3));
-
-            NewExpression newExp = Expression.New(constructor, arg1, arg2, arg3);
-            var lambdaExp = Expression.Lambda<Func<T1, T2, T3, TInstance>>(newExp, arg1, arg2, arg3);
-            Create = lambdaExp.Compile();
-        }
     }
 
     #region Functions
@@ -244,6 +176,37 @@ namespace GTA.Native
         public static implicit operator InputArgument(Enum value)
         {
             // Note: The value will be boxed if the original value is a concrete enum
+            return new InputArgument(EnumToNative(value));
+        }
+
+        // String types
+        public static implicit operator InputArgument(string value)
+        {
+            return new InputArgument(value);
+        }
+        public static unsafe implicit operator InputArgument(char* value)
+        {
+            return new InputArgument(new string(value));
+        }
+
+        // Pointer types
+        public static implicit operator InputArgument(IntPtr value)
+        {
+            return new InputArgument(value);
+        }
+        public static unsafe implicit operator InputArgument(void* value)
+        {
+            return new InputArgument(new IntPtr(value));
+        }
+
+        public static implicit operator InputArgument(OutputArgument value)
+        {
+            return new InputArgument(value._storage);
+        }
+        #endregion
+
+        internal static ulong EnumToNative(Enum value)
+        {
             Type enumDataType = Enum.GetUnderlyingType(value.GetType());
             ulong ulongValue = 0;
 
@@ -280,34 +243,8 @@ namespace GTA.Native
                 ulongValue = (ulong)Convert.ToSByte(value);
             }
 
-            return new InputArgument(ulongValue);
-        }
-
-        // String types
-        public static implicit operator InputArgument(string value)
-        {
-            return new InputArgument(value);
-        }
-        public static unsafe implicit operator InputArgument(char* value)
-        {
-            return new InputArgument(new string(value));
-        }
-
-        // Pointer types
-        public static implicit operator InputArgument(IntPtr value)
-        {
-            return new InputArgument(value);
-        }
-        public static unsafe implicit operator InputArgument(void* value)
-        {
-            return new InputArgument(new IntPtr(value));
-        }
-
-        public static implicit operator InputArgument(OutputArgument value)
-        {
-            return new InputArgument(value._storage);
+            return ulongValue;
         }
-        #endregion
     }
 
     /// <summary>
@@ -473,7 +410,7 @@ namespace GTA.Native
     /// <summary>
     /// A static class which handles script function execution.
     /// </summary>
-    public static class Function
+    public static partial class Function
     {
         private const int MaxArgCount = 63;
 
@@ -1778,19 +1715,7 @@ namespace GTA.Native
 
         internal static unsafe T ReturnValueFromResultAddress<T>(ulong* result)
         {
-            // The Entity class is abstract and can't be instantiated with our InstanceCreator class as expected
-            if (IsKnownClassTypeAssignableFromINativeValueAndNotPoolObject(typeof(T)) || typeof(T).IsValueType || typeof(T).IsEnum || (typeof(T) != typeof(Entity) && typeof(T).IsSubclassOf(typeof(PoolObject))))
-            {
-                return ObjectFromNative<T>(result);
-            }
-
-            return (T)ObjectFromNative(typeof(T), result);
-        }
-
-        [MethodImpl(MethodImplOptions.AggressiveInlining)]
-        private static bool IsKnownClassTypeAssignableFromINativeValueAndNotPoolObject(Type type)
-        {
-            return type == typeof(Player) || type == typeof(Scaleform) || type == typeof(InteriorProxy);
+            return ReturnValueConverter<T>.FromNative(result);
         }
 
         /// <summary>
@@ -3046,99 +2971,6 @@ namespace GTA.Native
             return 0;
         }
         private static void ThrowExceptionForObjectToNative(object value) => throw new InvalidCastException(string.Concat("Unable to cast object of type '", value.GetType(), "' to native value"));
-
-        /// <summary>
-        /// Converts a native value to a managed object of a value type.
-        /// </summary>
-        /// <typeparam name="T">The return type. The type should be a value type.</typeparam>
-        /// <param name="value">The native value to convert.</param>
-        /// <returns>A managed object representing the input <paramref name="value"/>.</returns>
-        internal static unsafe T ObjectFromNative<T>(ulong* value)
-        {
-            if (typeof(T) == typeof(bool))
-            {
-                // Return proper boolean values (true if non-zero and false if zero)
-                bool valueBool = *value != 0;
-                return NativeHelper<T>.PtrToStructure(new IntPtr(&valueBool));
-            }
-            if (typeof(T) == typeof(IntPtr)) // Has to be before 'IsPrimitive' check
-            {
-                return InstanceCreator<long, T>.Create((long)*value);
-            }
-
-            if (typeof(T) == typeof(Vector2))
-            {
-                float* data = (float*)value;
-                return InstanceCreator<float, float, T>.Create(data[0], data[2]);
-
-            }
-            if (typeof(T) == typeof(Vector3))
-            {
-                float* data = (float*)value;
-                return InstanceCreator<float, float, float, T>.Create(data[0], data[2], data[4]);
-            }
-
-            if (typeof(T) == typeof(Model) || typeof(T) == typeof(WeaponAsset) || typeof(T) == typeof(RelationshipGroup) || typeof(T) == typeof(ShapeTestHandle) || typeof(T) == typeof(AtHashValue))
-            {
-                return InstanceCreator<int, T>.Create((int)*value);
-            }
-            if (typeof(T) == typeof(AtHashValue))
-            {
-                return InstanceCreator<uint, T>.Create((uint)*value);
-            }
-
-            if (typeof(T).IsPrimitive)
-            {
-                return NativeHelper<T>.PtrToStructure(new IntPtr(value));
-            }
-            if (typeof(T).IsEnum)
-            {
-                return NativeHelper<T>.Convert(*value);
-            }
-
-            if (IsKnownClassTypeAssignableFromINativeValueAndNotPoolObject(typeof(T)) || (typeof(T).IsSubclassOf(typeof(PoolObject)) && !typeof(T).IsAbstract))
-            {
-                return InstanceCreator<int, T>.Create((int)*value);
-            }
-
-            ThrowInvalidCastException_FailedForUnknownScriptingType(typeof(T));
-            return default;
-        }
-
-        /// <summary>
-        /// Converts a native value to a managed object of a reference type.
-        /// </summary>
-        /// <param name="type">The type to convert to. The type should be a reference type.</param>
-        /// <param name="value">The native value to convert.</param>
-        /// <returns>A managed object representing the input <paramref name="value"/>.</returns>
-        internal static unsafe object ObjectFromNative(Type type, ulong* value)
-        {
-            if (type == typeof(string))
-            {
-                return SHVDN.StringMarshal.PtrToStringUtf8(new IntPtr((char*)*value));
-            }
-
-            if (type == typeof(Entity))
-            {
-                return Entity.FromHandle((int)*value);
-            }
-            if (typeof(INativeValue).IsAssignableFrom(type))
-            {
-                // Edge case. Warning: Requires classes implementing 'INativeValue' to repeat all constructor work in the setter of 'NativeValue'
-                var result = (INativeValue)System.Runtime.Serialization.FormatterServices.GetUninitializedObject(type);
-                result.NativeValue = *value;
-
-                return result;
-            }
-
-            ThrowInvalidCastException_FailedForUnknownScriptingType(type);
-            return null;
-        }
-
-        private static void ThrowInvalidCastException_FailedForUnknownScriptingType(Type t)
-        {
-            throw new InvalidCastException(string.Concat($"Unable to cast native value to object of type '{t.FullName}'"));
-        }
     }
     #endregion
 
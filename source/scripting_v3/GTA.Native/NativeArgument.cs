@@ -0,0 +1,147 @@
+//
+// Copyright (C) 2015 crosire & kagikn & contributors
+// License: https://github.com/scripthookvdotnet/scripthookvdotnet#license
+//
+
+using System;
+
+namespace GTA.Native
+{
+    /// <summary>
+    /// An input argument passed to a script function by value.
+    /// </summary>
+    /// <remarks>
+    /// Unlike <see cref="InputArgument"/>, this is a struct, so converting a value to it doesn't allocate anything on
+    /// the managed heap. The <see cref="Function"/> overloads with fixed argument counts take this type, and since it
+    /// converts to <see cref="InputArgument"/> but not the other way around, the compiler picks them over the
+    /// <see cref="InputArgument"/> overloads whenever all the arguments can be converted to this type.
+    /// </remarks>
+    public readonly struct NativeArgument
+    {
+        internal readonly ulong _data;
+
+        /// <summary>
+        /// Initializes a new instance of the <see cref="NativeArgument"/> struct to a script function input argument.
+        /// </summary>
+        /// <param name="value">The pointer value.</param>
+        public NativeArgument(ulong value)
+        {
+            _data = value;
+        }
+        /// <summary>
+        /// Initializes a new instance of the <see cref="NativeArgument"/> struct to a script function input argument.
+        /// </summary>
+        /// <param name="value">The value.</param>
+        public NativeArgument(IntPtr value)
+        {
+            _data = (ulong)value.ToInt64();
+        }
+
+        /// <summary>
+        /// Converts the internal value of the argument to its equivalent string representation.
+        /// </summary>
+        public override string ToString()
+        {
+            return _data.ToString();
+        }
+
+        #region Implicit Conversion Operators
+        // Value types
+        public static implicit operator NativeArgument(bool value)
+        {
+            return new NativeArgument(value ? 1UL : 0UL);
+        }
+        public static implicit operator NativeArgument(byte value)
+        {
+            return new NativeArgument(value);
+        }
+        public static implicit operator NativeArgument(sbyte value)
+        {
+            return new NativeArgument((ulong)value);
+        }
+        public static implicit operator NativeArgument(short value)
+        {
+            return new NativeArgument((ulong)value);
+        }
+        public static implicit operator NativeArgument(ushort value)
+        {
+            return new NativeArgument(value);
+        }
+        public static implicit operator NativeArgument(int value)
+        {
+            return new NativeArgument((ulong)value);
+        }
+        public static implicit operator NativeArgument(uint value)
+        {
+            return new NativeArgument(value);
+        }
+        public static implicit operator NativeArgument(long value)
+        {
+            return new NativeArgument((ulong)value);
+        }
+        public static implicit operator NativeArgument(ulong value)
+        {
+            return new NativeArgument(value);
+        }
+        public static implicit operator NativeArgument(float value)
+        {
+            unsafe
+            {
+                ulong ulongValue = 0;
+                *(float*)&ulongValue = value;
+                return new NativeArgument(ulongValue);
+            }
+        }
+        public static implicit operator NativeArgument(double value)
+        {
+            unsafe
+            {
+                // Native functions don't consider any arguments as double, so convert double values to float ones
+                ulong ulongValue = 0;
+                *(float*)&ulongValue = (float)value;
+                return new NativeArgument(ulongValue);
+            }
+        }
+        public static implicit operator NativeArgument(Enum value)
+        {
+            // Note: The value will still be boxed if the original value is a concrete enum
+            return new NativeArgument(InputArgument.EnumToNative(value));
+        }
+
+        // String types
+        public static implicit operator NativeArgument(string value)
+        {
+            return new NativeArgument(Function.ObjectToNative(value));
+        }
+        public static unsafe implicit operator NativeArgument(char* value)
+        {
+            return new NativeArgument(Function.ObjectToNative(new string(value)));
+        }
+
+        // Pointer types
+        public static implicit operator NativeArgument(IntPtr value)
+        {
+            return new NativeArgument(value);
+        }
+        public static unsafe implicit operator NativeArgument(void* value)
+        {
+            return new NativeArgument(new IntPtr(value));
+        }
+
+        public static implicit operator NativeArgument(OutputArgument value)
+        {
+            return new NativeArgument(value._storage);
+        }
+
+        /// <summary>
+        /// Converts a <see cref="NativeArgument"/> to an <see cref="InputArgument"/>, so it can still be passed to
+        /// the overloads that take an <see cref="InputArgument"/> array. <see langword="null"/> is converted to zero,
+        /// the same as a <see langword="null"/> <see cref="InputArgument"/>.
+        /// </summary>
+        public static implicit operator InputArgument(NativeArgument? value)
+        {
+            return new InputArgument(value.GetValueOrDefault()._data);
+        }
+        #endregion
+    }
+}
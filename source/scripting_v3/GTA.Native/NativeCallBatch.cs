@@ -0,0 +1,119 @@
+//
+// Copyright (C) 2015 crosire & kagikn & contributors
+// License: https://github.com/scripthookvdotnet/scripthookvdotnet#license
+//
+
+namespace GTA.Native
+{
+    /// <summary>
+    /// A list of native function calls that are executed in one go.
+    /// </summary>
+    /// <remarks>
+    /// Each <see cref="Function.Call(Hash, InputArgument[])"/> from a script thread has a fixed cost for switching
+    /// to the main thread context. A batch pays that cost once for all the recorded calls, which is useful when
+    /// a script calls the same kind of natives on hundreds of entities every tick.
+    /// Calls are executed in the order they are added. Execute the batch in the same tick the calls are recorded,
+    /// since string arguments are only valid until the end of the current tick.
+    /// </remarks>
+    /// <example>
+    /// <code>
+    /// var batch = new NativeCallBatch();
+    /// foreach (Ped ped in peds)
+    /// {
+    ///     batch.Add(Hash.GET_ENTITY_HEALTH, ped);
+    /// }
+    /// batch.Execute();
+    /// for (int i = 0; i &lt; batch.Count; i++)
+    /// {
+    ///     int health = batch.GetResult&lt;int&gt;(i);
+    /// }
+    /// </code>
+    /// </example>
+    public sealed class NativeCallBatch
+    {
+        private const int MaxArgCount = 63;
+
+        private readonly SHVDN.NativeCallBatch _batch;
+
+        /// <summary>
+        /// Initializes a new instance of the <see cref="NativeCallBatch"/> class.
+        /// </summary>
+        public NativeCallBatch()
+        {
+            _batch = new SHVDN.NativeCallBatch();
+        }
+        /// <summary>
+        /// Initializes a new instance of the <see cref="NativeCallBatch"/> class that can hold the specified number
+        /// of calls without growing the internal buffers.
+        /// </summary>
+        /// <param name="capacity">The number of calls.</param>
+        public NativeCallBatch(int capacity)
+        {
+            _batch = new SHVDN.NativeCallBatch(capacity);
+        }
+
+        /// <summary>
+        /// Gets the number of recorded calls.
+        /// </summary>
+        public int Count => _batch.Count;
+
+        /// <summary>
+        /// Records a call to the specified native function.
+        /// </summary>
+        /// <param name="hash">The hashed name of the native function.</param>
+        /// <returns>The index of the call, which can be passed to <see cref="GetResult{T}(int)"/>.</returns>
+        public int Add(Hash hash)
+        {
+            unsafe
+            {
+                return _batch.Add((ulong)hash, null, 0);
+            }
+        }
+        /// <summary>
+        /// Records a call to the specified native function.
+        /// </summary>
+        /// <param name="hash">The hashed name of the native function.</param>
+        /// <param name="arguments">A list of input and output arguments to pass to the native function.</param>
+        /// <returns>The index of the call, which can be passed to <see cref="GetResult{T}(int)"/>.</returns>
+        public int Add(Hash hash, params InputArgument[] arguments)
+        {
+            unsafe
+            {
+                int argCount = arguments.Length <= MaxArgCount ? arguments.Length : MaxArgCount;
+                ulong* argPtr = stackalloc ulong[argCount];
+
+                for (int i = 0; i < argCount; ++i)
+                {
+                    argPtr[i] = arguments[i]?._data ?? 0;
+                }
+
+                return _batch.Add((ulong)hash, argPtr, argCount);
+            }
+        }
+
+        /// <summary>
+        /// Executes all recorded calls.
+        /// </summary>
+        public void Execute() => _batch.Execute();
+
+        /// <summary>
+        /// Removes all recorded calls and results, so this <see cref="NativeCallBatch"/> can be reused.
+        /// </summary>
+        public void Clear() => _batch.Clear();
+
+        /// <summary>
+        /// Gets the return value of the call at the specified index after <see cref="Execute"/> is called.
+        /// </summary>
+        /// <param name="index">The index returned by <see cref="Add(Hash, InputArgument[])"/>.</param>
+        public T GetResult<T>(int index)
+        {
+            unsafe
+            {
+                fixed (ulong* result = &_batch.GetResultRef(index))
+                {
+                    return Function.ReturnValueFromResultAddress<T>(result);
+                }
+            }
+        }
+    }
+}
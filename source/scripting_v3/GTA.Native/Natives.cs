@@ -0,0 +1,189 @@
+// This file was generated with tools/NativeWrapperGen from the native database. Do not edit it by hand.
+
+using System;
+using System.Runtime.CompilerServices;
+using GTA.Math;
+
+namespace GTA.Native
+{
+    /// <summary>
+    /// Strongly typed wrappers for native script functions.
+    /// </summary>
+    /// <remarks>
+    /// Each wrapper writes its arguments straight into a stack buffer and decodes the return value in place, so a call
+    /// doesn't box its arguments or look up a return value converter.
+    /// Parameters that are handles are passed as <see cref="int"/> and hashes as <see cref="uint"/>.
+    /// </remarks>
+    internal static unsafe class Natives
+    {
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        private static ulong* Invoke(ulong hash, ulong* args, int argCount)
+        {
+            ulong* result = SHVDN.NativeFunc.Invoke(hash, args, argCount);
+            // The result will be null when this method is called from a thread other than the main thread
+            if (result == null)
+            {
+                ThrowInvalidOperationExceptionForInvalidNativeCall();
+            }
+
+            return result;
+        }
+        private static void ThrowInvalidOperationExceptionForInvalidNativeCall() => throw new InvalidOperationException("Native.Function.Call can only be called from the main thread.");
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        private static ulong ToNative(float value)
+        {
+            ulong result = 0;
+            *(float*)&result = value;
+            return result;
+        }
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        private static ulong ToNative(bool value)
+        {
+            return value ? 1UL : 0UL;
+        }
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        private static ulong ToNative(string value)
+        {
+            // PinString returns NullString for null as Function.Call passes it, since natives may not expect a null pointer
+            return (ulong)SHVDN.ScriptDomain.CurrentDomain.PinString(value).ToInt64();
+        }
+
+        internal static bool IsVehicleDoorFullyOpen(int vehicle, int doorId)
+        {
+            ulong* args = stackalloc ulong[2];
+            args[0] = (ulong)vehicle;
+            args[1] = (ulong)doorId;
+
+            ulong* result = Invoke(0x3E933CFF7B111C22, args, 2);
+            return *result != 0;
+        }
+
+        internal static void SetVehicleDoorOpen(int vehicle, int doorId, bool loose, bool openInstantly)
+        {
+            ulong* args = stackalloc ulong[4];
+            args[0] = (ulong)vehicle;
+            args[1] = (ulong)doorId;
+            args[2] = ToNative(loose);
+            args[3] = ToNative(openInstantly);
+
+            SHVDN.NativeFunc.Invoke(0x7C65DAC73C35C862, args, 4);
+        }
+
+        internal static void SetVehicleDoorShut(int vehicle, int doorId, bool closeInstantly)
+        {
+            ulong* args = stackalloc ulong[3];
+            args[0] = (ulong)vehicle;
+            args[1] = (ulong)doorId;
+            args[2] = ToNative(closeInstantly);
+
+            SHVDN.NativeFunc.Invoke(0x93D9BD300D7789E5, args, 3);
+        }
+
+        internal static bool IsVehicleDoorDamaged(int veh, int doorID)
+        {
+            ulong* args = stackalloc ulong[2];
+            args[0] = (ulong)veh;
+            args[1] = (ulong)doorID;
+
+            ulong* result = Invoke(0xB8E181E559464527, args, 2);
+            return *result != 0;
+        }
+
+        internal static void SetDoorAllowedToBeBrokenOff(int vehicle, int doorId, bool isBreakable)
+        {
+            ulong* args = stackalloc ulong[3];
+            args[0] = (ulong)vehicle;
+            args[1] = (ulong)doorId;
+            args[2] = ToNative(isBreakable);
+
+            SHVDN.NativeFunc.Invoke(0x2FA133A4A9D37ED8, args, 3);
+        }
+
+        internal static void SetVehicleDoorBroken(int vehicle, int doorId, bool deleteDoor)
+        {
+            ulong* args = stackalloc ulong[3];
+            args[0] = (ulong)vehicle;
+            args[1] = (ulong)doorId;
+            args[2] = ToNative(deleteDoor);
+
+            SHVDN.NativeFunc.Invoke(0xD4D4F6A4AB575A33, args, 3);
+        }
+
+        internal static float GetVehicleDoorAngleRatio(int vehicle, int doorId)
+        {
+            ulong* args = stackalloc ulong[2];
+            args[0] = (ulong)vehicle;
+            args[1] = (ulong)doorId;
+
+            ulong* result = Invoke(0xFE3F9C29F7B32BD5, args, 2);
+            return *(float*)result;
+        }
+
+        internal static void SetVehicleDoorControl(int vehicle, int doorId, int speed, float angle)
+        {
+            ulong* args = stackalloc ulong[4];
+            args[0] = (ulong)vehicle;
+            args[1] = (ulong)doorId;
+            args[2] = (ulong)speed;
+            args[3] = ToNative(angle);
+
+            SHVDN.NativeFunc.Invoke(0xF2BFA0430F0A0FCB, args, 4);
+        }
+
+        internal static bool IsVehicleWindowIntact(int vehicle, int windowIndex)
+        {
+            ulong* args = stackalloc ulong[2];
+            args[0] = (ulong)vehicle;
+            args[1] = (ulong)windowIndex;
+
+            ulong* result = Invoke(0x46E571A0E20D01F1, args, 2);
+            return *result != 0;
+        }
+
+        internal static void SmashVehicleWindow(int vehicle, int windowIndex)
+        {
+            ulong* args = stackalloc ulong[2];
+            args[0] = (ulong)vehicle;
+            args[1] = (ulong)windowIndex;
+
+            SHVDN.NativeFunc.Invoke(0x9E5B5E4D2CCD2259, args, 2);
+        }
+
+        internal static void FixVehicleWindow(int vehicle, int windowIndex)
+        {
+            ulong* args = stackalloc ulong[2];
+            args[0] = (ulong)vehicle;
+            args[1] = (ulong)windowIndex;
+
+            SHVDN.NativeFunc.Invoke(0x772282EBEB95E682, args, 2);
+        }
+
+        internal static void RemoveVehicleWindow(int vehicle, int windowIndex)
+        {
+            ulong* args = stackalloc ulong[2];
+            args[0] = (ulong)vehicle;
+            args[1] = (ulong)windowIndex;
+
+            SHVDN.NativeFunc.Invoke(0xA711568EEDB43069, args, 2);
+        }
+
+        internal static void RollUpWindow(int vehicle, int windowIndex)
+        {
+            ulong* args = stackalloc ulong[2];
+            args[0] = (ulong)vehicle;
+            args[1] = (ulong)windowIndex;
+
+            SHVDN.NativeFunc.Invoke(0x602E548F46E24D59, args, 2);
+        }
+
+        internal static void RollDownWindow(int vehicle, int windowIndex)
+        {
+            ulong* args = stackalloc ulong[2];
+            args[0] = (ulong)vehicle;
+            args[1] = (ulong)windowIndex;
+
+            SHVDN.NativeFunc.Invoke(0x7AD9E6CE657D69E3, args, 2);
+        }
+    }
+}
@@ -0,0 +1,176 @@
+//
+// Copyright (C) 2015 crosire & kagikn & contributors
+// License: https://github.com/scripthookvdotnet/scripthookvdotnet#license
+//
+
+using System;
+using System.Reflection;
+using System.Reflection.Emit;
+using System.Runtime.Serialization;
+using GTA.Math;
+
+namespace GTA.Native
+{
+    /// <summary>
+    /// Reads a value of <typeparamref name="T"/> from a native result or from a native variable.
+    /// </summary>
+    internal unsafe delegate T NativeValueReader<T>(ulong* value);
+
+    /// <summary>
+    /// Holds the converter from native values to <typeparamref name="T"/>, which is resolved once per type.
+    /// </summary>
+    /// <remarks>
+    /// The type checks, the constructor lookups and the code generation all happen in the type initializer, so a
+    /// conversion is a single delegate call without any reflection.
+    /// </remarks>
+    internal static unsafe class ReturnValueConverter<T>
+    {
+        internal static readonly NativeValueReader<T> FromNative = CreateConverter();
+
+        private static NativeValueReader<T> CreateConverter()
+        {
+            Type type = typeof(T);
+
+            if (type == typeof(bool))
+            {
+                // Return proper boolean values (true if non-zero and false if zero)
+                return Cast(new NativeValueReader<bool>(value => *value != 0));
+            }
+            if (type == typeof(IntPtr)) // Has to be before 'IsPrimitive' check
+            {
+                return Cast(new NativeValueReader<IntPtr>(value => new IntPtr((long)*value)));
+            }
+            if (type == typeof(string))
+            {
+                return Cast(new NativeValueReader<string>(
+                    value => SHVDN.StringMarshal.PtrToStringUtf8(new IntPtr((char*)*value))));
+            }
+
+            // Vectors are returned as floats padded to 8 bytes
+            if (type == typeof(Vector2))
+            {
+                return Cast(new NativeValueReader<Vector2>(
+                    value => new Vector2(((float*)value)[0], ((float*)value)[2])));
+            }
+            if (type == typeof(Vector3))
+            {
+                return Cast(new NativeValueReader<Vector3>(
+                    value => new Vector3(((float*)value)[0], ((float*)value)[2], ((float*)value)[4])));
+            }
+
+            if (type == typeof(Model))
+            {
+                return Cast(new NativeValueReader<Model>(value => new Model((int)*value)));
+            }
+            if (type == typeof(WeaponAsset))
+            {
+                return Cast(new NativeValueReader<WeaponAsset>(value => new WeaponAsset((int)*value)));
+            }
+            if (type == typeof(RelationshipGroup))
+            {
+                return Cast(new NativeValueReader<RelationshipGroup>(value => new RelationshipGroup((int)*value)));
+            }
+            if (type == typeof(ShapeTestHandle))
+            {
+                return Cast(new NativeValueReader<ShapeTestHandle>(value => new ShapeTestHandle((int)*value)));
+            }
+            if (type == typeof(AtHashValue))
+            {
+                return Cast(new NativeValueReader<AtHashValue>(value => new AtHashValue((uint)*value)));
+            }
+
+            // Natives return values smaller than 8 bytes in the lower bytes, so these can be read in place
+            if (type.IsPrimitive || type.IsEnum)
+            {
+                return CreateLoadObjectReader();
+            }
+
+            // The Entity class is abstract and can't be instantiated with its constructor as expected
+            if (type == typeof(Entity))
+            {
+                return Cast(new NativeValueReader<Entity>(value => Entity.FromHandle((int)*value)));
+            }
+            if (type == typeof(Player) || type == typeof(Scaleform) || type == typeof(InteriorProxy)
+                || (type.IsSubclassOf(typeof(PoolObject)) && !type.IsAbstract))
+            {
+                return CreateHandleConstructorReader();
+            }
+            if (!type.IsValueType && !type.IsAbstract && typeof(INativeValue).IsAssignableFrom(type))
+            {
+                return CreateUninitializedObjectReader();
+            }
+
+            return value => throw new InvalidCastException(
+                $"Unable to cast native value to object of type '{typeof(T).FullName}'");
+        }
+
+        private static NativeValueReader<T> Cast<TValue>(NativeValueReader<TValue> reader)
+        {
+            // TValue is always T here, this only makes the compiler accept the conversion
+            return (NativeValueReader<T>)(object)reader;
+        }
+
+        private static NativeValueReader<T> CreateLoadObjectReader()
+        {
+            var method = new DynamicMethod("ReadNativeValue<" + typeof(T) + ">", typeof(T),
+                new[] { typeof(ulong*) }, typeof(ReturnValueConverter<T>).Module, true);
+
+            ILGenerator generator = method.GetILGenerator();
+            generator.Emit(OpCodes.Ldarg_0);
+            generator.Emit(OpCodes.Ldobj, typeof(T));
+            generator.Emit(OpCodes.Ret);
+
+            return (NativeValueReader<T>)method.CreateDelegate(typeof(NativeValueReader<T>));
+        }
+
+        private static NativeValueReader<T> CreateHandleConstructorReader()
+        {
+            ConstructorInfo constructor = typeof(T).GetConstructor(
+                BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance, Type.DefaultBinder,
+                new[] { typeof(int) }, null);
+            if (constructor == null)
+            {
+                return value => throw new InvalidCastException(
+                    $"Unable to cast native value to object of type '{typeof(T).FullName}'");
+            }
+
+            var method = new DynamicMethod("CreateFromNativeHandle<" + typeof(T) + ">", typeof(T),
+                new[] { typeof(ulong*) }, typeof(ReturnValueConverter<T>).Module, true);
+
+            ILGenerator generator = method.GetILGenerator();
+            generator.Emit(OpCodes.Ldarg_0);
+            generator.Emit(OpCodes.Ldind_I4);
+            generator.Emit(OpCodes.Newobj, constructor);
+            generator.Emit(OpCodes.Ret);
+
+            return (NativeValueReader<T>)method.CreateDelegate(typeof(NativeValueReader<T>));
+        }
+
+        private static NativeValueReader<T> CreateUninitializedObjectReader()
+        {
+            // Edge case. Warning: Requires classes implementing 'INativeValue' to repeat all constructor work in the
+            // setter of 'NativeValue'.
+            // A shallow copy of an uninitialized object is another uninitialized object, and copying one is much
+            // cheaper than going through the serialization services for each value.
+            object template = FormatterServices.GetUninitializedObject(typeof(T));
+
+            var method = new DynamicMethod("CloneUninitialized<" + typeof(T) + ">", typeof(object),
+                new[] { typeof(object) }, typeof(ReturnValueConverter<T>).Module, true);
+
+            ILGenerator generator = method.GetILGenerator();
+            generator.Emit(OpCodes.Ldarg_0);
+            generator.Emit(OpCodes.Call,
+                typeof(object).GetMethod("MemberwiseClone", BindingFlags.NonPublic | BindingFlags.Instance));
+            generator.Emit(OpCodes.Ret);
+
+            var clone = (Func<object, object>)method.CreateDelegate(typeof(Func<object, object>));
+
+            return value =>
+            {
+                var result = (INativeValue)clone(template);
+                result.NativeValue = *value;
+                return (T)result;
+            };
+        }
+    }
+}
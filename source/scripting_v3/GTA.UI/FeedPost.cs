@@ -66,6 +66,11 @@ namespace GTA.UI
             // -1 is the value when feed natives fail to create items
             return new InputArgument((ulong)(value?.Handle ?? -1));
         }
+        public static implicit operator NativeArgument(FeedPost value)
+        {
+            // -1 is the value when feed natives fail to create items
+            return new NativeArgument((ulong)(value?.Handle ?? -1));
+        }
 
         public override int GetHashCode()
         {
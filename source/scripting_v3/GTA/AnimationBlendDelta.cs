@@ -84,6 +84,10 @@ namespace GTA
         {
             return value.Value;
         }
+        public static implicit operator NativeArgument(AnimationBlendDelta value)
+        {
+            return value.Value;
+        }
 
         /// <summary>
         /// Tests for equality between two objects.
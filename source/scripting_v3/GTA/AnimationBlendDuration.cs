@@ -71,6 +71,10 @@ namespace GTA
         {
             return value.Value;
         }
+        public static implicit operator NativeArgument(AnimationBlendDuration value)
+        {
+            return value.Value;
+        }
 
         public static AnimationBlendDuration FromBlendDelta(AnimationBlendDelta blendDelta)
         {
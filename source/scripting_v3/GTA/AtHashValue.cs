@@ -176,6 +176,10 @@ namespace GTA
         {
             return new InputArgument(value.Hash);
         }
+        public static implicit operator NativeArgument(AtHashValue value)
+        {
+            return new NativeArgument(value.Hash);
+        }
         public static explicit operator AtHashValue(uint value)
         {
             return new AtHashValue(value);
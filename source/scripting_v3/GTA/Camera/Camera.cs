@@ -727,6 +727,10 @@ namespace GTA
         {
             return new InputArgument((ulong)(value?.Handle ?? 0));
         }
+        public static implicit operator NativeArgument(Camera value)
+        {
+            return new NativeArgument((ulong)(value?.Handle ?? 0));
+        }
 
         public override int GetHashCode()
         {
@@ -370,6 +370,10 @@ namespace GTA
         {
             return new InputArgument((ulong)value.Handle);
         }
+        public static implicit operator NativeArgument(Checkpoint value)
+        {
+            return new NativeArgument((ulong)value.Handle);
+        }
 
         public override int GetHashCode()
         {
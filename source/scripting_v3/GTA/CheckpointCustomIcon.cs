@@ -126,6 +126,10 @@ namespace GTA
         {
             return new InputArgument(value.NativeValue);
         }
+        public static implicit operator NativeArgument(CheckpointCustomIcon value)
+        {
+            return new NativeArgument(value.NativeValue);
+        }
 
         public override int GetHashCode()
         {
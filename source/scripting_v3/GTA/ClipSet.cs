@@ -98,6 +98,10 @@ namespace GTA
         {
             return new InputArgument(value.Name);
         }
+        public static implicit operator NativeArgument(ClipSet value)
+        {
+            return value.Name;
+        }
         public static explicit operator ClipSet(string value)
         {
             return new ClipSet(value);
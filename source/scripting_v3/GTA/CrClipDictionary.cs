@@ -110,6 +110,10 @@ namespace GTA
         {
             return new InputArgument(value.Name);
         }
+        public static implicit operator NativeArgument(CrClipDictionary value)
+        {
+            return value.Name;
+        }
         public static explicit operator CrClipDictionary(string value)
         {
             return new CrClipDictionary(value);
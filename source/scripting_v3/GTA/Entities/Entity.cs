@@ -3607,6 +3607,10 @@ namespace GTA
         {
             return new InputArgument((ulong)(value?.Handle ?? 0));
         }
+        public static implicit operator NativeArgument(Entity value)
+        {
+            return new NativeArgument((ulong)(value?.Handle ?? 0));
+        }
 
         public override int GetHashCode()
         {
@@ -1166,6 +1166,10 @@ namespace GTA
         {
             return new InputArgument((ulong)entityBone.Index);
         }
+        public static implicit operator NativeArgument(EntityBone entityBone)
+        {
+            return new NativeArgument((ulong)entityBone.Index);
+        }
 
         public override int GetHashCode()
         {
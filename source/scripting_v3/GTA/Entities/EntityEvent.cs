@@ -0,0 +1,63 @@
+//
+// Copyright (C) 2015 crosire & kagikn & contributors
+// License: https://github.com/scripthookvdotnet/scripthookvdotnet#license
+//
+
+namespace GTA
+{
+    /// <summary>
+    /// The creation or deletion of an <see cref="GTA.Entity"/>, read with an <see cref="EntityEventReader"/>.
+    /// </summary>
+    public readonly struct EntityEvent
+    {
+        private readonly SHVDN.EntityPoolEvent _poolEvent;
+
+        internal EntityEvent(in SHVDN.EntityPoolEvent poolEvent, EntityType entityType)
+        {
+            _poolEvent = poolEvent;
+            EntityType = entityType;
+        }
+
+        /// <summary>
+        /// Gets the <see cref="GTA.Entity"/> that was created or deleted.
+        /// A deleted <see cref="GTA.Entity"/> no longer exists, but is equal to the instances your script holds for it.
+        /// </summary>
+        /// <remarks>
+        /// The script handle of a created <see cref="GTA.Entity"/> is only created when this property is read, so
+        /// events whose <see cref="GTA.Entity"/> your script doesn't need don't take up script handles.
+        /// </remarks>
+        /// <value>
+        /// The <see cref="GTA.Entity"/>, or <see langword="null"/> if the created <see cref="GTA.Entity"/> has already
+        /// been deleted or the pool of script handles is full.
+        /// </value>
+        public Entity Entity
+        {
+            get
+            {
+                if (!SHVDN.ScriptDomain.CurrentDomain.TryGetEntityPoolEventHandle(in _poolEvent, out int handle)
+                    || handle == 0)
+                {
+                    return null;
+                }
+
+                switch (EntityType)
+                {
+                    case EntityType.Vehicle:
+                        return new Vehicle(handle);
+                    case EntityType.Ped:
+                        return new Ped(handle);
+                    default:
+                        return new Prop(handle);
+                }
+            }
+        }
+        /// <summary>
+        /// Gets the type of the <see cref="GTA.Entity"/>, which is still known after it has been deleted.
+        /// </summary>
+        public EntityType EntityType { get; }
+        /// <summary>
+        /// Gets whether the <see cref="GTA.Entity"/> was created, or <see langword="false"/> if it was deleted.
+        /// </summary>
+        public bool IsCreated => _poolEvent.IsCreated;
+    }
+}
@@ -0,0 +1,35 @@
+//
+// Copyright (C) 2015 crosire & kagikn & contributors
+// License: https://github.com/scripthookvdotnet/scripthookvdotnet#license
+//
+
+using System;
+
+namespace GTA
+{
+    /// <summary>
+    /// Specifies the entity pools an <see cref="EntityEventReader"/> reads the creation and deletion events of.
+    /// </summary>
+    [Flags]
+    public enum EntityEventPools
+    {
+        None = 0,
+        /// <summary>
+        /// Reads the events of <see cref="Vehicle"/>s.
+        /// </summary>
+        Vehicles = 1,
+        /// <summary>
+        /// Reads the events of <see cref="Ped"/>s.
+        /// </summary>
+        Peds = 2,
+        /// <summary>
+        /// Reads the events of <see cref="Prop"/>s, except for pickup objects.
+        /// </summary>
+        Props = 4,
+        /// <summary>
+        /// Reads the events of pickup objects, which are also <see cref="Prop"/>s.
+        /// </summary>
+        PickupObjects = 8,
+        All = Vehicles | Peds | Props | PickupObjects,
+    }
+}
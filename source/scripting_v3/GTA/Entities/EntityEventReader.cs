@@ -0,0 +1,128 @@
+//
+// Copyright (C) 2015 crosire & kagikn & contributors
+// License: https://github.com/scripthookvdotnet/scripthookvdotnet#license
+//
+
+namespace GTA
+{
+    /// <summary>
+    /// Reads the <see cref="Entity"/>s created and deleted since the last read, without scanning the entity pools in
+    /// your script.
+    /// </summary>
+    /// <remarks>
+    /// <para>
+    /// The pools are compared against the last frame once per frame and the changes are shared by all scripts, so
+    /// reading the events costs nothing when no <see cref="Entity"/> is created or deleted.
+    /// The <see cref="Entity"/>s that exist when a pool starts to be watched are reported as created in the next
+    /// frame.
+    /// </para>
+    /// <para>
+    /// Each reader keeps its own position in the events. A reader that hasn't been read for thousands of events, such
+    /// as one of a script that waits for a long time, misses the oldest events.
+    /// </para>
+    /// <para>
+    /// A created <see cref="Entity"/> only gets a script handle when <see cref="EntityEvent.Entity"/> is read, which
+    /// gives <see langword="null"/> if the <see cref="Entity"/> has already been deleted by then or the pool of script
+    /// handles is full. The deletion of an <see cref="Entity"/> whose handle no script asked for is skipped, since no
+    /// script can hold it.
+    /// </para>
+    /// </remarks>
+    /// <example>
+    /// <code>
+    /// var reader = new EntityEventReader(EntityEventPools.Peds | EntityEventPools.Vehicles);
+    /// Tick += (sender, e) =>
+    /// {
+    ///     while (reader.TryRead(out EntityEvent ev))
+    ///     {
+    ///         if (ev.IsCreated &amp;&amp; ev.EntityType == EntityType.Ped &amp;&amp; ev.Entity is Ped ped)
+    ///         {
+    ///             ped.AddBlip();
+    ///         }
+    ///     }
+    /// };
+    /// </code>
+    /// </example>
+    public sealed class EntityEventReader
+    {
+        private readonly uint _kindMask;
+        private long _cursor;
+
+        /// <summary>
+        /// Initializes a new instance of the <see cref="EntityEventReader"/> class, which reads the events published
+        /// from the next frame on.
+        /// </summary>
+        /// <param name="pools">The entity pools to read the events of.</param>
+        public EntityEventReader(EntityEventPools pools)
+        {
+            Pools = pools;
+            _kindMask = GetKindMask(pools);
+
+            SHVDN.ScriptDomain domain = SHVDN.ScriptDomain.CurrentDomain;
+            _cursor = domain.EntityPoolEventSequence;
+            domain.WatchEntityPools(_kindMask);
+        }
+
+        /// <summary>
+        /// Gets the entity pools this <see cref="EntityEventReader"/> reads the events of.
+        /// </summary>
+        public EntityEventPools Pools { get; }
+
+        /// <summary>
+        /// Reads the next event since the last read.
+        /// </summary>
+        /// <param name="ev">The event read.</param>
+        /// <returns><see langword="true"/> if an event was read; <see langword="false"/> if there are no new events.</returns>
+        public bool TryRead(out EntityEvent ev)
+        {
+            SHVDN.ScriptDomain domain = SHVDN.ScriptDomain.CurrentDomain;
+            long cursor = _cursor;
+            while (domain.TryReadEntityPoolEvent(ref cursor, out SHVDN.EntityPoolEvent poolEvent))
+            {
+                _cursor = cursor;
+                if ((_kindMask & (1u << (int)poolEvent.Pool)) == 0 || (!poolEvent.IsCreated && poolEvent.Handle == 0))
+                {
+                    continue;
+                }
+
+                switch (poolEvent.Pool)
+                {
+                    case SHVDN.NativeMemory.EntityPoolKind.Vehicle:
+                        ev = new EntityEvent(in poolEvent, EntityType.Vehicle);
+                        return true;
+                    case SHVDN.NativeMemory.EntityPoolKind.Ped:
+                        ev = new EntityEvent(in poolEvent, EntityType.Ped);
+                        return true;
+                    default:
+                        ev = new EntityEvent(in poolEvent, EntityType.Prop);
+                        return true;
+                }
+            }
+
+            ev = default;
+            return false;
+        }
+
+        private static uint GetKindMask(EntityEventPools pools)
+        {
+            uint kindMask = 0;
+            if ((pools & EntityEventPools.Vehicles) != 0)
+            {
+                kindMask |= 1u << (int)SHVDN.NativeMemory.EntityPoolKind.Vehicle;
+            }
+            if ((pools & EntityEventPools.Peds) != 0)
+            {
+                kindMask |= 1u << (int)SHVDN.NativeMemory.EntityPoolKind.Ped;
+            }
+            if ((pools & EntityEventPools.Props) != 0)
+            {
+                kindMask |= 1u << (int)SHVDN.NativeMemory.EntityPoolKind.Object;
+            }
+            if ((pools & EntityEventPools.PickupObjects) != 0)
+            {
+                kindMask |= 1u << (int)SHVDN.NativeMemory.EntityPoolKind.PickupObject;
+            }
+
+            return kindMask;
+        }
+    }
+}
@@ -0,0 +1,168 @@
+//
+// Copyright (C) 2015 crosire & kagikn & contributors
+// License: https://github.com/scripthookvdotnet/scripthookvdotnet#license
+//
+
+using System;
+using System.Collections.Generic;
+using GTA.Math;
+
+namespace GTA
+{
+    /// <summary>
+    /// Holds the states of many <see cref="Entity"/>s in a separate array per field, read straight from the game
+    /// memory in a single pass without calling any native function.
+    /// </summary>
+    /// <remarks>
+    /// Reading <see cref="Entity.Position"/>, <see cref="Entity.Heading"/> and <see cref="Entity.Model"/> of 200
+    /// entities one by one costs 600 native calls. Create a buffer once and reuse it every tick, so reading the states
+    /// doesn't allocate anything either.
+    /// </remarks>
+    /// <example>
+    /// <code>
+    /// var buffer = new EntityStateBuffer(256);
+    /// Ped[] peds = World.GetNearbyPeds(Game.Player.Character, 50f);
+    /// int count = buffer.Read(peds, EntityStateFields.Position | EntityStateFields.Health);
+    /// for (int i = 0; i &lt; count; i++)
+    /// {
+    ///     if (buffer.Exists[i] &amp;&amp; buffer.Healths[i] &lt; 100f)
+    ///     {
+    ///         World.DrawLine(Game.Player.Character.Position, buffer.Positions[i], Color.Red);
+    ///     }
+    /// }
+    /// </code>
+    /// </example>
+    public sealed class EntityStateBuffer
+    {
+        private readonly int[] _handles;
+
+        /// <summary>
+        /// Initializes a new instance of the <see cref="EntityStateBuffer"/> class.
+        /// </summary>
+        /// <param name="capacity">The max number of <see cref="Entity"/>s a read can take.</param>
+        public EntityStateBuffer(int capacity)
+        {
+            if (capacity < 0)
+            {
+                ThrowHelper.ThrowArgumentOutOfRangeException(nameof(capacity));
+            }
+
+            _handles = new int[capacity];
+            Exists = new bool[capacity];
+            Positions = new Vector3[capacity];
+            Headings = new float[capacity];
+            Healths = new float[capacity];
+            MaxHealths = new float[capacity];
+            ModelHashes = new int[capacity];
+        }
+
+        /// <summary>
+        /// Gets the max number of <see cref="Entity"/>s a read can take.
+        /// </summary>
+        public int Capacity => _handles.Length;
+
+        /// <summary>
+        /// Gets the number of <see cref="Entity"/>s the last read took.
+        /// </summary>
+        public int Count { get; private set; }
+
+        /// <summary>
+        /// Gets whether each <see cref="Entity"/> existed at the last read. The other fields of an
+        /// <see cref="Entity"/> that didn't exist are zero.
+        /// </summary>
+        public bool[] Exists { get; }
+        /// <summary>
+        /// Gets the positions read with <see cref="EntityStateFields.Position"/>.
+        /// </summary>
+        public Vector3[] Positions { get; }
+        /// <summary>
+        /// Gets the headings in degrees read with <see cref="EntityStateFields.Heading"/>.
+        /// </summary>
+        public float[] Headings { get; }
+        /// <summary>
+        /// Gets the health values read with <see cref="EntityStateFields.Health"/>.
+        /// </summary>
+        public float[] Healths { get; }
+        /// <summary>
+        /// Gets the max health values read with <see cref="EntityStateFields.MaxHealth"/>.
+        /// </summary>
+        public float[] MaxHealths { get; }
+        /// <summary>
+        /// Gets the model hashes read with <see cref="EntityStateFields.Model"/>.
+        /// </summary>
+        public int[] ModelHashes { get; }
+
+        /// <summary>
+        /// Reads the states of <see cref="Entity"/>s into this buffer. The element at an index of each array is for
+        /// the <see cref="Entity"/> at the same index.
+        /// </summary>
+        /// <param name="entities">The <see cref="Entity"/>s to read. <see langword="null"/> elements are read as ones that don't exist.</param>
+        /// <param name="fields">The fields to read. The arrays of the other fields are left as they are.</param>
+        /// <returns>The number of <see cref="Entity"/>s read, which is <see cref="Count"/>.</returns>
+        /// <exception cref="ArgumentException"><paramref name="entities"/> has more elements than <see cref="Capacity"/>.</exception>
+        public int Read(IReadOnlyList<Entity> entities, EntityStateFields fields)
+        {
+            if (entities == null)
+            {
+                ThrowHelper.ThrowArgumentNullException(nameof(entities));
+            }
+
+            int count = entities.Count;
+            if (count > _handles.Length)
+            {
+                ThrowHelper.ThrowArgumentException("The buffer does not have enough capacity for all the entities.", nameof(entities));
+            }
+
+            for (int i = 0; i < count; i++)
+            {
+                _handles[i] = entities[i]?.Handle ?? 0;
+            }
+
+            return ReadInternal(count, fields);
+        }
+        /// <summary>
+        /// Reads the states of <see cref="Entity"/>s by their handles into this buffer. The element at an index of
+        /// each array is for the handle at the same index.
+        /// </summary>
+        /// <param name="handles">The handles of the <see cref="Entity"/>s to read.</param>
+        /// <param name="count">The number of handles to read from the start of <paramref name="handles"/>.</param>
+        /// <param name="fields">The fields to read. The arrays of the other fields are left as they are.</param>
+        /// <returns>The number of <see cref="Entity"/>s read, which is <see cref="Count"/>.</returns>
+        public int Read(int[] handles, int count, EntityStateFields fields)
+        {
+            if (handles == null)
+            {
+                ThrowHelper.ThrowArgumentNullException(nameof(handles));
+            }
+            if ((uint)count > (uint)handles.Length || count > _handles.Length)
+            {
+                ThrowHelper.ThrowArgumentOutOfRangeException(nameof(count));
+            }
+
+            Array.Copy(handles, _handles, count);
+            return ReadInternal(count, fields);
+        }
+
+        private unsafe int ReadInternal(int count, EntityStateFields fields)
+        {
+            fixed (int* handles = _handles)
+            fixed (bool* exists = Exists)
+            fixed (Vector3* positions = Positions)
+            fixed (float* headings = Headings)
+            fixed (float* healths = Healths)
+            fixed (float* maxHealths = MaxHealths)
+            fixed (int* modelHashes = ModelHashes)
+            {
+                SHVDN.NativeMemory.ReadEntityStates(handles, count, exists,
+                    (fields & EntityStateFields.Position) != 0 ? (SHVDN.FVector3*)positions : null,
+                    (fields & EntityStateFields.Heading) != 0 ? headings : null,
+                    (fields & EntityStateFields.Health) != 0 ? healths : null,
+                    (fields & EntityStateFields.MaxHealth) != 0 ? maxHealths : null,
+                    (fields & EntityStateFields.Model) != 0 ? modelHashes : null);
+            }
+
+            Count = count;
+            return count;
+        }
+    }
+}
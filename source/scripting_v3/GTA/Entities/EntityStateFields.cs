@@ -0,0 +1,40 @@
+//
+// Copyright (C) 2015 crosire & kagikn & contributors
+// License: https://github.com/scripthookvdotnet/scripthookvdotnet#license
+//
+
+using System;
+
+namespace GTA
+{
+    /// <summary>
+    /// Specifies the fields <see cref="EntityStateBuffer.Read(System.Collections.Generic.IReadOnlyList{Entity}, EntityStateFields)"/> reads.
+    /// </summary>
+    [Flags]
+    public enum EntityStateFields
+    {
+        None = 0,
+        /// <summary>
+        /// Reads the positions the same as <see cref="Entity.Position"/>.
+        /// </summary>
+        Position = 1,
+        /// <summary>
+        /// Reads the headings the same as <see cref="Entity.Heading"/>.
+        /// </summary>
+        Heading = 2,
+        /// <summary>
+        /// Reads the health values the same as <see cref="Entity.HealthFloat"/>.
+        /// </summary>
+        Health = 4,
+        /// <summary>
+        /// Reads the max health values the same as <see cref="Entity.MaxHealthFloat"/>, without the special treatment
+        /// for the player ped(s).
+        /// </summary>
+        MaxHealth = 8,
+        /// <summary>
+        /// Reads the model hashes the same as <see cref="Entity.Model"/>.
+        /// </summary>
+        Model = 16,
+        All = Position | Heading | Health | MaxHealth | Model,
+    }
+}
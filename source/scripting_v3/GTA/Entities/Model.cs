@@ -497,6 +497,57 @@ namespace GTA
             Function.Call(Native.Hash.SET_MODEL_AS_NO_LONGER_NEEDED, Hash);
         }
 
+        /// <summary>
+        /// Classifies many models at once without calling any native function, which is much faster than checking the
+        /// properties of each <see cref="Model"/> when filtering a lot of models every frame.
+        /// </summary>
+        /// <param name="modelHashes">The hashes of the models to classify.</param>
+        /// <param name="classes">
+        /// The array to write the classes of the models to, which must be at least as long as <paramref name="modelHashes"/>.
+        /// Models that don't exist get <see cref="ModelClassFlags.None"/>.
+        /// </param>
+        /// <param name="vehicleTypes">
+        /// The array to write the vehicle types of the models to, or <see langword="null"/> if they are not needed.
+        /// Models that are not vehicles get <see cref="VehicleType.None"/>.
+        /// </param>
+        /// <returns>The number of models that exist.</returns>
+        /// <exception cref="ArgumentNullException"><paramref name="modelHashes"/> or <paramref name="classes"/> is <see langword="null"/>.</exception>
+        /// <exception cref="ArgumentException">An output array is shorter than <paramref name="modelHashes"/>.</exception>
+        public static int Classify(int[] modelHashes, ModelClassFlags[] classes, VehicleType[] vehicleTypes = null)
+        {
+            if (modelHashes == null)
+            {
+                throw new ArgumentNullException(nameof(modelHashes));
+            }
+            if (classes == null)
+            {
+                throw new ArgumentNullException(nameof(classes));
+            }
+            if (classes.Length < modelHashes.Length)
+            {
+                throw new ArgumentException("The array is shorter than the model hash array.", nameof(classes));
+            }
+            if (vehicleTypes != null && vehicleTypes.Length < modelHashes.Length)
+            {
+                throw new ArgumentException("The array is shorter than the model hash array.", nameof(vehicleTypes));
+            }
+            if (modelHashes.Length == 0)
+            {
+                return 0;
+            }
+
+            unsafe
+            {
+                fixed (int* modelHashesPtr = modelHashes)
+                fixed (ModelClassFlags* classesPtr = classes)
+                fixed (VehicleType* vehicleTypesPtr = vehicleTypes)
+                {
+                    return SHVDN.NativeMemory.ClassifyModels(modelHashesPtr, modelHashes.Length,
+                        (SHVDN.ModelClassFlags*)classesPtr, (int*)vehicleTypesPtr);
+                }
+            }
+        }
+
         public bool Equals(Model model)
         {
             return Hash == model.Hash;
@@ -562,6 +613,10 @@ namespace GTA
         {
             return new InputArgument((ulong)value.Hash);
         }
+        public static implicit operator NativeArgument(Model value)
+        {
+            return new NativeArgument((ulong)value.Hash);
+        }
 
         public override int GetHashCode()
         {
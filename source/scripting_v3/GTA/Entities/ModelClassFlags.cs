@@ -0,0 +1,70 @@
+//
+// Copyright (C) 2015 crosire & kagikn & contributors
+// License: https://github.com/scripthookvdotnet/scripthookvdotnet#license
+//
+
+using System;
+
+namespace GTA
+{
+    /// <summary>
+    /// Specifies the classes of a model <see cref="Model.Classify(int[], ModelClassFlags[], VehicleType[])"/> reports.
+    /// </summary>
+    [Flags]
+    public enum ModelClassFlags : uint
+    {
+        None = 0,
+        /// <summary>
+        /// The model has a model info registered in the game.
+        /// </summary>
+        Exists = 1 << 0,
+        /// <summary>
+        /// The model is a prop that is neither a weapon nor a time-dependent prop.
+        /// </summary>
+        Object = 1 << 1,
+        /// <summary>
+        /// The model is an interior, the same as <see cref="Model.IsMlo"/>.
+        /// </summary>
+        Mlo = 1 << 2,
+        /// <summary>
+        /// The model is a prop that is only shown at certain hours.
+        /// </summary>
+        Time = 1 << 3,
+        /// <summary>
+        /// The model is a weapon prop.
+        /// </summary>
+        Weapon = 1 << 4,
+        /// <summary>
+        /// The model is a vehicle, the same as <see cref="Model.IsVehicle"/>.
+        /// </summary>
+        Vehicle = 1 << 5,
+        /// <summary>
+        /// The model is a ped, the same as <see cref="Model.IsPed"/>.
+        /// </summary>
+        Ped = 1 << 6,
+        /// <summary>
+        /// The model is a fragment, the same as <see cref="Model.IsFragment"/>.
+        /// </summary>
+        Fragment = 1 << 7,
+        /// <summary>
+        /// The model is a male ped, the same as <see cref="Model.IsMalePed"/>.
+        /// </summary>
+        MalePed = 1 << 8,
+        /// <summary>
+        /// The model is a female ped, the same as <see cref="Model.IsFemalePed"/>.
+        /// </summary>
+        FemalePed = 1 << 9,
+        /// <summary>
+        /// The model is a human ped, the same as <see cref="Model.IsHumanPed"/>.
+        /// </summary>
+        HumanPed = 1 << 10,
+        /// <summary>
+        /// The model is an animal ped, the same as <see cref="Model.IsAnimalPed"/>.
+        /// </summary>
+        AnimalPed = 1 << 11,
+        /// <summary>
+        /// The model is a gang ped, the same as <see cref="Model.IsGangPed"/>.
+        /// </summary>
+        GangPed = 1 << 12,
+    }
+}
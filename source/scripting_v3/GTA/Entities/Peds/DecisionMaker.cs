@@ -96,6 +96,10 @@ namespace GTA
         {
             return new InputArgument((ulong)value.Hash);
         }
+        public static implicit operator NativeArgument(DecisionMaker value)
+        {
+            return new NativeArgument((ulong)value.Hash);
+        }
 
         public override int GetHashCode()
         {
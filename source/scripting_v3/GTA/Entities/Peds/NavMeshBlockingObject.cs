@@ -124,6 +124,10 @@ namespace GTA
         {
             return new InputArgument((ulong)value.Handle);
         }
+        public static implicit operator NativeArgument(NavMeshBlockingObject value)
+        {
+            return new NativeArgument((ulong)value.Handle);
+        }
 
         public override int GetHashCode()
         {
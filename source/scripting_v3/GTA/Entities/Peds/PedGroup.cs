@@ -344,6 +344,10 @@ namespace GTA
         {
             return new InputArgument((ulong)value.Handle);
         }
+        public static implicit operator NativeArgument(PedGroup value)
+        {
+            return new NativeArgument((ulong)value.Handle);
+        }
 
         public override int GetHashCode()
         {
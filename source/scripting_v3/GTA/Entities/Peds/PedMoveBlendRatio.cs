@@ -49,6 +49,10 @@ namespace GTA
         {
             return value.Value;
         }
+        public static implicit operator NativeArgument(PedMoveBlendRatio value)
+        {
+            return value.Value;
+        }
 
         /// <summary>
         /// Tests for equality between two objects.
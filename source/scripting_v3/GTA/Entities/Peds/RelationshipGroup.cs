@@ -122,6 +122,10 @@ namespace GTA
         {
             return new InputArgument((ulong)value.Hash);
         }
+        public static implicit operator NativeArgument(RelationshipGroup value)
+        {
+            return new NativeArgument((ulong)value.Hash);
+        }
 
         public override int GetHashCode()
         {
@@ -27,34 +27,34 @@ namespace GTA
 
         public bool IsOpen => AngleRatio > 0;
 
-        public bool IsFullyOpen => Function.Call<bool>(Hash.IS_VEHICLE_DOOR_FULLY_OPEN, Vehicle.Handle, Index);
+        public bool IsFullyOpen => Natives.IsVehicleDoorFullyOpen(Vehicle.Handle, (int)Index);
 
         public void Open(bool loose = false, bool instantly = false)
         {
-            Function.Call(Hash.SET_VEHICLE_DOOR_OPEN, Vehicle.Handle, (int)Index, loose, instantly);
+            Natives.SetVehicleDoorOpen(Vehicle.Handle, (int)Index, loose, instantly);
         }
 
         public void Close(bool instantly = false)
         {
-            Function.Call(Hash.SET_VEHICLE_DOOR_SHUT, Vehicle.Handle, (int)Index, instantly);
+            Natives.SetVehicleDoorShut(Vehicle.Handle, (int)Index, instantly);
         }
 
-        public bool IsBroken => Function.Call<bool>(Hash.IS_VEHICLE_DOOR_DAMAGED, Vehicle.Handle, (int)Index);
+        public bool IsBroken => Natives.IsVehicleDoorDamaged(Vehicle.Handle, (int)Index);
 
         public bool CanBeBroken
         {
-            set => Function.Call(Hash.SET_DOOR_ALLOWED_TO_BE_BROKEN_OFF, Vehicle.Handle, (int)Index, value);
+            set => Natives.SetDoorAllowedToBeBrokenOff(Vehicle.Handle, (int)Index, value);
         }
 
         public void Break(bool stayInTheWorld = true)
         {
-            Function.Call(Hash.SET_VEHICLE_DOOR_BROKEN, Vehicle.Handle, (int)Index, !stayInTheWorld);
+            Natives.SetVehicleDoorBroken(Vehicle.Handle, (int)Index, !stayInTheWorld);
         }
 
         public float AngleRatio
         {
-            get => Function.Call<float>(Hash.GET_VEHICLE_DOOR_ANGLE_RATIO, Vehicle.Handle, (int)Index);
-            set => Function.Call(Hash.SET_VEHICLE_DOOR_CONTROL, Vehicle.Handle, (int)Index, 1, value);
+            get => Natives.GetVehicleDoorAngleRatio(Vehicle.Handle, (int)Index);
+            set => Natives.SetVehicleDoorControl(Vehicle.Handle, (int)Index, 1, value);
         }
     }
 }
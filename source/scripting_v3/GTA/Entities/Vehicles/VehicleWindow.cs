@@ -25,31 +25,31 @@ namespace GTA
             get;
         }
 
-        public bool IsIntact => Function.Call<bool>(Hash.IS_VEHICLE_WINDOW_INTACT, Vehicle.Handle, (int)Index);
+        public bool IsIntact => Natives.IsVehicleWindowIntact(Vehicle.Handle, (int)Index);
 
         public void Smash()
         {
-            Function.Call(Hash.SMASH_VEHICLE_WINDOW, Vehicle.Handle, (int)Index);
+            Natives.SmashVehicleWindow(Vehicle.Handle, (int)Index);
         }
 
         public void Repair()
         {
-            Function.Call(Hash.FIX_VEHICLE_WINDOW, Vehicle.Handle, (int)Index);
+            Natives.FixVehicleWindow(Vehicle.Handle, (int)Index);
         }
 
         public void Remove()
         {
-            Function.Call(Hash.REMOVE_VEHICLE_WINDOW, Vehicle.Handle, (int)Index);
+            Natives.RemoveVehicleWindow(Vehicle.Handle, (int)Index);
         }
 
         public void RollUp()
         {
-            Function.Call(Hash.ROLL_UP_WINDOW, Vehicle.Handle, (int)Index);
+            Natives.RollUpWindow(Vehicle.Handle, (int)Index);
         }
 
         public void RollDown()
         {
-            Function.Call(Hash.ROLL_DOWN_WINDOW, Vehicle.Handle, (int)Index);
+            Natives.RollDownWindow(Vehicle.Handle, (int)Index);
         }
     }
 }
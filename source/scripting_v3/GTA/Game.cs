@@ -502,6 +502,62 @@ namespace GTA
             return SHVDN.ScriptDomain.CurrentDomain.IsKeyPressed(key);
         }
         /// <summary>
+        /// Gets whether the specified key went down since the last frame, even if it has already been released.
+        /// </summary>
+        /// <param name="key">The key to check. Keys with an integer value greater than 255 will throw an <see cref="IndexOutOfRangeException"/>.</param>
+        public static bool IsKeyJustPressed(Keys key)
+        {
+            return SHVDN.ScriptDomain.CurrentDomain.IsKeyJustPressed(key);
+        }
+        /// <summary>
+        /// Gets whether the specified key went up since the last frame.
+        /// </summary>
+        /// <param name="key">The key to check. Keys with an integer value greater than 255 will throw an <see cref="IndexOutOfRangeException"/>.</param>
+        public static bool IsKeyJustReleased(Keys key)
+        {
+            return SHVDN.ScriptDomain.CurrentDomain.IsKeyJustReleased(key);
+        }
+        /// <summary>
+        /// Gets whether all the specified keys are currently held down, such as <c>Keys.Control, Keys.R</c> for a
+        /// hotkey. <see cref="Keys.Shift"/>, <see cref="Keys.Control"/> and <see cref="Keys.Alt"/> can be used here.
+        /// </summary>
+        /// <param name="keys">The keys of the chord.</param>
+        /// <returns><see langword="true"/> if all the keys are pressed; otherwise, <see langword="false"/>.</returns>
+        /// <remarks>
+        /// A <see langword="params"/> call allocates a new array every time. When checking a chord of more than three
+        /// keys every frame, pass an array cached in a field instead.
+        /// </remarks>
+        public static bool AreKeysPressed(params Keys[] keys)
+        {
+            if (keys == null)
+            {
+                ThrowHelper.ThrowArgumentNullException(nameof(keys));
+            }
+
+            return SHVDN.ScriptDomain.CurrentDomain.IsChordPressed(SHVDN.KeyboardState.FromChord(keys));
+        }
+        /// <summary>
+        /// Gets whether both the specified keys are currently held down, such as <c>Keys.Control, Keys.R</c>.
+        /// </summary>
+        /// <param name="key1">The first key of the chord.</param>
+        /// <param name="key2">The second key of the chord.</param>
+        /// <returns><see langword="true"/> if both keys are pressed; otherwise, <see langword="false"/>.</returns>
+        public static bool AreKeysPressed(Keys key1, Keys key2)
+        {
+            return SHVDN.ScriptDomain.CurrentDomain.IsChordPressed(SHVDN.KeyboardState.FromChord(key1, key2));
+        }
+        /// <summary>
+        /// Gets whether all three specified keys are currently held down, such as <c>Keys.Control, Keys.Shift, Keys.R</c>.
+        /// </summary>
+        /// <param name="key1">The first key of the chord.</param>
+        /// <param name="key2">The second key of the chord.</param>
+        /// <param name="key3">The third key of the chord.</param>
+        /// <returns><see langword="true"/> if all the keys are pressed; otherwise, <see langword="false"/>.</returns>
+        public static bool AreKeysPressed(Keys key1, Keys key2, Keys key3)
+        {
+            return SHVDN.ScriptDomain.CurrentDomain.IsChordPressed(SHVDN.KeyboardState.FromChord(key1, key2, key3));
+        }
+        /// <summary>
         /// Gets whether a <see cref="Control"/> is currently pressed/down.
         /// </summary>
         /// <param name="control">The <see cref="Control"/> to check.</param>
@@ -252,6 +252,11 @@ namespace GTA
             //we only need to worry about supplying a particle effect to a native, never returning one
             return new InputArgument((ulong)effect.Handle);
         }
+        public static implicit operator NativeArgument(ParticleEffect effect)
+        {
+            //we only need to worry about supplying a particle effect to a native, never returning one
+            return new NativeArgument((ulong)effect.Handle);
+        }
 
         public override int GetHashCode()
         {
@@ -140,6 +140,10 @@ namespace GTA
         {
             return new InputArgument(asset.AssetName);
         }
+        public static implicit operator NativeArgument(ParticleEffectAsset asset)
+        {
+            return asset.AssetName;
+        }
 
         public override int GetHashCode()
         {
@@ -182,6 +182,10 @@ namespace GTA
         {
             return new InputArgument((ulong)value.Handle);
         }
+        public static implicit operator NativeArgument(Rope value)
+        {
+            return new NativeArgument((ulong)value.Handle);
+        }
 
         public override int GetHashCode()
         {
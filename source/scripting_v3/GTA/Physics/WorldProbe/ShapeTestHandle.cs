@@ -188,6 +188,10 @@ namespace GTA
         {
             return new InputArgument((ulong)value.Handle);
         }
+        public static implicit operator NativeArgument(ShapeTestHandle value)
+        {
+            return new NativeArgument((ulong)value.Handle);
+        }
 
         public override int GetHashCode()
         {
@@ -203,5 +203,9 @@ namespace GTA
         {
             return new InputArgument((ulong)value.Handle);
         }
+        public static implicit operator NativeArgument(Scaleform value)
+        {
+            return new NativeArgument((ulong)value.Handle);
+        }
     }
 }
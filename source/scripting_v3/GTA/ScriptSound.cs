@@ -171,6 +171,10 @@ namespace GTA
         {
             return new InputArgument((ulong)value.Id);
         }
+        public static implicit operator NativeArgument(ScriptSound value)
+        {
+            return new NativeArgument((ulong)value.Id);
+        }
 
         public override int GetHashCode()
         {
@@ -5,6 +5,8 @@
 
 using System;
 using System.IO;
+using System.Threading;
+using System.Threading.Tasks;
 using WinForms = System.Windows.Forms;
 
 namespace GTA
@@ -241,6 +243,33 @@ namespace GTA
             SHVDN.ScriptDomain.CurrentDomain.LookupScript(this).Abort();
         }
 
+        /// <summary>
+        /// Starts a job that runs pure managed work, such as path finding over data collected in a tick, in a worker
+        /// thread of the script domain. Use this instead of creating your own threads, which can outlive the game.
+        /// </summary>
+        /// <remarks>
+        /// The work must not call native functions or access the game memory. The job is canceled when this
+        /// <see cref="Script"/> is aborted, so long-running work should check the token it is passed.
+        /// </remarks>
+        /// <typeparam name="T">The type of the result of the work.</typeparam>
+        /// <param name="work">The work to run.</param>
+        /// <param name="completed">
+        /// The callback invoked after the job completes, right before the next <see cref="Tick"/> event of this
+        /// <see cref="Script"/> is raised.
+        /// </param>
+        public ScriptJob<T> StartJob<T>(Func<CancellationToken, T> work, Action<ScriptJob<T>> completed = null)
+        {
+            if (work == null)
+            {
+                ThrowHelper.ThrowArgumentNullException(nameof(work));
+            }
+
+            var job = new ScriptJob<T>();
+            job._job = SHVDN.ScriptDomain.CurrentDomain.LookupScript(this).StartJob(
+                token => work(token), completed != null ? _ => completed(job) : null);
+            return job;
+        }
+
         /// <summary>
         /// Pause execution of this <see cref="Script"/>.
         /// </summary>
@@ -261,11 +290,16 @@ namespace GTA
         /// Pauses execution of the <see cref="Script"/> for at least a specific amount of time.
         /// Must be called inside the main script loop (the <see cref="Tick"/> event or any sub methods called from it).
         /// </summary>
+        /// <remarks>
+        /// In scripts that have <see cref="ScriptAttributes.CooperativeAsync"/> set, this method sleeps the main thread
+        /// of the script domain and so blocks the other scripts and the game for the duration.
+        /// Use <see cref="WaitAsync(int)"/> in those scripts instead.
+        /// </remarks>
         /// <param name="ms">The minimum amount of time in milliseconds to pause for.</param>
         public static void Wait(int ms)
         {
             SHVDN.Script script = SHVDN.ScriptDomain.ExecutingScript;
-            if (script == null || !script.IsRunning || !script.IsUsingThread)
+            if (script == null || !script.IsRunning || (!script.IsUsingThread && !script.IsCooperative))
             {
                 ThrowHelper.ThrowInvalidOperationException("Illegal call to 'Script.Wait()' outside main loop!");
             }
@@ -280,6 +314,31 @@ namespace GTA
             Wait(0);
         }
 
+        /// <summary>
+        /// Returns a task that completes after at least a specific amount of time, in a later frame.
+        /// Can only be used in scripts that have <see cref="ScriptAttributes.CooperativeAsync"/> set.
+        /// The script resumes in the main thread of the script domain after awaiting the task.
+        /// </summary>
+        /// <param name="ms">The minimum amount of time in milliseconds to pause for.</param>
+        public static Task WaitAsync(int ms)
+        {
+            SHVDN.Script script = SHVDN.ScriptDomain.ExecutingScript;
+            if (script == null || !script.IsRunning || !script.IsCooperative)
+            {
+                ThrowHelper.ThrowInvalidOperationException("Illegal call to 'Script.WaitAsync()' outside a cooperative script!");
+            }
+
+            return script.WaitAsync(ms);
+        }
+        /// <summary>
+        /// Returns a task that completes in the next frame.
+        /// Can only be used in scripts that have <see cref="ScriptAttributes.CooperativeAsync"/> set.
+        /// </summary>
+        public static Task YieldAsync()
+        {
+            return WaitAsync(0);
+        }
+
         /// <summary>
         /// Spawns a new <see cref="Script"/> instance of the specified type.
         /// </summary>
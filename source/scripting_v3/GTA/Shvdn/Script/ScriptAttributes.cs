@@ -14,6 +14,23 @@ namespace GTA
         On
     }
 
+    /// <summary>
+    /// Specifies the priority of a script, which is used when a frame budget is set in <c>ScriptHookVDotNet.ini</c>.
+    /// </summary>
+    public enum ScriptPriority
+    {
+        /// <summary>
+        /// The script runs after the other scripts, and may be deferred to the next frame when the scripts in the
+        /// frame have used up the budget.
+        /// </summary>
+        Low = -1,
+        Normal = 0,
+        /// <summary>
+        /// The script runs before the other scripts.
+        /// </summary>
+        High = 1
+    }
+
     [AttributeUsage(AttributeTargets.Class, AllowMultiple = false)]
     public sealed class ScriptAttributes : Attribute
     {
@@ -21,6 +38,28 @@ namespace GTA
         public string SupportURL;
         public bool NoScriptThread;
         public bool NoDefaultInstance;
+        /// <summary>
+        /// Determines whether the script runs cooperatively in the main thread of the script domain instead of in its
+        /// own thread. Cooperative scripts pause with <see cref="Script.WaitAsync(int)"/> instead of
+        /// <see cref="Script.Wait(int)"/>, and can use <see langword="async"/> tick handlers.
+        /// </summary>
+        /// <remarks>
+        /// The <see cref="Script.Tick"/> event is not raised again while an <see langword="async"/> tick handler
+        /// is still awaiting. Takes priority over <see cref="NoScriptThread"/>.
+        /// <see cref="Script.Wait(int)"/> and <see cref="Script.Yield"/>, which the API helpers that load resources
+        /// (such as <see cref="Model.Request(int)"/>) call, sleep the main thread of the script domain in these scripts
+        /// and so block the other scripts while they wait.
+        /// </remarks>
+        public bool CooperativeAsync;
+        /// <summary>
+        /// Determines the priority of the script, which is set to <see cref="ScriptPriority.Normal"/> by default.
+        /// </summary>
+        /// <remarks>
+        /// Only takes effect when <c>ScriptFrameBudget</c> is set in <c>ScriptHookVDotNet.ini</c>.
+        /// Set this to <see cref="ScriptPriority.Low"/> for background scripts that can tolerate running a few frames
+        /// late, so they don't cause frame time spikes.
+        /// </remarks>
+        public ScriptPriority Priority;
 
         private AbortScriptMode _nativeCallResetsTimeout;
 
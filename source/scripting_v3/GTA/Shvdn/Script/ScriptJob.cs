@@ -0,0 +1,70 @@
+//
+// Copyright (C) 2015 crosire & kagikn & contributors
+// License: https://github.com/scripthookvdotnet/scripthookvdotnet#license
+//
+
+using System;
+
+namespace GTA
+{
+    /// <summary>
+    /// Represents a job started with <see cref="Script.StartJob{T}(Func{System.Threading.CancellationToken, T}, Action{ScriptJob{T}})"/>,
+    /// which runs pure managed work in a worker thread.
+    /// </summary>
+    /// <remarks>
+    /// The state of the job only changes right before the <see cref="Script.Tick"/> event of the script that started
+    /// it is raised, so you can check <see cref="IsCompleted"/> and read <see cref="Result"/> in the tick without any
+    /// synchronization.
+    /// </remarks>
+    /// <typeparam name="T">The type of the result of the job.</typeparam>
+    public sealed class ScriptJob<T>
+    {
+        internal SHVDN.ScriptJob _job;
+
+        internal ScriptJob()
+        {
+        }
+
+        /// <summary>
+        /// Gets whether this job has finished, whether it succeeded, threw an exception or was canceled.
+        /// </summary>
+        public bool IsCompleted => _job.IsCompleted;
+        /// <summary>
+        /// Gets whether this job was canceled with <see cref="Cancel"/> before it finished.
+        /// </summary>
+        public bool IsCanceled => _job.IsCanceled;
+        /// <summary>
+        /// Gets whether the work of this job threw an exception.
+        /// </summary>
+        public bool IsFaulted => _job.Exception != null;
+        /// <summary>
+        /// Gets the exception the work of this job threw, or <see langword="null"/> if it didn't throw one.
+        /// </summary>
+        public Exception Exception => _job.Exception;
+
+        /// <summary>
+        /// Gets the value the work of this job returned.
+        /// </summary>
+        /// <exception cref="InvalidOperationException">
+        /// The job has not completed yet, or it was canceled or threw an exception.
+        /// </exception>
+        public T Result
+        {
+            get
+            {
+                if (!_job.IsCompleted || _job.IsCanceled || _job.Exception != null)
+                {
+                    ThrowHelper.ThrowInvalidOperationException("The job has not completed successfully.");
+                }
+
+                return _job.Result is T result ? result : default;
+            }
+        }
+
+        /// <summary>
+        /// Requests this job to stop. The work sees the request through the token it was passed.
+        /// Must be called in the script that started the job.
+        /// </summary>
+        public void Cancel() => _job.Cancel();
+    }
+}
@@ -188,6 +188,10 @@ namespace GTA
         {
             return new InputArgument((ulong)value.Hash);
         }
+        public static implicit operator NativeArgument(WeaponAsset value)
+        {
+            return new NativeArgument((ulong)value.Hash);
+        }
 
         public override int GetHashCode()
         {
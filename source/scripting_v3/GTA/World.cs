@@ -423,7 +423,21 @@ namespace GTA
         /// <remarks>Returns <see langword="null" /> if no <see cref="Ped"/> was in the given region.</remarks>
         public static Ped GetClosestPed(Vector3 position, float radius, params Model[] models)
         {
-            return GetClosest(position, GetNearbyPeds(position, radius, models));
+            int[] hashes = Array.ConvertAll(models, model => model.Hash);
+            int[] handles = SHVDN.NativeMemory.GetClosestPedHandles(position.ToInternalFVector3(), radius, 1, hashes);
+            return handles.Length != 0 ? new Ped(handles[0]) : null;
+        }
+        /// <summary>
+        /// Gets an <c>array</c> of the <see cref="Ped"/>s closest to a given position in the World, sorted from the closest.
+        /// </summary>
+        /// <param name="position">The position to find the nearest <see cref="Ped"/>s.</param>
+        /// <param name="radius">The maximum distance from the <paramref name="position"/> to detect <see cref="Ped"/>s.</param>
+        /// <param name="count">The maximum number of <see cref="Ped"/>s to get.</param>
+        /// <param name="models">The <see cref="Model"/> of <see cref="Ped"/>s to get, leave blank for all <see cref="Ped"/> <see cref="Model"/>s.</param>
+        public static Ped[] GetClosestPeds(Vector3 position, float radius, int count, params Model[] models)
+        {
+            int[] hashes = Array.ConvertAll(models, model => model.Hash);
+            return Array.ConvertAll(SHVDN.NativeMemory.GetClosestPedHandles(position.ToInternalFVector3(), radius, count, hashes), handle => new Ped(handle));
         }
 
         /// <summary>
@@ -487,7 +501,21 @@ namespace GTA
         /// <remarks>Returns <see langword="null" /> if no <see cref="Vehicle"/> was in the given region.</remarks>
         public static Vehicle GetClosestVehicle(Vector3 position, float radius, params Model[] models)
         {
-            return GetClosest(position, GetNearbyVehicles(position, radius, models));
+            int[] hashes = Array.ConvertAll(models, model => model.Hash);
+            int[] handles = SHVDN.NativeMemory.GetClosestVehicleHandles(position.ToInternalFVector3(), radius, 1, hashes);
+            return handles.Length != 0 ? new Vehicle(handles[0]) : null;
+        }
+        /// <summary>
+        /// Gets an <c>array</c> of the <see cref="Vehicle"/>s closest to a given position in the World, sorted from the closest.
+        /// </summary>
+        /// <param name="position">The position to find the nearest <see cref="Vehicle"/>s.</param>
+        /// <param name="radius">The maximum distance from the <paramref name="position"/> to detect <see cref="Vehicle"/>s.</param>
+        /// <param name="count">The maximum number of <see cref="Vehicle"/>s to get.</param>
+        /// <param name="models">The <see cref="Model"/> of <see cref="Vehicle"/>s to get, leave blank for all <see cref="Vehicle"/> <see cref="Model"/>s.</param>
+        public static Vehicle[] GetClosestVehicles(Vector3 position, float radius, int count, params Model[] models)
+        {
+            int[] hashes = Array.ConvertAll(models, model => model.Hash);
+            return Array.ConvertAll(SHVDN.NativeMemory.GetClosestVehicleHandles(position.ToInternalFVector3(), radius, count, hashes), handle => new Vehicle(handle));
         }
 
         /// <summary>
@@ -547,7 +575,21 @@ namespace GTA
         /// <remarks>Returns <see langword="null" /> if no <see cref="Prop"/> was in the given region.</remarks>
         public static Prop GetClosestProp(Vector3 position, float radius, params Model[] models)
         {
-            return GetClosest(position, GetNearbyProps(position, radius, models));
+            int[] hashes = Array.ConvertAll(models, model => model.Hash);
+            int[] handles = SHVDN.NativeMemory.GetClosestPropHandles(position.ToInternalFVector3(), radius, 1, hashes);
+            return handles.Length != 0 ? new Prop(handles[0]) : null;
+        }
+        /// <summary>
+        /// Gets an <c>array</c> of the <see cref="Prop"/>s closest to a given position in the World, sorted from the closest.
+        /// </summary>
+        /// <param name="position">The position to find the nearest <see cref="Prop"/>s.</param>
+        /// <param name="radius">The maximum distance from the <paramref name="position"/> to detect <see cref="Prop"/>s.</param>
+        /// <param name="count">The maximum number of <see cref="Prop"/>s to get.</param>
+        /// <param name="models">The <see cref="Model"/> of <see cref="Prop"/>s to get, leave blank for all <see cref="Prop"/> <see cref="Model"/>s.</param>
+        public static Prop[] GetClosestProps(Vector3 position, float radius, int count, params Model[] models)
+        {
+            int[] hashes = Array.ConvertAll(models, model => model.Hash);
+            return Array.ConvertAll(SHVDN.NativeMemory.GetClosestPropHandles(position.ToInternalFVector3(), radius, count, hashes), handle => new Prop(handle));
         }
 
         /// <summary>
@@ -591,7 +633,8 @@ namespace GTA
         /// </remarks>
         public static Prop GetClosestPickupObject(Vector3 position, float radius)
         {
-            return GetClosest(position, GetNearbyPickupObjects(position, radius));
+            int[] handles = SHVDN.NativeMemory.GetClosestPickupObjectHandles(position.ToInternalFVector3(), radius, 1);
+            return handles.Length != 0 ? new Prop(handles[0]) : null;
         }
         /// <summary>
         /// Gets an <c>array</c> of pickup objects as <see cref="Prop"/>s in a given region in the World.
@@ -727,6 +770,16 @@ namespace GTA
         {
             return Array.ConvertAll(SHVDN.NativeMemory.GetEntityHandles(position.ToInternalFVector3(), radius), Entity.FromHandle);
         }
+        /// <summary>
+        /// Gets an <c>array</c> of all <see cref="Entity"/>s in an axis-aligned box in the World.
+        /// </summary>
+        /// <param name="minimum">The corner of the box with the smallest coordinates.</param>
+        /// <param name="maximum">The corner of the box with the largest coordinates.</param>
+        public static Entity[] GetEntitiesInBox(Vector3 minimum, Vector3 maximum)
+        {
+            return Array.ConvertAll(SHVDN.NativeMemory.GetEntityHandlesInBox(minimum.ToInternalFVector3(),
+                maximum.ToInternalFVector3()), Entity.FromHandle);
+        }
 
         public static Building[] GetAllBuildings()
         {
@@ -738,7 +791,8 @@ namespace GTA
         }
         public static Building GetClosestBuilding(Vector3 position, float radius)
         {
-            return GetClosest(position, GetNearbyBuildings(position, radius));
+            int[] handles = SHVDN.NativeMemory.GetClosestBuildingHandles(position.ToInternalFVector3(), radius, 1);
+            return handles.Length != 0 ? Building.FromHandle(handles[0]) : null;
         }
 
         public static AnimatedBuilding[] GetAllAnimatedBuildings()
@@ -751,7 +805,8 @@ namespace GTA
         }
         public static AnimatedBuilding GetClosestAnimatedBuilding(Vector3 position, float radius)
         {
-            return GetClosest(position, GetNearbyAnimatedBuildings(position, radius));
+            int[] handles = SHVDN.NativeMemory.GetClosestAnimatedBuildingHandles(position.ToInternalFVector3(), radius, 1);
+            return handles.Length != 0 ? AnimatedBuilding.FromHandle(handles[0]) : null;
         }
 
         public static InteriorInstance[] GetAllInteriorInstances()
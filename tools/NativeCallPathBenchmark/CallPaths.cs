@@ -0,0 +1,293 @@
+//
+// Copyright (C) 2015 crosire & kagikn & contributors
+// License: https://github.com/scripthookvdotnet/scripthookvdotnet#license
+//
+
+using System;
+using System.Runtime.CompilerServices;
+using System.Threading;
+
+// The parts of ScriptDomain.ExecuteTaskWithGameThreadTlsContext and NativeFunc.Invoke that run around every native
+// call, before and after the call path stopped taking locks. ScriptDomain needs the game to run, so both paths are
+// copied here with the TLS functions and the native invoker replaced by stubs.
+namespace NativeCallPathBenchmark
+{
+    internal interface IScriptTask
+    {
+        void Run();
+    }
+
+    /// <summary>
+    /// Stands in for the game: the TLS context functions and the native function that every task calls.
+    /// </summary>
+    /// <remarks>
+    /// The TLS context functions are managed function pointers here. Calling the real ones costs the same in both
+    /// paths, and a transition to unmanaged code per call would hide the difference between the paths.
+    /// </remarks>
+    internal static unsafe class GameStubs
+    {
+        [ThreadStatic]
+        private static IntPtr s_tlsContext;
+        private static readonly ulong[] s_resultBuffer = new ulong[3];
+
+        internal static readonly delegate*<IntPtr> GetTlsContext = &GetTlsContextStub;
+        internal static readonly delegate*<IntPtr, void> SetTlsContext = &SetTlsContextStub;
+        internal static readonly IntPtr TlsContextOfMainThread = new(0x1000);
+        // No benchmark thread has this id, so both paths switch the TLS context as script threads do
+        internal const uint GameMainThreadId = uint.MaxValue;
+
+        internal static uint GetCurrentThreadId() => (uint)Environment.CurrentManagedThreadId;
+
+        private static IntPtr GetTlsContextStub() => s_tlsContext;
+
+        private static void SetTlsContextStub(IntPtr context) => s_tlsContext = context;
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        internal static ulong* InvokeInternal(ulong hash, ulong* argPtr, int argCount)
+        {
+            fixed (ulong* result = s_resultBuffer)
+            {
+                *result = hash + (argCount > 0 ? argPtr[0] : 0);
+                return result;
+            }
+        }
+    }
+
+    /// <summary>
+    /// The script fields the native call path reads, before the timeout clock was replaced with a single int.
+    /// </summary>
+    internal sealed class LegacyScript
+    {
+        internal readonly CheapThreadSafeStopwatch StopwatchForTimeout = new();
+        private readonly ReaderWriterLockSlim _rwLock = new();
+        private bool _nativeCallResetsTimeout;
+
+        internal bool NativeCallResetsTimeout
+        {
+            get
+            {
+                _rwLock.EnterReadLock();
+                try
+                {
+                    return _nativeCallResetsTimeout;
+                }
+                finally
+                {
+                    _rwLock.ExitReadLock();
+                }
+            }
+            set
+            {
+                _rwLock.EnterWriteLock();
+                try
+                {
+                    _nativeCallResetsTimeout = value;
+                }
+                finally
+                {
+                    _rwLock.ExitWriteLock();
+                }
+            }
+        }
+    }
+
+    /// <summary>
+    /// The native call path that reads the TLS variables under a reader-writer lock, resets and restarts the timeout
+    /// stopwatch of the executing script under a monitor, and allocates a task object per call.
+    /// </summary>
+    internal sealed unsafe class LegacyCallPath
+    {
+        private readonly object _lockForFieldsThatFrequentlyWritten = new();
+        private readonly ReaderWriterLockSlim _tlsVariablesLock = new();
+        private readonly delegate*<IntPtr> _getTlsContext = GameStubs.GetTlsContext;
+        private readonly delegate*<IntPtr, void> _setTlsContext = GameStubs.SetTlsContext;
+        private readonly IntPtr _tlsContextOfMainThread = GameStubs.TlsContextOfMainThread;
+        private readonly uint _gameMainThreadIdUnmanaged = GameStubs.GameMainThreadId;
+        private readonly LegacyScript _executingScript;
+
+        internal LegacyCallPath(bool nativeCallResetsTimeout)
+        {
+            _executingScript = new LegacyScript { NativeCallResetsTimeout = nativeCallResetsTimeout };
+        }
+
+        private sealed class NativeTaskPtrArgs : IScriptTask
+        {
+            internal ulong _hash;
+            internal ulong* _argumentPtr;
+            internal int _argumentCount;
+            internal ulong* _result;
+
+            public void Run()
+            {
+                _result = GameStubs.InvokeInternal(_hash, _argumentPtr, _argumentCount);
+            }
+        }
+
+        internal ulong* Invoke(ulong hash, ulong* argPtr, int argCount)
+        {
+            var task = new NativeTaskPtrArgs { _hash = hash, _argumentPtr = argPtr, _argumentCount = argCount };
+            ExecuteTaskWithGameThreadTlsContext(task);
+
+            return task._result;
+        }
+
+        private void ExecuteTaskWithGameThreadTlsContext(IScriptTask task)
+        {
+            bool timeoutStopwatchHasBeenReset = ResetTimeoutStopwatchOfExecutingScriptIfScriptWantsToResetWhenCallingANativeFunc();
+
+            uint gameMainThreadIdUnmanaged;
+            IntPtr tlsContextOfMainThread;
+            delegate*<IntPtr> getTlsContext;
+            delegate*<IntPtr, void> setTlsContext;
+
+            _tlsVariablesLock.EnterReadLock();
+            try
+            {
+                gameMainThreadIdUnmanaged = _gameMainThreadIdUnmanaged;
+                tlsContextOfMainThread = _tlsContextOfMainThread;
+                getTlsContext = _getTlsContext;
+                setTlsContext = _setTlsContext;
+            }
+            finally
+            {
+                _tlsVariablesLock.ExitReadLock();
+            }
+
+            if (gameMainThreadIdUnmanaged == GameStubs.GetCurrentThreadId())
+            {
+                task.Run();
+            }
+            else
+            {
+                IntPtr tlsContextOfScriptThread = getTlsContext();
+                setTlsContext(tlsContextOfMainThread);
+
+                try
+                {
+                    task.Run();
+                }
+                finally
+                {
+                    setTlsContext(tlsContextOfScriptThread);
+                }
+            }
+
+            if (timeoutStopwatchHasBeenReset)
+            {
+                lock (_lockForFieldsThatFrequentlyWritten)
+                {
+                    _executingScript.StopwatchForTimeout.Start();
+                }
+            }
+        }
+
+        private bool ResetTimeoutStopwatchOfExecutingScriptIfScriptWantsToResetWhenCallingANativeFunc()
+        {
+            lock (_lockForFieldsThatFrequentlyWritten)
+            {
+                if (_executingScript.NativeCallResetsTimeout)
+                {
+                    _executingScript.StopwatchForTimeout.Reset();
+                    return true;
+                }
+
+                return false;
+            }
+        }
+    }
+
+    /// <summary>
+    /// The script fields the native call path reads, with the timeout clock as a single int.
+    /// </summary>
+    internal sealed class SnapshotScript
+    {
+        private volatile bool _nativeCallResetsTimeout;
+        private int _timeoutClockStartTimestamp;
+
+        internal bool NativeCallResetsTimeout
+        {
+            get => _nativeCallResetsTimeout;
+            set => _nativeCallResetsTimeout = value;
+        }
+
+        internal void RestartTimeoutClock()
+        {
+            Volatile.Write(ref _timeoutClockStartTimestamp, Environment.TickCount);
+        }
+    }
+
+    /// <summary>
+    /// The native call path that reads the TLS variables from an immutable snapshot, restarts the timeout clock with
+    /// a single volatile write, and passes a struct task by reference.
+    /// </summary>
+    internal sealed unsafe class SnapshotCallPath
+    {
+        private sealed class TlsContextSnapshot
+        {
+            internal readonly delegate*<IntPtr> _getTlsContext = GameStubs.GetTlsContext;
+            internal readonly delegate*<IntPtr, void> _setTlsContext = GameStubs.SetTlsContext;
+            internal readonly IntPtr _tlsContextOfMainThread = GameStubs.TlsContextOfMainThread;
+            internal readonly uint _gameMainThreadIdUnmanaged = GameStubs.GameMainThreadId;
+        }
+
+        private volatile TlsContextSnapshot _tlsSnapshot = new();
+        private volatile SnapshotScript _executingScript;
+
+        internal SnapshotCallPath(bool nativeCallResetsTimeout)
+        {
+            _executingScript = new SnapshotScript { NativeCallResetsTimeout = nativeCallResetsTimeout };
+        }
+
+        private struct NativeTaskPtrArgs : IScriptTask
+        {
+            internal ulong _hash;
+            internal ulong* _argumentPtr;
+            internal int _argumentCount;
+            internal ulong* _result;
+
+            public void Run()
+            {
+                _result = GameStubs.InvokeInternal(_hash, _argumentPtr, _argumentCount);
+            }
+        }
+
+        internal ulong* Invoke(ulong hash, ulong* argPtr, int argCount)
+        {
+            var task = new NativeTaskPtrArgs { _hash = hash, _argumentPtr = argPtr, _argumentCount = argCount };
+            ExecuteTaskWithGameThreadTlsContext(ref task);
+
+            return task._result;
+        }
+
+        private void ExecuteTaskWithGameThreadTlsContext<TTask>(ref TTask task) where TTask : IScriptTask
+        {
+            SnapshotScript executingScript = _executingScript;
+            bool resetsTimeout = executingScript != null && executingScript.NativeCallResetsTimeout;
+
+            TlsContextSnapshot tlsSnapshot = _tlsSnapshot;
+            if (tlsSnapshot._gameMainThreadIdUnmanaged == GameStubs.GetCurrentThreadId())
+            {
+                task.Run();
+            }
+            else
+            {
+                IntPtr tlsContextOfScriptThread = tlsSnapshot._getTlsContext();
+                tlsSnapshot._setTlsContext(tlsSnapshot._tlsContextOfMainThread);
+
+                try
+                {
+                    task.Run();
+                }
+                finally
+                {
+                    tlsSnapshot._setTlsContext(tlsContextOfScriptThread);
+                }
+            }
+
+            if (resetsTimeout)
+            {
+                executingScript.RestartTimeoutClock();
+            }
+        }
+    }
+}
@@ -6,7 +6,8 @@
 using System;
 using System.Threading;
 
-namespace SHVDN
+// A copy of the timeout stopwatch scripts used before the native call path stopped taking locks, as the baseline
+namespace NativeCallPathBenchmark
 {
     /// <summary>
     /// Provides a set of methods and properties that you can use to measure elapsed time within a resolution
@@ -0,0 +1,144 @@
+//
+// Copyright (C) 2015 crosire & kagikn & contributors
+// License: https://github.com/scripthookvdotnet/scripthookvdotnet#license
+//
+
+using System;
+using System.Diagnostics;
+using System.Globalization;
+using System.Threading;
+
+namespace NativeCallPathBenchmark
+{
+    /// <summary>
+    /// Compares the native call path that took a reader-writer lock, a monitor and a spin lock per call against the
+    /// one that reads an immutable TLS snapshot, with a stub native invoker so only the overhead of the path is measured.
+    /// </summary>
+    /// <remarks>
+    /// Usage: <c>dotnet run -c Release -- [calls per thread] [threads]</c>
+    /// </remarks>
+    internal static unsafe class Program
+    {
+        private const int RunCount = 3;
+        private const int WarmUpMilliseconds = 2000;
+
+        private static int Main(string[] args)
+        {
+            int iterations = args.Length > 0 ? int.Parse(args[0], CultureInfo.InvariantCulture) : 1000000;
+            int threadCount = args.Length > 1 ? int.Parse(args[1], CultureInfo.InvariantCulture) : 4;
+
+            ulong argument = 0x1234;
+            if (*new LegacyCallPath(true).Invoke(0x5678, &argument, 1) != *new SnapshotCallPath(true).Invoke(0x5678, &argument, 1))
+            {
+                Console.WriteLine("Mismatch: the paths returned different results");
+                return 1;
+            }
+
+            WarmUp();
+
+            Console.WriteLine($"{iterations} calls per thread");
+            Console.WriteLine($"{"Path",-10} {"Resets timeout",14} {"Threads",8} {"Mcalls/s",10} {"ns/call",10} {"B/call",8}");
+
+            foreach (bool resetsTimeout in new[] { false, true })
+            {
+                foreach (int threads in new[] { 1, threadCount })
+                {
+                    var legacy = new LegacyCallPath(resetsTimeout);
+                    var snapshot = new SnapshotCallPath(resetsTimeout);
+
+                    Print("Legacy", resetsTimeout, threads, Measure(threads, iterations, () => RunLegacy(legacy, iterations)));
+                    Print("Snapshot", resetsTimeout, threads, Measure(threads, iterations, () => RunSnapshot(snapshot, iterations)));
+                }
+            }
+
+            return 0;
+        }
+
+        private static void WarmUp()
+        {
+            // Run both paths for a while so tiered compilation has settled before measuring. A fixed number of calls
+            // is not enough, since methods are only recompiled in the background after a delay.
+            var stopwatch = Stopwatch.StartNew();
+            while (stopwatch.ElapsedMilliseconds < WarmUpMilliseconds)
+            {
+                foreach (bool resetsTimeout in new[] { false, true })
+                {
+                    RunLegacy(new LegacyCallPath(resetsTimeout), 10000);
+                    RunSnapshot(new SnapshotCallPath(resetsTimeout), 10000);
+                }
+            }
+        }
+
+        private static void RunLegacy(LegacyCallPath path, int iterations)
+        {
+            ulong argument = 1;
+            for (int i = 0; i < iterations; i++)
+            {
+                path.Invoke(0x5678, &argument, 1);
+            }
+        }
+
+        private static void RunSnapshot(SnapshotCallPath path, int iterations)
+        {
+            ulong argument = 1;
+            for (int i = 0; i < iterations; i++)
+            {
+                path.Invoke(0x5678, &argument, 1);
+            }
+        }
+
+        private static (double CallsPerSecond, double Nanoseconds, double Bytes) Measure(int threads, int iterations, Action body)
+        {
+            // Take the best of a few runs, as a single run is easily disturbed by other processes
+            (double CallsPerSecond, double Nanoseconds, double Bytes) best = MeasureOnce(threads, iterations, body);
+            for (int i = 1; i < RunCount; i++)
+            {
+                (double CallsPerSecond, double Nanoseconds, double Bytes) result = MeasureOnce(threads, iterations, body);
+                if (result.CallsPerSecond > best.CallsPerSecond)
+                {
+                    best = result;
+                }
+            }
+
+            return best;
+        }
+
+        private static (double CallsPerSecond, double Nanoseconds, double Bytes) MeasureOnce(int threads, int iterations, Action body)
+        {
+            // Script threads call natives concurrently when scripts use background threads, so several threads run
+            // the same path at once to show the cost of the shared locks
+            var workers = new Thread[threads];
+            using var start = new ManualResetEventSlim(false);
+            long allocatedBefore = GC.GetTotalAllocatedBytes(true);
+            for (int i = 0; i < threads; i++)
+            {
+                workers[i] = new Thread(() =>
+                {
+                    start.Wait();
+                    body();
+                });
+                workers[i].Start();
+            }
+
+            var stopwatch = Stopwatch.StartNew();
+            start.Set();
+            foreach (Thread worker in workers)
+            {
+                worker.Join();
+            }
+            stopwatch.Stop();
+
+            long allocatedBytes = GC.GetTotalAllocatedBytes(true) - allocatedBefore;
+            double totalCalls = (double)iterations * threads;
+            return (totalCalls / stopwatch.Elapsed.TotalSeconds,
+                stopwatch.Elapsed.TotalMilliseconds * 1000000.0 / iterations,
+                allocatedBytes / totalCalls);
+        }
+
+        private static void Print(string path, bool resetsTimeout, int threads, (double CallsPerSecond, double Nanoseconds, double Bytes) result)
+        {
+            Console.WriteLine(string.Format(CultureInfo.InvariantCulture, "{0,-10} {1,14} {2,8} {3,10:F2} {4,10:F2} {5,8:F1}",
+                path, resetsTimeout, threads, result.CallsPerSecond / 1000000.0, result.Nanoseconds, result.Bytes));
+        }
+    }
+}
@@ -0,0 +1,406 @@
+//
+// Copyright (C) 2015 crosire & kagikn & contributors
+// License: https://github.com/scripthookvdotnet/scripthookvdotnet#license
+//
+
+using System;
+using System.Collections.Generic;
+using System.Globalization;
+using System.IO;
+using System.Linq;
+using System.Net.Http;
+using System.Text;
+using System.Text.Json;
+
+namespace NativeWrapperGen
+{
+    /// <summary>
+    /// Generates the strongly typed native wrappers of the v3 API from the native database, next to the hash enum
+    /// <c>NativeGen.exe</c> generates from the same database.
+    /// </summary>
+    /// <remarks>
+    /// <para>
+    /// Usage: <c>dotnet run -c Release -- [natives.json path or URL] [output path]</c>
+    /// </para>
+    /// <para>
+    /// This isn't run by any build configuration, so building the project doesn't need the .NET 8 SDK or network
+    /// access. Run it by hand and check in <c>source/scripting_v3/GTA.Native/Natives.cs</c> together with the code
+    /// that moves to the wrappers.
+    /// </para>
+    /// <para>
+    /// <c>natives.subset.json</c> holds the entries of the database for the natives the API calls through the
+    /// wrappers, so only those wrappers are compiled into the API. Add the entries of the natives an API class
+    /// needs when moving it over, and regenerate with
+    /// <c>dotnet run -c Release -- natives.subset.json ../../source/scripting_v3/GTA.Native/Natives.cs</c>.
+    /// </para>
+    /// </remarks>
+    internal static class Program
+    {
+        private const string DefaultDatabaseUrl = "https://github.com/alloc8or/gta5-nativedb-data/blob/master/natives.json?raw=true";
+
+        // The handle types of the database, which are all 32-bit script GUIDs or indices
+        private static readonly HashSet<string> s_handleTypes = new(StringComparer.Ordinal)
+        {
+            "int", "Any", "Entity", "Ped", "Vehicle", "Object", "Player", "Cam", "Blip", "Pickup", "Interior",
+            "FireId", "ScrHandle", "CarGenerator", "Group", "Train", "Weapon", "Texture", "TextureDict",
+            "CoverPoint", "Camera", "TaskSequence", "ColourIndex", "Sphere",
+        };
+
+        private static readonly HashSet<string> s_keywords = new(StringComparer.Ordinal)
+        {
+            "abstract", "as", "base", "bool", "break", "byte", "case", "catch", "char", "checked", "class", "const",
+            "continue", "decimal", "default", "delegate", "do", "double", "else", "enum", "event", "explicit",
+            "extern", "false", "finally", "fixed", "float", "for", "foreach", "goto", "if", "implicit", "in", "int",
+            "interface", "internal", "is", "lock", "long", "namespace", "new", "null", "object", "operator", "out",
+            "override", "params", "private", "protected", "public", "readonly", "ref", "return", "sbyte", "sealed",
+            "short", "sizeof", "stackalloc", "static", "string", "struct", "switch", "this", "throw", "true", "try",
+            "typeof", "uint", "ulong", "unchecked", "unsafe", "ushort", "using", "virtual", "void", "volatile",
+            "while",
+        };
+
+        private static int Main(string[] args)
+        {
+            string databasePath = args.Length > 0 ? args[0] : DefaultDatabaseUrl;
+            string outputPath = args.Length > 1 ? args[1] : "Natives.cs";
+            string templatePath = Path.Combine(AppContext.BaseDirectory, "NativeWrappersTemplate.txt");
+
+            Console.WriteLine("Reading " + databasePath);
+            using JsonDocument database = JsonDocument.Parse(ReadDatabase(databasePath));
+
+            var methods = new StringBuilder();
+            // Reserve the names of the natives named in the game, so the names guessed by the community (those with
+            // a leading underscore) can't take them regardless of the order of the database
+            var officialNames = new HashSet<string>(StringComparer.Ordinal);
+            foreach (JsonProperty nativeNamespace in database.RootElement.EnumerateObject())
+            {
+                foreach (JsonProperty native in nativeNamespace.Value.EnumerateObject())
+                {
+                    string nativeName = native.Value.GetProperty("name").GetString();
+                    if (!nativeName.StartsWith("_", StringComparison.Ordinal))
+                    {
+                        officialNames.Add(ToPascalCase(nativeName));
+                    }
+                }
+            }
+
+            var usedNames = new HashSet<string>(StringComparer.Ordinal);
+            int generatedCount = 0;
+            int skippedCount = 0;
+
+            foreach (JsonProperty nativeNamespace in database.RootElement.EnumerateObject())
+            {
+                foreach (JsonProperty native in nativeNamespace.Value.EnumerateObject())
+                {
+                    string method = GenerateWrapper(native.Name, native.Value, officialNames, usedNames,
+                        out string skipReason);
+                    if (method == null)
+                    {
+                        Console.WriteLine($"Skipped {native.Name}: {skipReason}");
+                        skippedCount++;
+                        continue;
+                    }
+
+                    if (generatedCount != 0)
+                    {
+                        methods.Append('\n');
+                    }
+                    methods.Append(method);
+                    generatedCount++;
+                }
+            }
+
+            string template = File.ReadAllText(templatePath);
+            string output = string.Format(CultureInfo.InvariantCulture, template, methods.ToString().TrimEnd('\n'));
+            File.WriteAllText(outputPath, output.Replace("\r\n", "\n"));
+
+            Console.WriteLine($"Finished generating {generatedCount} native wrappers, skipped {skippedCount}");
+            return 0;
+        }
+
+        private static string ReadDatabase(string pathOrUrl)
+        {
+            if (!pathOrUrl.StartsWith("http://", StringComparison.OrdinalIgnoreCase)
+                && !pathOrUrl.StartsWith("https://", StringComparison.OrdinalIgnoreCase))
+            {
+                return File.ReadAllText(pathOrUrl);
+            }
+
+            using var client = new HttpClient();
+            return client.GetStringAsync(pathOrUrl).GetAwaiter().GetResult();
+        }
+
+        private static string GenerateWrapper(string hashString, JsonElement native, HashSet<string> officialNames,
+            HashSet<string> usedNames, out string skipReason)
+        {
+            string nativeName = native.GetProperty("name").GetString();
+            // Natives without a known name have their hash as the name, and can keep using Function.Call
+            if (nativeName.StartsWith("_0x", StringComparison.OrdinalIgnoreCase))
+            {
+                skipReason = "no name";
+                return null;
+            }
+
+            string methodName = ToPascalCase(nativeName.TrimStart('_'));
+            bool isOfficialName = !nativeName.StartsWith("_", StringComparison.Ordinal);
+            if (!isOfficialName && officialNames.Contains(methodName))
+            {
+                skipReason = "guessed name clashes with the official name " + methodName;
+                return null;
+            }
+            if (!usedNames.Add(methodName))
+            {
+                skipReason = "duplicate name " + methodName;
+                return null;
+            }
+
+            var parameters = new List<string>();
+            var argumentWriters = new List<string>();
+            var refReaders = new List<string>();
+            var usedParameterNames = new HashSet<string>(StringComparer.Ordinal);
+            int argCount = 0;
+
+            foreach (JsonElement parameter in native.GetProperty("params").EnumerateArray())
+            {
+                string type = parameter.GetProperty("type").GetString().Replace(" ", "");
+                string name = ToParameterName(parameter.GetProperty("name").GetString(), parameters.Count,
+                    usedParameterNames);
+
+                if (!TryAddParameter(type, name, ref argCount, parameters, argumentWriters, refReaders))
+                {
+                    usedNames.Remove(methodName);
+                    skipReason = $"unsupported parameter type '{type}'";
+                    return null;
+                }
+            }
+
+            string returnType = native.GetProperty("return_type").GetString().Replace(" ", "");
+            if (!TryGetReturnConversion(returnType, out string managedReturnType, out string returnExpression))
+            {
+                usedNames.Remove(methodName);
+                skipReason = $"unsupported return type '{returnType}'";
+                return null;
+            }
+
+            ulong hash = ulong.Parse(hashString.Substring(2), NumberStyles.HexNumber, CultureInfo.InvariantCulture);
+
+            var code = new StringBuilder();
+            code.Append($"        internal static {managedReturnType} {methodName}({string.Join(", ", parameters)})\n");
+            code.Append("        {\n");
+
+            string argsPointer = "null";
+            if (argCount != 0)
+            {
+                code.Append($"            ulong* args = stackalloc ulong[{argCount}];\n");
+                foreach (string writer in argumentWriters)
+                {
+                    code.Append("            ").Append(writer).Append('\n');
+                }
+                code.Append('\n');
+                argsPointer = "args";
+            }
+
+            string hashLiteral = "0x" + hash.ToString("X16", CultureInfo.InvariantCulture);
+            if (managedReturnType == "void")
+            {
+                // Ignores the null result outside the main thread, as Function.Call does for natives without a return value
+                code.Append($"            SHVDN.NativeFunc.Invoke({hashLiteral}, {argsPointer}, {argCount});\n");
+                foreach (string reader in refReaders)
+                {
+                    code.Append("            ").Append(reader).Append('\n');
+                }
+            }
+            else
+            {
+                code.Append($"            ulong* result = Invoke({hashLiteral}, {argsPointer}, {argCount});\n");
+                foreach (string reader in refReaders)
+                {
+                    code.Append("            ").Append(reader).Append('\n');
+                }
+                code.Append($"            return {returnExpression};\n");
+            }
+
+            code.Append("        }\n");
+
+            skipReason = null;
+            return code.ToString();
+        }
+
+        private static bool TryAddParameter(string type, string name, ref int argCount, List<string> parameters,
+            List<string> argumentWriters, List<string> refReaders)
+        {
+            if (s_handleTypes.Contains(type))
+            {
+                parameters.Add("int " + name);
+                argumentWriters.Add($"args[{argCount++}] = (ulong){name};");
+                return true;
+            }
+
+            switch (type)
+            {
+                case "Hash":
+                    parameters.Add("uint " + name);
+                    argumentWriters.Add($"args[{argCount++}] = {name};");
+                    return true;
+                case "BOOL":
+                    parameters.Add("bool " + name);
+                    argumentWriters.Add($"args[{argCount++}] = ToNative({name});");
+                    return true;
+                case "float":
+                    parameters.Add("float " + name);
+                    argumentWriters.Add($"args[{argCount++}] = ToNative({name});");
+                    return true;
+                case "constchar*":
+                    parameters.Add("string " + name);
+                    argumentWriters.Add($"args[{argCount++}] = ToNative({name});");
+                    return true;
+                case "Vector3":
+                    // Vectors are passed as three separate float arguments
+                    parameters.Add("Vector3 " + name);
+                    argumentWriters.Add($"args[{argCount++}] = ToNative({name}.X);");
+                    argumentWriters.Add($"args[{argCount++}] = ToNative({name}.Y);");
+                    argumentWriters.Add($"args[{argCount++}] = ToNative({name}.Z);");
+                    return true;
+            }
+
+            if (!type.EndsWith("*", StringComparison.Ordinal))
+            {
+                return false;
+            }
+
+            // Pointer arguments are copied to and from a local, since natives may write 8 bytes for a 4 byte value.
+            // Buffers of unknown size (Any* and char*) are left to Function.Call.
+            string pointeeType = type.Substring(0, type.Length - 1);
+            string local = name.TrimStart('@') + "Value";
+            if (s_handleTypes.Contains(pointeeType) && pointeeType != "Any")
+            {
+                parameters.Add("ref int " + name);
+                argumentWriters.Add($"ulong {local} = (ulong){name};");
+                argumentWriters.Add($"args[{argCount++}] = (ulong)&{local};");
+                refReaders.Add($"{name} = (int){local};");
+                return true;
+            }
+
+            switch (pointeeType)
+            {
+                case "Hash":
+                    parameters.Add("ref uint " + name);
+                    argumentWriters.Add($"ulong {local} = {name};");
+                    argumentWriters.Add($"args[{argCount++}] = (ulong)&{local};");
+                    refReaders.Add($"{name} = (uint){local};");
+                    return true;
+                case "BOOL":
+                    parameters.Add("ref bool " + name);
+                    argumentWriters.Add($"ulong {local} = ToNative({name});");
+                    argumentWriters.Add($"args[{argCount++}] = (ulong)&{local};");
+                    refReaders.Add($"{name} = (int){local} != 0;");
+                    return true;
+                case "float":
+                    parameters.Add("ref float " + name);
+                    argumentWriters.Add($"ulong {local} = ToNative({name});");
+                    argumentWriters.Add($"args[{argCount++}] = (ulong)&{local};");
+                    refReaders.Add($"{name} = *(float*)&{local};");
+                    return true;
+                case "Vector3":
+                    // Natives use the scrVector layout, where each component is padded to 8 bytes
+                    parameters.Add("ref Vector3 " + name);
+                    argumentWriters.Add($"ulong* {local} = stackalloc ulong[3];");
+                    argumentWriters.Add($"{local}[0] = ToNative({name}.X);");
+                    argumentWriters.Add($"{local}[1] = ToNative({name}.Y);");
+                    argumentWriters.Add($"{local}[2] = ToNative({name}.Z);");
+                    argumentWriters.Add($"args[{argCount++}] = (ulong){local};");
+                    refReaders.Add($"{name} = new Vector3(*(float*)&{local}[0], *(float*)&{local}[1], *(float*)&{local}[2]);");
+                    return true;
+            }
+
+            return false;
+        }
+
+        private static bool TryGetReturnConversion(string type, out string managedType, out string expression)
+        {
+            if (s_handleTypes.Contains(type))
+            {
+                managedType = "int";
+                expression = "*(int*)result";
+                return true;
+            }
+
+            switch (type)
+            {
+                case "void":
+                    managedType = "void";
+                    expression = null;
+                    return true;
+                case "Hash":
+                    managedType = "uint";
+                    expression = "*(uint*)result";
+                    return true;
+                case "BOOL":
+                    // Return proper boolean values (true if non-zero and false if zero)
+                    managedType = "bool";
+                    expression = "*result != 0";
+                    return true;
+                case "float":
+                    managedType = "float";
+                    expression = "*(float*)result";
+                    return true;
+                case "constchar*":
+                case "char*":
+                    managedType = "string";
+                    expression = "SHVDN.StringMarshal.PtrToStringUtf8(new IntPtr((byte*)*result))";
+                    return true;
+                case "Vector3":
+                    managedType = "Vector3";
+                    expression = "new Vector3(*(float*)&result[0], *(float*)&result[1], *(float*)&result[2])";
+                    return true;
+            }
+
+            if (type.EndsWith("*", StringComparison.Ordinal))
+            {
+                managedType = "IntPtr";
+                expression = "new IntPtr((long)*result)";
+                return true;
+            }
+
+            managedType = null;
+            expression = null;
+            return false;
+        }
+
+        private static string ToPascalCase(string nativeName)
+        {
+            var builder = new StringBuilder(nativeName.Length);
+            foreach (string word in nativeName.Split('_', StringSplitOptions.RemoveEmptyEntries))
+            {
+                builder.Append(char.ToUpperInvariant(word[0]));
+                builder.Append(word.Substring(1).ToLowerInvariant());
+            }
+
+            if (builder.Length == 0 || char.IsDigit(builder[0]))
+            {
+                builder.Insert(0, 'N');
+            }
+
+            return builder.ToString();
+        }
+
+        private static string ToParameterName(string name, int index, HashSet<string> usedNames)
+        {
+            if (string.IsNullOrEmpty(name) || !IsIdentifier(name))
+            {
+                name = "p" + index.ToString(CultureInfo.InvariantCulture);
+            }
+            if (!usedNames.Add(name))
+            {
+                name += index.ToString(CultureInfo.InvariantCulture);
+                usedNames.Add(name);
+            }
+
+            return s_keywords.Contains(name) ? "@" + name : name;
+        }
+
+        private static bool IsIdentifier(string name)
+        {
+            return (char.IsLetter(name[0]) || name[0] == '_') && name.All(c => char.IsLetterOrDigit(c) || c == '_');
+        }
+    }
+}
@@ -0,0 +1,38 @@
+//
+// Copyright (C) 2015 crosire & kagikn & contributors
+// License: https://github.com/scripthookvdotnet/scripthookvdotnet#license
+//
+
+using System;
+
+// The scanners are linked from the core sources, which refer to these types of the core that only work in the game
+namespace SHVDN
+{
+    internal static unsafe class PatternScanCache
+    {
+        internal static bool TryGet(string pattern, string mask, IntPtr startAddress, ulong size, out byte* address)
+        {
+            address = null;
+            return false;
+        }
+
+        internal static void Add(string pattern, string mask, IntPtr startAddress, ulong size, byte* address)
+        {
+        }
+    }
+
+    public static class Log
+    {
+        public enum Level
+        {
+            Error,
+            Warning,
+            Info,
+            Debug,
+        }
+
+        public static void Message(Level level, params string[] message)
+        {
+        }
+    }
+}
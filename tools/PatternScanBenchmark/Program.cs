@@ -0,0 +1,196 @@
+//
+// Copyright (C) 2015 crosire & kagikn & contributors
+// License: https://github.com/scripthookvdotnet/scripthookvdotnet#license
+//
+
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Globalization;
+using System.IO;
+using System.Runtime.InteropServices;
+using System.Text;
+using System.Text.RegularExpressions;
+using SHVDN;
+
+namespace PatternScanBenchmark
+{
+    /// <summary>
+    /// Compares <see cref="MultiPatternScanner"/> against a <see cref="MemScanner.FindPatternBmh(string, string, IntPtr, ulong)"/>
+    /// call per pattern, using the patterns <c>NativeMemory</c> searches for and a synthetic image of the game.
+    /// </summary>
+    /// <remarks>
+    /// Usage: <c>dotnet run -c Release -- [path to NativeMemory.cs] [buffer size in MB] [iterations]</c>
+    /// </remarks>
+    internal static unsafe class Program
+    {
+        private static readonly Regex s_patternCallRegex = new(
+            @"MemScanner\.FindPattern(?:Bmh|Naive)\(""((?:[^""\\]|\\.)*)"",\s*""([x?]+)""", RegexOptions.Compiled);
+
+        private static int Main(string[] args)
+        {
+            string sourcePath = args.Length > 0 ? args[0] : FindNativeMemorySource();
+            int sizeInMegabytes = args.Length > 1 ? int.Parse(args[1], CultureInfo.InvariantCulture) : 64;
+            int iterations = args.Length > 2 ? int.Parse(args[2], CultureInfo.InvariantCulture) : 3;
+
+            List<(string Pattern, string Mask)> patterns = ReadPatterns(sourcePath);
+            Console.WriteLine($"{patterns.Count} patterns from {sourcePath}");
+
+            ulong size = (ulong)sizeInMegabytes * 1024 * 1024;
+            IntPtr buffer = Marshal.AllocHGlobal((IntPtr)(long)size);
+            try
+            {
+                FillSyntheticImage((byte*)buffer, size, patterns);
+                Console.WriteLine($"{sizeInMegabytes} MB synthetic image, {Environment.ProcessorCount} logical processors");
+
+                var scanner = new MultiPatternScanner();
+                foreach ((string pattern, string mask) in patterns)
+                {
+                    scanner.Add(pattern, mask);
+                }
+
+                IntPtr[] bmhResults = null;
+                IntPtr[] multiResults = null;
+                for (int iteration = 0; iteration < iterations; iteration++)
+                {
+                    var stopwatch = Stopwatch.StartNew();
+                    bmhResults = new IntPtr[patterns.Count];
+                    for (int i = 0; i < patterns.Count; i++)
+                    {
+                        bmhResults[i] = (IntPtr)MemScanner.FindPatternBmh(patterns[i].Pattern, patterns[i].Mask, buffer, size);
+                    }
+                    double bmhMilliseconds = stopwatch.Elapsed.TotalMilliseconds;
+
+                    stopwatch.Restart();
+                    multiResults = scanner.Scan(buffer, size);
+                    double multiMilliseconds = stopwatch.Elapsed.TotalMilliseconds;
+
+                    Console.WriteLine($"#{iteration + 1}: BMH per pattern {bmhMilliseconds,9:F1} ms, " +
+                        $"multi-pattern {multiMilliseconds,7:F1} ms ({bmhMilliseconds / multiMilliseconds:F1}x)");
+                }
+
+                int mismatches = 0;
+                int found = 0;
+                for (int i = 0; i < patterns.Count; i++)
+                {
+                    if (bmhResults[i] != IntPtr.Zero)
+                    {
+                        found++;
+                    }
+                    if (bmhResults[i] != multiResults[i])
+                    {
+                        mismatches++;
+                        Console.WriteLine($"Mismatch for pattern {i}: BMH 0x{(long)bmhResults[i]:X}, multi-pattern 0x{(long)multiResults[i]:X}");
+                    }
+                }
+
+                Console.WriteLine($"{found}/{patterns.Count} patterns found, {mismatches} mismatches");
+                return mismatches == 0 ? 0 : 1;
+            }
+            finally
+            {
+                Marshal.FreeHGlobal(buffer);
+            }
+        }
+
+        private static string FindNativeMemorySource()
+        {
+            for (DirectoryInfo directory = new(AppContext.BaseDirectory); directory != null; directory = directory.Parent)
+            {
+                string path = Path.Combine(directory.FullName, "source", "core", "NativeMemory.cs");
+                if (File.Exists(path))
+                {
+                    return path;
+                }
+            }
+
+            throw new FileNotFoundException("NativeMemory.cs not found. Pass its path as the first argument.");
+        }
+
+        private static List<(string Pattern, string Mask)> ReadPatterns(string sourcePath)
+        {
+            var patterns = new List<(string Pattern, string Mask)>();
+            var seen = new HashSet<string>();
+            foreach (Match match in s_patternCallRegex.Matches(File.ReadAllText(sourcePath)))
+            {
+                string pattern = Unescape(match.Groups[1].Value);
+                string mask = match.Groups[2].Value;
+                if (pattern.Length == mask.Length && seen.Add(pattern + "\0" + mask))
+                {
+                    patterns.Add((pattern, mask));
+                }
+            }
+
+            return patterns;
+        }
+
+        private static string Unescape(string literal)
+        {
+            var result = new StringBuilder(literal.Length / 4);
+            for (int i = 0; i < literal.Length; i++)
+            {
+                if (literal[i] != '\\' || i + 1 >= literal.Length)
+                {
+                    result.Append(literal[i]);
+                    continue;
+                }
+
+                char escape = literal[++i];
+                if (escape != 'x')
+                {
+                    result.Append(escape == '0' ? '\0' : escape);
+                    continue;
+                }
+
+                // C# \x escapes take 1 to 4 hex digits
+                int value = 0;
+                int digits = 0;
+                while (digits < 4 && i + 1 < literal.Length && Uri.IsHexDigit(literal[i + 1]))
+                {
+                    value = value * 16 + Convert.ToInt32(literal[++i].ToString(), 16);
+                    digits++;
+                }
+                result.Append((char)value);
+            }
+
+            return result.ToString();
+        }
+
+        /// <summary>
+        /// Fills the buffer with random bytes weighted towards common x64 code bytes, and puts each pattern in it once
+        /// in the second half, so scanning for it goes through most of the buffer.
+        /// </summary>
+        private static void FillSyntheticImage(byte* buffer, ulong size, List<(string Pattern, string Mask)> patterns)
+        {
+            byte[] commonBytes = { 0x00, 0x48, 0x8B, 0x89, 0xFF, 0xCC, 0x0F, 0x85, 0x84, 0xE8, 0x4C, 0x8D, 0x24, 0x44, 0x33, 0xC0, 0x83, 0x74, 0x75, 0x41 };
+            var random = new Random(42);
+            var chunk = new byte[1 << 16];
+            for (ulong offset = 0; offset < size; offset += (ulong)chunk.Length)
+            {
+                random.NextBytes(chunk);
+                for (int i = 0; i < chunk.Length; i++)
+                {
+                    if (chunk[i] < 110)
+                    {
+                        chunk[i] = commonBytes[chunk[i] % commonBytes.Length];
+                    }
+                }
+
+                int count = (int)Math.Min((ulong)chunk.Length, size - offset);
+                Marshal.Copy(chunk, 0, (IntPtr)(buffer + offset), count);
+            }
+
+            foreach ((string pattern, string mask) in patterns)
+            {
+                ulong offset = size / 2 + (ulong)random.NextInt64((long)(size / 2) - pattern.Length);
+                for (int i = 0; i < pattern.Length; i++)
+                {
+                    if (mask[i] != '?')
+                    {
+                        buffer[offset + (ulong)i] = (byte)pattern[i];
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,222 @@
+//
+// Copyright (C) 2015 crosire & kagikn & contributors
+// License: https://github.com/scripthookvdotnet/scripthookvdotnet#license
+//
+
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Globalization;
+using System.Runtime.InteropServices;
+using SHVDN;
+
+namespace PoolScanBenchmark
+{
+    /// <summary>
+    /// Compares <see cref="FwBasePool.OccupiedSlotEnumerator"/> against testing every slot with
+    /// <see cref="FwBasePool.IsValid(uint)"/>, on a fake pool whose flag bytes are filled to several levels.
+    /// </summary>
+    /// <remarks>
+    /// Usage: <c>dotnet run -c Release -- [pool capacity] [scans per measurement]</c>
+    /// </remarks>
+    internal static unsafe class Program
+    {
+        private const int RunCount = 3;
+        private const int WarmUpMilliseconds = 2000;
+        // The high bit of a flag byte is set when the slot is free
+        private const byte FreeFlag = 0x80;
+
+        private static readonly int[] s_fillPercentages = { 0, 1, 10, 25, 50, 75, 90, 100 };
+
+        private static int Main(string[] args)
+        {
+            // 3072 is the capacity the pools have with ScriptHookV installed, but the enumerator has a tail path for
+            // capacities that aren't a multiple of 8, so the default is one that isn't
+            uint capacity = args.Length > 0 ? uint.Parse(args[0], CultureInfo.InvariantCulture) : 3075;
+            int scans = args.Length > 1 ? int.Parse(args[1], CultureInfo.InvariantCulture) : 20000;
+
+            IntPtr flags = Marshal.AllocHGlobal((IntPtr)capacity);
+            try
+            {
+                var pool = new FwBasePool { Flags = flags, Capacity = capacity, SlotSize = 0x10 };
+                var random = new Random(12345);
+
+                // Check every layout before measuring anything, including the capacities around a word boundary
+                for (uint testCapacity = 1; testCapacity <= Math.Min(capacity, 40u); testCapacity++)
+                {
+                    foreach (int percentage in s_fillPercentages)
+                    {
+                        foreach (bool clustered in new[] { false, true })
+                        {
+                            var testPool = new FwBasePool { Flags = flags, Capacity = testCapacity, SlotSize = 0x10 };
+                            Fill((byte*)flags, testCapacity, percentage, clustered, random);
+                            if (!Verify(testPool, $"capacity {testCapacity}, {percentage}% full, clustered {clustered}"))
+                            {
+                                return 1;
+                            }
+                        }
+                    }
+                }
+
+                WarmUp(pool, random);
+
+                Console.WriteLine($"Capacity {capacity}, {scans} scans per measurement");
+                Console.WriteLine($"{"Fill",5} {"Layout",10} {"Slots",6} {"IsValid us",11} {"SWAR us",9} {"Speedup",8}");
+
+                foreach (int percentage in s_fillPercentages)
+                {
+                    foreach (bool clustered in new[] { false, true })
+                    {
+                        int occupied = Fill((byte*)flags, capacity, percentage, clustered, random);
+                        if (!Verify(pool, $"capacity {capacity}, {percentage}% full, clustered {clustered}"))
+                        {
+                            return 1;
+                        }
+
+                        double isValidMicroseconds = Measure(() => ScanWithIsValid(pool, scans), scans);
+                        double swarMicroseconds = Measure(() => ScanWithEnumerator(pool, scans), scans);
+
+                        Console.WriteLine(string.Format(CultureInfo.InvariantCulture,
+                            "{0,4}% {1,10} {2,6} {3,11:F3} {4,9:F3} {5,7:F1}x", percentage,
+                            clustered ? "clustered" : "random", occupied, isValidMicroseconds, swarMicroseconds,
+                            isValidMicroseconds / swarMicroseconds));
+                    }
+                }
+            }
+            finally
+            {
+                Marshal.FreeHGlobal(flags);
+            }
+
+            return 0;
+        }
+
+        /// <summary>
+        /// Fills the flag bytes so the given percentage of the slots is occupied, either spread at random or packed at
+        /// the start of the pool as a pool that has only grown looks. Occupied slots get a random reuse counter.
+        /// </summary>
+        private static int Fill(byte* flags, uint capacity, int percentage, bool clustered, Random random)
+        {
+            int occupiedCount = (int)(capacity * (long)percentage / 100);
+
+            var order = new int[capacity];
+            for (int i = 0; i < order.Length; i++)
+            {
+                order[i] = i;
+            }
+            if (!clustered)
+            {
+                random.Shuffle(order);
+            }
+
+            for (int i = 0; i < order.Length; i++)
+            {
+                byte counter = (byte)random.Next(0x80);
+                flags[order[i]] = i < occupiedCount ? counter : (byte)(FreeFlag | counter);
+            }
+
+            return occupiedCount;
+        }
+
+        /// <summary>
+        /// Checks that both ways of scanning the pool yield the same slots and handles in the same order.
+        /// </summary>
+        private static bool Verify(FwBasePool pool, string layout)
+        {
+            var expected = new List<(uint Index, int Handle)>();
+            for (uint i = 0; i < pool.Capacity; i++)
+            {
+                if (pool.IsValid(i))
+                {
+                    expected.Add((i, pool.GetGuidHandleByIndex(i)));
+                }
+            }
+
+            var actual = new List<(uint Index, int Handle)>();
+            FwBasePool.OccupiedSlotEnumerator enumerator = pool.GetOccupiedSlots();
+            while (enumerator.MoveNext())
+            {
+                actual.Add((enumerator.Current, enumerator.CurrentHandle));
+            }
+
+            if (actual.Count != expected.Count)
+            {
+                Console.WriteLine($"Mismatch at {layout}: {actual.Count} slots from the enumerator, {expected.Count} from IsValid");
+                return false;
+            }
+
+            for (int i = 0; i < expected.Count; i++)
+            {
+                if (actual[i] != expected[i])
+                {
+                    Console.WriteLine($"Mismatch at {layout}: the enumerator yielded slot {actual[i].Index} " +
+                        $"(handle 0x{actual[i].Handle:X}), IsValid slot {expected[i].Index} (handle 0x{expected[i].Handle:X})");
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        private static void WarmUp(FwBasePool pool, Random random)
+        {
+            // Run both scans for a while so tiered compilation has settled before measuring
+            var stopwatch = Stopwatch.StartNew();
+            while (stopwatch.ElapsedMilliseconds < WarmUpMilliseconds)
+            {
+                Fill((byte*)pool.Flags, pool.Capacity, random.Next(101), false, random);
+                ScanWithIsValid(pool, 100);
+                ScanWithEnumerator(pool, 100);
+            }
+        }
+
+        // The sums keep the JIT from dropping the loops, and are returned so both scans do the same work per slot
+        private static long ScanWithIsValid(FwBasePool pool, int scans)
+        {
+            long sum = 0;
+            for (int scan = 0; scan < scans; scan++)
+            {
+                for (uint i = 0; i < pool.Capacity; i++)
+                {
+                    if (pool.IsValid(i))
+                    {
+                        sum += pool.GetGuidHandleByIndex(i);
+                    }
+                }
+            }
+
+            return sum;
+        }
+
+        private static long ScanWithEnumerator(FwBasePool pool, int scans)
+        {
+            long sum = 0;
+            for (int scan = 0; scan < scans; scan++)
+            {
+                FwBasePool.OccupiedSlotEnumerator enumerator = pool.GetOccupiedSlots();
+                while (enumerator.MoveNext())
+                {
+                    sum += enumerator.CurrentHandle;
+                }
+            }
+
+            return sum;
+        }
+
+        private static double Measure(Func<long> body, int scans)
+        {
+            // Take the best of a few runs, as a single run is easily disturbed by other processes
+            double best = double.MaxValue;
+            for (int i = 0; i < RunCount; i++)
+            {
+                var stopwatch = Stopwatch.StartNew();
+                body();
+                stopwatch.Stop();
+
+                best = Math.Min(best, stopwatch.Elapsed.TotalMilliseconds * 1000.0 / scans);
+            }
+
+            return best;
+        }
+    }
+}
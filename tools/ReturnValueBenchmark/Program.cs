@@ -0,0 +1,137 @@
+//
+// Copyright (C) 2015 crosire & kagikn & contributors
+// License: https://github.com/scripthookvdotnet/scripthookvdotnet#license
+//
+
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Globalization;
+using System.Runtime.InteropServices;
+using GTA;
+using GTA.Math;
+using GTA.Native;
+
+namespace ReturnValueBenchmark
+{
+    /// <summary>
+    /// Compares <see cref="ReturnValueConverter{T}"/> against the chain of type checks the v3 API used to convert
+    /// native return values, reading from fake result buffers laid out the way natives return their values.
+    /// </summary>
+    /// <remarks>
+    /// Usage: <c>dotnet run -c Release -- [iterations]</c>
+    /// </remarks>
+    internal static unsafe class Program
+    {
+        private static readonly List<string> s_mismatches = new();
+
+        private static int Main(string[] args)
+        {
+            int iterations = args.Length > 0 ? int.Parse(args[0], CultureInfo.InvariantCulture) : 5000000;
+
+            // Natives return 8 bytes per value, and vectors as floats padded to 8 bytes each
+            ulong* vectorResult = stackalloc ulong[3];
+            *(float*)&vectorResult[0] = 1.5f;
+            *(float*)&vectorResult[1] = -2.25f;
+            *(float*)&vectorResult[2] = 100f;
+            ulong handleResult = 0x1D0A;
+            ulong boolResult = 1;
+            ulong intResult = unchecked((ulong)-12345);
+            IntPtr stringData = Marshal.StringToCoTaskMemUTF8("PLAYER_ZERO");
+            ulong stringResult = (ulong)stringData.ToInt64();
+
+            try
+            {
+                Console.WriteLine($"{iterations} conversions per type");
+                Console.WriteLine($"{"Type",-10} {"Legacy ns",10} {"Cached ns",10} {"Legacy B",10} {"Cached B",10}");
+
+                Run<Vector3>(vectorResult, iterations);
+                Run<Ped>(&handleResult, iterations);
+                Run<bool>(&boolResult, iterations);
+                Run<string>(&stringResult, iterations);
+                Run<int>(&intResult, iterations);
+                Run<Player>(&handleResult, iterations);
+            }
+            finally
+            {
+                Marshal.FreeCoTaskMem(stringData);
+            }
+
+            foreach (string mismatch in s_mismatches)
+            {
+                Console.WriteLine("Mismatch: " + mismatch);
+            }
+
+            return s_mismatches.Count == 0 ? 0 : 1;
+        }
+
+        private static void Run<T>(ulong* result, int iterations)
+        {
+            T legacyValue = LegacyReturnValueConverter.ReturnValueFromResultAddress<T>(result);
+            T cachedValue = ReturnValueConverter<T>.FromNative(result);
+            string legacyText = Describe(legacyValue);
+            string cachedText = Describe(cachedValue);
+            if (legacyText != cachedText)
+            {
+                s_mismatches.Add($"{typeof(T).Name}: {legacyText} != {cachedText}");
+            }
+
+            // Warm up both paths so tiered compilation has settled before measuring
+            MeasureLegacy<T>(result, iterations / 10);
+            MeasureCached<T>(result, iterations / 10);
+
+            (double legacyNanoseconds, double legacyBytes) = MeasureLegacy<T>(result, iterations);
+            (double cachedNanoseconds, double cachedBytes) = MeasureCached<T>(result, iterations);
+
+            Console.WriteLine(string.Format(CultureInfo.InvariantCulture, "{0,-10} {1,10:F2} {2,10:F2} {3,10:F1} {4,10:F1}",
+                typeof(T).Name, legacyNanoseconds, cachedNanoseconds, legacyBytes, cachedBytes));
+        }
+
+        private static (double Nanoseconds, double Bytes) MeasureLegacy<T>(ulong* result, int iterations)
+        {
+            long allocatedBefore = GC.GetAllocatedBytesForCurrentThread();
+            var stopwatch = Stopwatch.StartNew();
+            T value = default;
+            for (int i = 0; i < iterations; i++)
+            {
+                value = LegacyReturnValueConverter.ReturnValueFromResultAddress<T>(result);
+            }
+            stopwatch.Stop();
+            GC.KeepAlive(value);
+
+            return ToPerCall(stopwatch, GC.GetAllocatedBytesForCurrentThread() - allocatedBefore, iterations);
+        }
+
+        private static (double Nanoseconds, double Bytes) MeasureCached<T>(ulong* result, int iterations)
+        {
+            long allocatedBefore = GC.GetAllocatedBytesForCurrentThread();
+            var stopwatch = Stopwatch.StartNew();
+            T value = default;
+            for (int i = 0; i < iterations; i++)
+            {
+                value = ReturnValueConverter<T>.FromNative(result);
+            }
+            stopwatch.Stop();
+            GC.KeepAlive(value);
+
+            return ToPerCall(stopwatch, GC.GetAllocatedBytesForCurrentThread() - allocatedBefore, iterations);
+        }
+
+        private static (double Nanoseconds, double Bytes) ToPerCall(Stopwatch stopwatch, long allocatedBytes, int iterations)
+        {
+            return (stopwatch.Elapsed.TotalMilliseconds * 1000000.0 / iterations, (double)allocatedBytes / iterations);
+        }
+
+        private static string Describe<T>(T value)
+        {
+            return value switch
+            {
+                null => "null",
+                PoolObject poolObject => poolObject.GetType().Name + " " + poolObject.Handle,
+                INativeValue nativeValue => value.GetType().Name + " " + nativeValue.NativeValue,
+                Vector3 vector => vector.ToString(),
+                _ => Convert.ToString(value, CultureInfo.InvariantCulture),
+            };
+        }
+    }
+}
@@ -0,0 +1,121 @@
+//
+// Copyright (C) 2015 crosire & kagikn & contributors
+// License: https://github.com/scripthookvdotnet/scripthookvdotnet#license
+//
+
+// The converter is linked from the v3 sources, which refer to these types of the v3 API that only work in the game.
+// Each stub keeps the constructors and members the converters use.
+namespace GTA.Native
+{
+    public interface INativeValue
+    {
+        ulong NativeValue
+        {
+            get; set;
+        }
+    }
+}
+
+namespace GTA
+{
+    using GTA.Native;
+
+    public readonly struct Model
+    {
+        public Model(int hash) => Hash = hash;
+        public int Hash { get; }
+    }
+
+    public readonly struct WeaponAsset
+    {
+        public WeaponAsset(int hash) => Hash = hash;
+        public int Hash { get; }
+    }
+
+    public readonly struct RelationshipGroup
+    {
+        public RelationshipGroup(int hash) => Hash = hash;
+        public int Hash { get; }
+    }
+
+    public readonly struct ShapeTestHandle
+    {
+        internal ShapeTestHandle(int handle) => Handle = handle;
+        public int Handle { get; }
+    }
+
+    public readonly struct AtHashValue
+    {
+        public AtHashValue(uint hash) => Hash = hash;
+        public uint Hash { get; }
+    }
+
+    public abstract class PoolObject : INativeValue
+    {
+        protected PoolObject(int handle) => Handle = handle;
+
+        public int Handle { get; protected set; }
+
+        public ulong NativeValue
+        {
+            get => (ulong)Handle;
+            set => Handle = unchecked((int)value);
+        }
+    }
+
+    public abstract class Entity : PoolObject
+    {
+        protected Entity(int handle) : base(handle)
+        {
+        }
+
+        // The real implementation looks up the entity type in the entity pool
+        public static Entity FromHandle(int handle) => handle == 0 ? null : new Ped(handle);
+    }
+
+    public sealed class Ped : Entity
+    {
+        internal Ped(int handle) : base(handle)
+        {
+        }
+    }
+
+    public sealed class Player : INativeValue
+    {
+        internal Player(int handle) => Handle = handle;
+
+        public int Handle { get; private set; }
+
+        public ulong NativeValue
+        {
+            get => (ulong)Handle;
+            set => Handle = unchecked((int)value);
+        }
+    }
+
+    public sealed class Scaleform : INativeValue
+    {
+        internal Scaleform(int handle) => Handle = handle;
+
+        public int Handle { get; private set; }
+
+        public ulong NativeValue
+        {
+            get => (ulong)Handle;
+            set => Handle = unchecked((int)value);
+        }
+    }
+
+    public sealed class InteriorProxy : INativeValue
+    {
+        internal InteriorProxy(int handle) => Handle = handle;
+
+        public int Handle { get; private set; }
+
+        public ulong NativeValue
+        {
+            get => (ulong)Handle;
+            set => Handle = unchecked((int)value);
+        }
+    }
+}
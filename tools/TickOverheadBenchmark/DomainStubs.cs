@@ -0,0 +1,189 @@
+//
+// Copyright (C) 2015 crosire & kagikn & contributors
+// License: https://github.com/scripthookvdotnet/scripthookvdotnet#license
+//
+
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Runtime.InteropServices;
+using System.Threading;
+using System.Threading.Tasks;
+
+// The console and the script domain as the main domain sees them when no script is loaded. The real ones need the
+// game to run, so these do the same checks a frame with zero scripts does and nothing else, which leaves the cost of
+// the cross-domain calls as the difference between the frame paths.
+namespace TickOverheadBenchmark
+{
+    /// <summary>
+    /// Stands in for <c>SHVDN.Console</c> while it is closed and no input line is being compiled.
+    /// </summary>
+    public sealed class ConsoleStub : MarshalByRefObject
+    {
+        private readonly object _lock = new();
+        private Task<object> _compilerTask;
+        private volatile bool _isOpen;
+
+        public bool IsOpen
+        {
+            get => _isOpen;
+            set => _isOpen = value;
+        }
+
+        public void DoTick()
+        {
+            Task<object> compilerTask;
+            lock (_lock)
+            {
+                compilerTask = _compilerTask;
+            }
+            if (compilerTask != null && compilerTask.IsCompleted)
+            {
+                _compilerTask = null;
+            }
+        }
+
+        public void DoKeyEvent(uint keys, bool status)
+        {
+            if (!_isOpen || !status)
+            {
+                return;
+            }
+        }
+
+        // Keep the proxy alive for as long as the benchmark runs
+        public override object InitializeLifetimeService() => null;
+    }
+
+    /// <summary>
+    /// Stands in for <c>SHVDN.ScriptDomain</c> with no scripts loaded. It exposes both the calls the main domain made
+    /// per frame before the frame was driven by a single call, and <see cref="DoFrame(bool, long, int)"/>.
+    /// </summary>
+    public sealed class ScriptDomainStub : MarshalByRefObject
+    {
+        [StructLayout(LayoutKind.Sequential)]
+        public struct NativeKeyMessage
+        {
+            public uint Keys;
+            public int IsDown;
+        }
+
+        private readonly ReaderWriterLockSlim _rwLock = new();
+        private readonly List<object> _runningScripts = new();
+        private readonly List<IntPtr> _pinnedStrings = new();
+        private ConsoleStub _console;
+        private IntPtr _frameKeyMessages;
+        private long _lastTraceDuration;
+
+        public bool IsTlsStuffInitialized() => true;
+
+        public void AttachConsole(ConsoleStub console)
+        {
+            _console = console;
+        }
+
+        public void InitKeyMessageBuffer(IntPtr frameKeyMessages)
+        {
+            _frameKeyMessages = frameKeyMessages;
+        }
+
+        /// <summary>
+        /// The frame as a single call, the way <c>ScriptDomain.DoFrame</c> drives it.
+        /// </summary>
+        public unsafe void DoFrame(bool traceClrThreadTick, long clrThreadTickStartTimestamp, int keyMessageCount)
+        {
+            if (keyMessageCount > 0 && _frameKeyMessages != IntPtr.Zero)
+            {
+                var keyMessages = (NativeKeyMessage*)_frameKeyMessages;
+                for (int i = 0; i < keyMessageCount; i++)
+                {
+                    DoKeyMessage(keyMessages[i].Keys, keyMessages[i].IsDown != 0);
+                }
+            }
+
+            _console?.DoTick();
+
+            DoTick();
+
+            if (traceClrThreadTick)
+            {
+                TraceClrThreadTick(clrThreadTickStartTimestamp, Stopwatch.GetTimestamp());
+            }
+        }
+
+        private void DoKeyMessage(uint keys, bool status)
+        {
+            ConsoleStub console = _console;
+            if (console != null)
+            {
+                console.DoKeyEvent(keys, status);
+
+                if (console.IsOpen)
+                {
+                    return;
+                }
+            }
+
+            DoKeyEvent(keys, status);
+        }
+
+        public void DoTick()
+        {
+            long doTickStartTimestamp = Stopwatch.GetTimestamp();
+
+            for (int i = 0; i < GetRunningScriptsCount(); i++)
+            {
+                _rwLock.EnterReadLock();
+                try
+                {
+                    _ = _runningScripts[i];
+                }
+                finally
+                {
+                    _rwLock.ExitReadLock();
+                }
+            }
+
+            _lastTraceDuration = Stopwatch.GetTimestamp() - doTickStartTimestamp;
+
+            // Clean up any pinned strings of this frame
+            _pinnedStrings.Clear();
+        }
+
+        public void DoKeyEvent(uint keys, bool status)
+        {
+            for (int i = 0; i < GetRunningScriptsCount(); i++)
+            {
+                _rwLock.EnterReadLock();
+                try
+                {
+                    _ = _runningScripts[i];
+                }
+                finally
+                {
+                    _rwLock.ExitReadLock();
+                }
+            }
+        }
+
+        public void TraceClrThreadTick(long startTimestamp, long endTimestamp)
+        {
+            _lastTraceDuration = endTimestamp - startTimestamp;
+        }
+
+        private int GetRunningScriptsCount()
+        {
+            _rwLock.EnterReadLock();
+            try
+            {
+                return _runningScripts.Count;
+            }
+            finally
+            {
+                _rwLock.ExitReadLock();
+            }
+        }
+
+        public override object InitializeLifetimeService() => null;
+    }
+}
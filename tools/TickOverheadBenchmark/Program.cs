@@ -0,0 +1,189 @@
+//
+// Copyright (C) 2015 crosire & kagikn & contributors
+// License: https://github.com/scripthookvdotnet/scripthookvdotnet#license
+//
+
+using System;
+using System.Diagnostics;
+using System.Globalization;
+using System.Runtime.InteropServices;
+using System.Runtime.Remoting;
+
+namespace TickOverheadBenchmark
+{
+    /// <summary>
+    /// Measures the overhead of a frame with zero scripts loaded, comparing the main domain calling the console and
+    /// the script domain separately through their proxies (plus up to four calls per key message) against a single
+    /// <c>DoFrame</c> call that runs the whole frame inside the script domain.
+    /// </summary>
+    /// <remarks>
+    /// Usage: <c>dotnet run -c Release -- [frames] [key messages per frame]</c>
+    /// Needs .NET Framework, so it only runs on Windows like the rest of the project.
+    /// </remarks>
+    internal static unsafe class Program
+    {
+        private const int RunCount = 3;
+        private const int WarmUpMilliseconds = 2000;
+
+        private static int Main(string[] args)
+        {
+            int frames = args.Length > 0 ? int.Parse(args[0], CultureInfo.InvariantCulture) : 200000;
+            int keyMessagesPerFrame = args.Length > 1 ? int.Parse(args[1], CultureInfo.InvariantCulture) : 2;
+
+            AppDomain scriptAppDomain = AppDomain.CreateDomain("ScriptDomain");
+            var domain = (ScriptDomainStub)scriptAppDomain.CreateInstanceAndUnwrap(
+                typeof(ScriptDomainStub).Assembly.FullName, typeof(ScriptDomainStub).FullName);
+            var console = (ConsoleStub)scriptAppDomain.CreateInstanceAndUnwrap(
+                typeof(ConsoleStub).Assembly.FullName, typeof(ConsoleStub).FullName);
+            domain.AttachConsole(console);
+
+            // The same stubs without proxies, to tell the work of a frame apart from the transitions
+            var directDomain = new ScriptDomainStub();
+            directDomain.AttachConsole(new ConsoleStub());
+
+            if (!RemotingServices.IsTransparentProxy(domain) || RemotingServices.IsTransparentProxy(directDomain))
+            {
+                Console.WriteLine("Mismatch: the script domain stub is not behind a cross-domain proxy");
+                return 1;
+            }
+
+            int maxKeyMessages = Math.Max(keyMessagesPerFrame, 1);
+            IntPtr keyMessageBuffer = Marshal.AllocHGlobal(sizeof(ScriptDomainStub.NativeKeyMessage) * maxKeyMessages);
+            try
+            {
+                domain.InitKeyMessageBuffer(keyMessageBuffer);
+                directDomain.InitKeyMessageBuffer(keyMessageBuffer);
+                var keyMessages = (ScriptDomainStub.NativeKeyMessage*)keyMessageBuffer;
+
+                WarmUp(domain, console, directDomain, keyMessages, keyMessagesPerFrame);
+
+                Console.WriteLine($"{frames} frames, {keyMessagesPerFrame} key messages per frame, no scripts loaded");
+                Console.WriteLine($"{"Path",-10} {"Keys",5} {"Trace",6} {"us/frame",10} {"Calls/frame",12}");
+
+                foreach (int keyCount in new[] { 0, keyMessagesPerFrame })
+                {
+                    foreach (bool traceTick in new[] { false, true })
+                    {
+                        Print("Legacy", keyCount, traceTick, 2 + (traceTick ? 1 : 0) + keyCount * 4,
+                            Measure(() => RunLegacy(domain, console, keyMessages, keyCount, traceTick, frames), frames));
+                        Print("Frame", keyCount, traceTick, 1,
+                            Measure(() => RunFrame(domain, keyMessages, keyCount, traceTick, frames), frames));
+                        Print("Direct", keyCount, traceTick, 0,
+                            Measure(() => RunFrame(directDomain, keyMessages, keyCount, traceTick, frames), frames));
+                    }
+
+                    if (keyMessagesPerFrame == 0)
+                    {
+                        break;
+                    }
+                }
+            }
+            finally
+            {
+                Marshal.FreeHGlobal(keyMessageBuffer);
+                AppDomain.Unload(scriptAppDomain);
+            }
+
+            return 0;
+        }
+
+        private static void WarmUp(ScriptDomainStub domain, ConsoleStub console, ScriptDomainStub directDomain,
+            ScriptDomainStub.NativeKeyMessage* keyMessages, int keyMessagesPerFrame)
+        {
+            // Run every path for a while so tiered compilation and the remoting sinks have settled before measuring
+            var stopwatch = Stopwatch.StartNew();
+            while (stopwatch.ElapsedMilliseconds < WarmUpMilliseconds)
+            {
+                RunLegacy(domain, console, keyMessages, keyMessagesPerFrame, true, 1000);
+                RunFrame(domain, keyMessages, keyMessagesPerFrame, true, 1000);
+                RunFrame(directDomain, keyMessages, keyMessagesPerFrame, true, 1000);
+            }
+        }
+
+        /// <summary>
+        /// The calls <c>ScriptHookVDotNet_ManagedTick</c> and <c>ScriptHookVDotNet_ManagedKeyboardMessage</c> made into
+        /// the script domain before a frame was driven by a single call.
+        /// </summary>
+        private static void RunLegacy(ScriptDomainStub domain, ConsoleStub console,
+            ScriptDomainStub.NativeKeyMessage* keyMessages, int keyMessageCount, bool traceTick, int frames)
+        {
+            for (int frame = 0; frame < frames; frame++)
+            {
+                long tickStartTimestamp = traceTick ? Stopwatch.GetTimestamp() : 0;
+
+                for (int i = 0; i < keyMessageCount; i++)
+                {
+                    FillKeyMessage(keyMessages, i);
+                    if (!domain.IsTlsStuffInitialized())
+                    {
+                        continue;
+                    }
+
+                    console.DoKeyEvent(keyMessages[i].Keys, keyMessages[i].IsDown != 0);
+                    if (console.IsOpen)
+                    {
+                        continue;
+                    }
+
+                    domain.DoKeyEvent(keyMessages[i].Keys, keyMessages[i].IsDown != 0);
+                }
+
+                console.DoTick();
+                domain.DoTick();
+
+                if (traceTick)
+                {
+                    domain.TraceClrThreadTick(tickStartTimestamp, Stopwatch.GetTimestamp());
+                }
+            }
+        }
+
+        /// <summary>
+        /// The single call <c>ScriptHookVDotNet_ManagedTick</c> makes into the script domain per frame.
+        /// </summary>
+        private static void RunFrame(ScriptDomainStub domain, ScriptDomainStub.NativeKeyMessage* keyMessages,
+            int keyMessageCount, bool traceTick, int frames)
+        {
+            for (int frame = 0; frame < frames; frame++)
+            {
+                long tickStartTimestamp = traceTick ? Stopwatch.GetTimestamp() : 0;
+
+                for (int i = 0; i < keyMessageCount; i++)
+                {
+                    FillKeyMessage(keyMessages, i);
+                }
+
+                domain.DoFrame(traceTick, tickStartTimestamp, keyMessageCount);
+            }
+        }
+
+        private static void FillKeyMessage(ScriptDomainStub.NativeKeyMessage* keyMessages, int index)
+        {
+            // Alternate key downs and ups of the A key, as typing would
+            keyMessages[index].Keys = 0x41;
+            keyMessages[index].IsDown = (index & 1) == 0 ? 1 : 0;
+        }
+
+        private static double Measure(Action body, int frames)
+        {
+            // Take the best of a few runs, as a single run is easily disturbed by other processes
+            double best = double.MaxValue;
+            for (int i = 0; i < RunCount; i++)
+            {
+                var stopwatch = Stopwatch.StartNew();
+                body();
+                stopwatch.Stop();
+
+                best = Math.Min(best, stopwatch.Elapsed.TotalMilliseconds * 1000.0 / frames);
+            }
+
+            return best;
+        }
+
+        private static void Print(string path, int keyCount, bool traceTick, int callsPerFrame, double microseconds)
+        {
+            Console.WriteLine(string.Format(CultureInfo.InvariantCulture, "{0,-10} {1,5} {2,6} {3,10:F3} {4,12}",
+                path, keyCount, traceTick, microseconds, callsPerFrame));
+        }
+    }
+}